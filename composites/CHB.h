@@ -8,7 +8,7 @@
 #include "LookupTableFactory.h"
 #include "MultiLag.h"
 #include "ObjectCache.h"
-#include "SinOscillator.h"
+#include "SimdBlocks.h"
 #include "poly.h"
 
 namespace rack {
@@ -17,7 +17,6 @@ struct Module;
 }
 }  // namespace rack
 using Module = ::rack::engine::Module;
-using Osc = SinOscillator<float, true>;
 
 #ifndef _CLAMP
 #define _CLAMP
@@ -41,6 +40,12 @@ public:
  *
  * Performance measure for 1.0 = 42.44
  * reduced polynomial order to what we actually use (10), perf = 39.5
+ *
+ * Now polyphonic. Pitch, modulation, envelope, gain and external audio are
+ * per channel, and run four channels at a time in float_4. The harmonic levels
+ * (and even, odd, slope) are still shared by all the channels, and only get
+ * recalculated every four samples.
+ * The number of channels comes from the V/Oct input, or the audio input if it has more.
  */
 template <class TBase>
 class CHB : public TBase {
@@ -137,6 +142,9 @@ public:
         knobToFilterL = makeLPFDirectFilterLookup<float>(this->engineGetSampleTime());
     }
 
+    /**
+     * frequency of channel 0, for unit tests
+     */
     float _freq = 0;
 
 private:
@@ -144,16 +152,40 @@ private:
     int clipCount = 0;
     int signalCount = 0;
     const int clipDuration = 4000;
-    float finalGain = 0;
     bool isExternalAudio = false;
 
     static const int polyOrder = 10;
+    static const int maxBanks = 4;  // 16 channels
+
+    int numChannels = 1;
+    int numBanks = 1;
 
     /**
-     * The waveshaper that is the heart of this module.
-     * Let's use doubles.
+     * The waveshapers that are the heart of this module.
+     * One for each bank of four channels.
      */
-    Poly<double, polyOrder> poly;
+    ChebyshevPoly<float_4, polyOrder> poly[maxBanks];
+
+    /**
+     * gain for each channel, 0..5
+     */
+    float_4 finalGain[maxBanks];
+
+    /**
+     * phase of the internal sine wave oscillators, 0..1
+     */
+    float_4 phase[maxBanks];
+
+    /**
+     * Knob values that only change at control rate.
+     */
+    float basePitch = 0;
+    float pitchModGain = 0;
+    float linearFMGain = 0;
+    bool isFold = false;
+
+    const float minPitch = float(LookupTableFactory<float>::exp2ExLowXMin());
+    const float maxPitch = float(LookupTableFactory<float>::exp2ExHighXMax());
 
     MultiLag<12> lag;
 
@@ -168,18 +200,11 @@ private:
     // round up to 12, so multi-lag is happy
     float _volume[12] = {0};
 
-    /**
-     * Internal sine wave oscillator to drive the waveshaper
-     */
-    SinOscillatorParams<float> sinParams;
-    SinOscillatorState<float> sinState;
-
     // just maps 0..1 to 0..1
     std::shared_ptr<LookupTableParams<float>> audioTaper = {ObjectCache<float>::getAudioTaper()};
 
     AudioMath::ScaleFun<float> gainCombiner = AudioMath::makeLinearScaler(0.f, 1.f);
 
-    std::function<float(float)> expLookup = ObjectCache<float>::getExp2Ex();
     std::shared_ptr<LookupTableParams<float>> db2gain = ObjectCache<float>::getDb2Gain();
     std::shared_ptr<LookupTableParams<float>> knobToFilterL;
 
@@ -190,15 +215,15 @@ private:
         {AudioMath::makeLinearScaler<float>(-18, 0)};
 
     /**
-     * do one-time calculations when sample rate changes
+     * Do all the processing to get the input waveform
+     * that will be fed to the polynomials, for one bank of channels.
      */
-    void internalUpdate();
+    float_4 getInput(int bank);
 
     /**
-     * Do all the processing to get the input waveform
-     * that will be fed to the polynomials
+     * channels, pitch knobs, and gains.
      */
-    float getInput();
+    void updateControls();
 
     void calcVolumes(float *);
 
@@ -223,6 +248,10 @@ inline void CHB<TBase>::init() {
     for (int i = 0; i < polyOrder; ++i) {
         _octave[i] = std::log2(float(i + 1));
     }
+    for (int i = 0; i < maxBanks; ++i) {
+        finalGain[i] = 0;
+        phase[i] = 0;
+    }
     onSampleRateChange();
     lag.setAttack(.1f);
     lag.setRelease(.0001f);
@@ -258,62 +287,73 @@ inline void CHB<TBase>::updateLagTC() {
 }
 
 template <class TBase>
-inline float CHB<TBase>::getInput() {
-    assert(TBase::engineGetSampleTime() > 0);
+inline void CHB<TBase>::updateControls() {
+    numChannels = std::max<int>(1, std::max<int>(TBase::inputs[CV_INPUT].channels, TBase::inputs[AUDIO_INPUT].channels));
+    numBanks = (numChannels + 3) / 4;
+    TBase::outputs[MIX_OUTPUT].setChannels(numChannels);
 
-    // Get the frequency from the inputs.
-    float pitch = 1.0f + roundf(TBase::params[PARAM_OCTAVE].value) +
-                  TBase::params[PARAM_SEMIS].value / 12.0f +
-                  TBase::params[PARAM_TUNE].value / 12.0f;
-    pitch += TBase::inputs[CV_INPUT].getVoltage(0);
-    pitch += .25f * TBase::inputs[PITCH_MOD_INPUT].getVoltage(0) *
-             taper(TBase::params[PARAM_PITCH_MOD_TRIM].value);
+    isExternalAudio = TBase::inputs[AUDIO_INPUT].isConnected();
+    isFold = TBase::params[PARAM_FOLD].value > .5;
 
     const float q = float(log2(261.626));  // move up to pitch range of EvenVCO
-    pitch += q;
-    _freq = expLookup(pitch);
-
-    if (_freq < .01f) {
-        _freq = .01f;
-    }
-
-    // Multiply in the Linear FM contribution
-    _freq *= 1.0f + TBase::inputs[LINEAR_FM_INPUT].getVoltage(0) * taper(TBase::params[PARAM_LINEAR_FM_TRIM].value);
-    float time = std::clamp(_freq * TBase::engineGetSampleTime(), -.5f, 0.5f);
-
-    Osc::setFrequency(sinParams, time);
-
-    if (cycleCount == 0) {
+    basePitch = 1.0f + roundf(TBase::params[PARAM_OCTAVE].value) +
+                TBase::params[PARAM_SEMIS].value / 12.0f +
+                TBase::params[PARAM_TUNE].value / 12.0f + q;
+    pitchModGain = .25f * taper(TBase::params[PARAM_PITCH_MOD_TRIM].value);
+    linearFMGain = taper(TBase::params[PARAM_LINEAR_FM_TRIM].value);
+
+    const float gainKnobValue = TBase::params[PARAM_EXTGAIN].value;
+    const float gainTrimValue = TBase::params[PARAM_EXTGAIN_TRIM].value;
+    const bool envConnected = TBase::inputs[ENV_INPUT].isConnected();
+    for (int channel = 0; channel < numBanks * 4; ++channel) {
+        if (channel >= numChannels) {
+            // silence the unused channels in the last bank
+            finalGain[channel / 4][channel % 4] = 0;
+            continue;
+        }
         // Get the gain from the envelope generator in
         // eGain = {0 .. 10.0f }
-        float eGain = TBase::inputs[ENV_INPUT].isConnected() ? TBase::inputs[ENV_INPUT].getVoltage(0) : 10.f;
-        isExternalAudio = TBase::inputs[AUDIO_INPUT].isConnected();
+        const float eGain = envConnected ? TBase::inputs[ENV_INPUT].getPolyVoltage(channel) : 10.f;
 
-        const float gainKnobValue = TBase::params[PARAM_EXTGAIN].value;
-        const float gainCVValue = TBase::inputs[GAIN_INPUT].getVoltage(0);
-        const float gainTrimValue = TBase::params[PARAM_EXTGAIN_TRIM].value;
+        const float gainCVValue = TBase::inputs[GAIN_INPUT].getPolyVoltage(channel);
         const float combinedGain = gainCombiner(gainCVValue, gainKnobValue, gainTrimValue);
 
         // tapered gain {0 .. 0.5}
         const float taperedGain = .5f * taper(combinedGain);
 
         // final gain 0..5
-        finalGain = taperedGain * eGain;
+        finalGain[channel / 4][channel % 4] = taperedGain * eGain;
     }
+}
 
-    float input = finalGain * (isExternalAudio ? TBase::inputs[AUDIO_INPUT].getVoltage(0) : Osc::run(sinState, sinParams));
-
-    checkClipping(input);
+template <class TBase>
+inline float_4 CHB<TBase>::getInput(int bank) {
+    assert(TBase::engineGetSampleTime() > 0);
+    const int channel = bank * 4;
 
-    // Now clip or fold to keep in -1...+1
-    if (TBase::params[PARAM_FOLD].value > .5) {
-        input = AudioMath::fold(input);
+    float_4 input;
+    if (isExternalAudio) {
+        input = TBase::inputs[AUDIO_INPUT].template getPolyVoltageSimd<float_4>(channel);
     } else {
-        input = std::max(input, -1.f);
-        input = std::min(input, 1.f);
-    }
+        // Get the frequency from the inputs.
+        float_4 pitch = basePitch + TBase::inputs[CV_INPUT].template getPolyVoltageSimd<float_4>(channel);
+        pitch += pitchModGain * TBase::inputs[PITCH_MOD_INPUT].template getPolyVoltageSimd<float_4>(channel);
+
+        // same range as the old exp2 lookup, 2 .. 20k.
+        pitch = rack::simd::clamp(pitch, minPitch, maxPitch);
+        float_4 freq = rack::dsp::approxExp2_taylor5(pitch);
+        if (bank == 0) {
+            _freq = freq[0];
+        }
 
-    return input;
+        // Multiply in the Linear FM contribution
+        freq *= 1.0f + TBase::inputs[LINEAR_FM_INPUT].template getPolyVoltageSimd<float_4>(channel) * linearFMGain;
+        const float_4 time = rack::simd::clamp(freq * TBase::engineGetSampleTime(), -.5f, 0.5f);
+
+        phase[bank] = SimdBlocks::wrapPhase01(phase[bank] + time);
+        input = SimdBlocks::sinPhase(phase[bank]);
+    }
+    return input * finalGain[bank];
 }
 
 /**
@@ -404,23 +444,38 @@ inline void CHB<TBase>::step() {
         cycleCount = 3;
     }
 
-    // do all the processing to get the carrier signal
-    // Does the pitch every cycle, vol every 4
-    const float input = getInput();
-
     if (cycleCount == 0) {
+        updateControls();
         updateLagTC();         // TODO: could do at reduced rate
         calcVolumes(_volume);  // now _volume has all 10 harmonic volumes
         lag.step(_volume);     // TODO: we could run lag at full rate.
 
-        for (int i = 0; i < polyOrder; ++i) {
-            //poly.setGain(i, _volume[i]);
-            poly.setGain(i, lag.get(i));
+        for (int bank = 0; bank < numBanks; ++bank) {
+            for (int i = 0; i < polyOrder; ++i) {
+                poly[bank].setGain(i, lag.get(i));
+            }
+            poly[bank].update(rack::simd::fmin(finalGain[bank], 1.f));
         }
     }
 
-    float output = poly.run(input, std::min(finalGain, 1.f));
-    TBase::outputs[MIX_OUTPUT].setVoltage(5.0f * output, 0);
+    // unused channels have zero gain, so they won't light the LED
+    float_4 peak = 0;
+    for (int bank = 0; bank < numBanks; ++bank) {
+        // do all the processing to get the carrier signal
+        float_4 input = getInput(bank);
+        peak = rack::simd::fmax(peak, input);
+
+        // Now clip or fold to keep in -1...+1
+        if (isFold) {
+            input = SimdBlocks::fold(input);
+        } else {
+            input = rack::simd::clamp(input, -1.f, 1.f);
+        }
+
+        const float_4 output = poly[bank].run(input);
+        TBase::outputs[MIX_OUTPUT].setVoltageSimd(5.0f * output, bank * 4);
+    }
+    checkClipping(std::max(std::max(peak[0], peak[1]), std::max(peak[2], peak[3])));
 }
 
 template <class TBase>
@@ -146,7 +146,7 @@ public:
 
 class NoiseServer : public ThreadServer {
 public:
-    NoiseServer(std::shared_ptr<ThreadSharedState> state) : ThreadServer(state) {
+    NoiseServer(std::shared_ptr<ThreadSharedState> state) : ThreadServer(state, Priority::High) {
     }
 
 protected:
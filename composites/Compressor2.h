@@ -3,10 +3,12 @@
 
 #include <assert.h>
 
+#include <algorithm>
 #include <memory>
 
 #include "Cmprsr.h"
 #include "CompressorParamHolder.h"
+#include "Crossover4Band.h"
 #include "Divider.h"
 #include "IComposite.h"
 #include "LookupTableFactory.h"
@@ -70,6 +72,10 @@ public:
         STEREO_PARAM,
         LABELS_PARAM,
         SIDECHAIN_PARAM,
+        MULTIBAND_PARAM,
+        XOVER_LOW_PARAM,
+        XOVER_MID_PARAM,
+        XOVER_HIGH_PARAM,
         NUM_PARAMS
     };
 
@@ -209,6 +215,8 @@ private:
     void setLinkAllBanks(bool);
 
     void pollUI();
+    void pollCrossovers();
+    void processMultiBand();
 
     /**
      * numChannels_m is the total mono channels. So even in
@@ -218,6 +226,14 @@ private:
     int numBanks_m = 0;
     int currentBank_m = -1;
 
+    /**
+     * In multi-band mode each bank is one input channel, and its
+     * four lanes are that channel's four bands. So "channel" n in the
+     * param holder and the VU meters is band n % 4 of input n / 4,
+     * and all the mono code just works.
+     */
+    bool currentMultiBand_m = false;
+
     /**  
      * Which of the channels we are editing ATM.
      * In mono this will be from 0..15
@@ -231,6 +247,15 @@ private:
     float_4 enabled[4] = {0};
     float_4 makeupGain[4] = {1};
 
+    Crossover4BandParams crossoverParams;
+    Crossover4Band crossovers[4];
+    Crossover4Band sidechainCrossovers[4];
+
+    /**
+     * The sidechain crossover of a bank only runs while some band in it uses the sidechain.
+     */
+    bool sidechainCrossoverRunning[4] = {false};
+
     Divider divn;
 
     // we could unify this stuff with the ui stuff, above.
@@ -250,6 +275,7 @@ private:
     int lastChannelCount = -1;
     bool lastNotBypassed = false;
     bool lastSidechainEnabled = false;
+    float lastRawXover[3] = {-1, -1, -1};
 
     std::atomic<bool> setAllChannelsSameFlag = {false};
     std::atomic<bool> initCurrentChannelFlag = {false};
@@ -566,10 +592,16 @@ inline void Compressor2<TBase>::stepn() {
     SqInput& inPort = TBase::inputs[LAUDIO_INPUT];
     SqOutput& outPort = TBase::outputs[LAUDIO_OUTPUT];
 
-    numChannels_m = inPort.channels;
-    outPort.setChannels(numChannels_m);
-
-    numBanks_m = (numChannels_m / 4) + ((numChannels_m % 4) ? 1 : 0);
+    if (currentMultiBand_m) {
+        numBanks_m = std::min(int(inPort.channels), 4);
+        numChannels_m = numBanks_m * 4;
+        outPort.setChannels(numBanks_m);
+        pollCrossovers();
+    } else {
+        numChannels_m = inPort.channels;
+        outPort.setChannels(numChannels_m);
+        numBanks_m = (numChannels_m / 4) + ((numChannels_m % 4) ? 1 : 0);
+    }
 
     currentChannel_m = -1 + int(std::round(TBase::params[CHANNEL_PARAM].value));
     assert(currentChannel_m >= 0);
@@ -598,7 +630,10 @@ inline void Compressor2<TBase>::stepn() {
 
 template <class TBase>
 inline void Compressor2<TBase>::pollStereo() {
-    const int stereo = int(std::round(Compressor2<TBase>::params[STEREO_PARAM].value));
+    currentMultiBand_m = bool(std::round(Compressor2<TBase>::params[MULTIBAND_PARAM].value));
+
+    // the bands of one channel aren't stereo pairs, so multi-band is always mono
+    const int stereo = currentMultiBand_m ? 0 : int(std::round(Compressor2<TBase>::params[STEREO_PARAM].value));
     if (stereo != currentStereo_m) {
         currentStereo_m = stereo;
         if (currentStereo_m > 0) {
@@ -608,6 +643,28 @@ inline void Compressor2<TBase>::pollStereo() {
     }
 }
 
+template <class TBase>
+inline void Compressor2<TBase>::pollCrossovers() {
+    const float low = Compressor2<TBase>::params[XOVER_LOW_PARAM].value;
+    const float mid = Compressor2<TBase>::params[XOVER_MID_PARAM].value;
+    const float high = Compressor2<TBase>::params[XOVER_HIGH_PARAM].value;
+    if (low == lastRawXover[0] && mid == lastRawXover[1] && high == lastRawXover[2]) {
+        return;
+    }
+    lastRawXover[0] = low;
+    lastRawXover[1] = mid;
+    lastRawXover[2] = high;
+
+    // the knob ranges overlap, and the top one can be over nyquist at low sample rates
+    const float sampleTime = TBase::engineGetSampleTime();
+    float f[3] = {low * sampleTime, mid * sampleTime, high * sampleTime};
+    std::sort(f, f + 3);
+    f[2] = std::min(f[2], .4f);
+    f[1] = std::min(f[1], .9f * f[2]);
+    f[0] = std::min(f[0], .9f * f[1]);
+    crossoverParams.setFrequencies(f[0], f[1], f[2]);
+}
+
 template <class TBase>
 inline void Compressor2<TBase>::setLinkAllBanks(bool linked) {
     for (int i = 0; i < 4; ++i) {
@@ -791,6 +848,10 @@ inline void Compressor2<TBase>::updateWetDry(int bank) {
 template <class TBase>
 inline void Compressor2<TBase>::process(const typename TBase::ProcessArgs& args) {
     divn.step();
+    if (currentMultiBand_m) {
+        processMultiBand();
+        return;
+    }
 
     SqInput& inPort = TBase::inputs[LAUDIO_INPUT];
     SqOutput& outPort = TBase::outputs[LAUDIO_OUTPUT];
@@ -825,6 +886,45 @@ inline void Compressor2<TBase>::process(const typename TBase::ProcessArgs& args)
     }
 }
 
+/**
+ * Each input channel is split into four bands, which are the four lanes
+ * of one bank. So one compressor does all the bands of a channel, and the
+ * bands are summed back together on the way out.
+ * Bypassed bands still go through the crossover, so turning one on
+ * and off doesn't change the phase of the others.
+ */
+template <class TBase>
+inline void Compressor2<TBase>::processMultiBand() {
+    SqInput& inPort = TBase::inputs[LAUDIO_INPUT];
+    SqOutput& outPort = TBase::outputs[LAUDIO_OUTPUT];
+    SqInput& scPort = TBase::inputs[SIDECHAIN_INPUT];
+
+    for (int bank = 0; bank < numBanks_m; ++bank) {
+        const float_4 en = compParams.getEnableds(bank);
+        simd_assertMask(en);
+
+        const float_4 bands = crossovers[bank].step(inPort.getVoltage(bank), crossoverParams);
+        const float_4 scEnabled = compParams.getSidechainEnableds(bank);
+        float_4 detectorInput = bands;
+        if (rack::simd::movemask(scEnabled)) {
+            // if it was stopped, what's in it is from the last time it ran.
+            if (!sidechainCrossoverRunning[bank]) {
+                sidechainCrossovers[bank].clear();
+                sidechainCrossoverRunning[bank] = true;
+            }
+            const float_4 scBands = sidechainCrossovers[bank].step(scPort.getPolyVoltage(bank), crossoverParams);
+            detectorInput = SimdBlocks::ifelse(scEnabled, scBands, bands);
+        } else {
+            sidechainCrossoverRunning[bank] = false;
+        }
+
+        const float_4 wetOutput = compressors[bank].stepPoly(bands, detectorInput) * makeupGain[bank];
+        const float_4 mixedOutput = wetOutput * wetLevel[bank] + bands * dryLevel[bank];
+        const float_4 out = SimdBlocks::ifelse(en, mixedOutput, bands);
+        outPort.setVoltage(out[0] + out[1] + out[2] + out[3], bank);
+    }
+}
+
 // TODO: do we still need this old init function? combine with other?
 template <class TBase>
 inline void Compressor2<TBase>::setupLimiter() {
@@ -837,6 +937,7 @@ template <class TBase>
 inline void Compressor2<TBase>::onSampleRateChange() {
     // should probably just reset cache here??
     setupLimiter();
+    lastRawXover[0] = -1;  // crossovers are normalized to the sample rate
 }
 
 template <class TBase>
@@ -895,6 +996,18 @@ inline IComposite::Config Compressor2Description<TBase>::getParamValue(int i) {
         case Compressor2<TBase>::SIDECHAIN_PARAM:
             ret = {0, 1, 0, "Sidechain"};
             break;
+        case Compressor2<TBase>::MULTIBAND_PARAM:
+            ret = {0, 1, 0, "Multi-band"};
+            break;
+        case Compressor2<TBase>::XOVER_LOW_PARAM:
+            ret = {40, 1000, 150, "Low crossover"};
+            break;
+        case Compressor2<TBase>::XOVER_MID_PARAM:
+            ret = {200, 5000, 1000, "Mid crossover"};
+            break;
+        case Compressor2<TBase>::XOVER_HIGH_PARAM:
+            ret = {1000, 16000, 5000, "High crossover"};
+            break;
         default:
             assert(false);
     }
@@ -35,12 +35,13 @@ public:
  * with 4X: 140
  * with all the features: 145
  * final version: 152
+ *
+ * Filters run as float_4, four channels at a time.
  */
 template <class TBase>
 class Filt : public TBase {
 public:
-    using T = double;
-    //using T = float_4;
+    using T = float_4;
     Filt(Module* module) : TBase(module) {
     }
     Filt() : TBase() {
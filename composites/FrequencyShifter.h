@@ -1,12 +1,14 @@
 #pragma once
 
+#include <algorithm>
+#include <memory>
+
 #include "BiquadFilter.h"
 #include "BiquadParams.h"
 #include "BiquadState.h"
 #include "HilbertFilterDesigner.h"
 #include "IComposite.h"
-#include "LookupTable.h"
-#include "SinOscillator.h"
+#include "SimdBlocks.h"
 
 namespace rack {
 namespace engine {
@@ -27,6 +29,10 @@ public:
  *
  * If TBase is WidgetComposite, this class is used as the implementation part of the Booty Shifter module.
  * If TBase is TestComposite, this class may stand alone for unit tests.
+ *
+ * Polyphonic: each audio input may have up to 16 channels, and the outputs
+ * follow them. The Hilbert filters and the quadrature oscillators run four channels
+ * at a time in float_4. The CV may be polyphonic too, to shift each channel differently.
  */
 template <class TBase>
 class FrequencyShifter : public TBase {
@@ -48,15 +54,14 @@ public:
 
     void setSampleRate(float rate) {
         reciprocalSampleRate = 1 / rate;
-        HilbertFilterDesigner<T>::design(rate, hilbertFilterParamsSin, hilbertFilterParamsCos);
+        HilbertFilterDesigner<float_4>::design(rate, hilbertFilterParamsSin, hilbertFilterParamsCos);
     }
 
     // must be called after setSampleRate
     void init() {
-        SinOscillator<T, true>::setFrequency(oscParams, T(.01));
-        exponential2 = ObjectCache<T>::getExp2();  // Get a shared copy of the 2**x lookup.
-                                                   // This will enable exp mode to track at
-                                                   // 1V/ octave.
+        for (int i = 0; i < maxBanks; ++i) {
+            phase[i] = 0;
+        }
     }
 
     // Define all the enums here. This will let the tests and the widget access them.
@@ -92,69 +97,99 @@ public:
     typedef float T;  // use floats for all signals
     T freqRange = 5;  // the freq range switch
 private:
-    SinOscillatorParams<T> oscParams;
-    SinOscillatorState<T> oscState;
-    SinOscillatorState<T> oscStateR;
-    BiquadParams<T, 3> hilbertFilterParamsSin;
-    BiquadParams<T, 3> hilbertFilterParamsCos;
-    BiquadState<T, 3> hilbertFilterStateSin;
-    BiquadState<T, 3> hilbertFilterStateCos;
-    BiquadState<T, 3> hilbertFilterStateSinR;
-    BiquadState<T, 3> hilbertFilterStateCosR;
-
-    std::shared_ptr<LookupTableParams<T>> exponential2;
-
-    float reciprocalSampleRate;
+    static const int maxBanks = 4;  // 16 channels
+
+    /**
+     * Phase of the quadrature oscillators, 0..1.
+     * Channel n of the left and right sides see the same CV, so they share an oscillator.
+     */
+    float_4 phase[maxBanks];
+
+    BiquadParams<float_4, 3> hilbertFilterParamsSin;
+    BiquadParams<float_4, 3> hilbertFilterParamsCos;
+    BiquadState<float_4, 3> hilbertFilterStateSin[maxBanks];
+    BiquadState<float_4, 3> hilbertFilterStateCos[maxBanks];
+    BiquadState<float_4, 3> hilbertFilterStateSinR[maxBanks];
+    BiquadState<float_4, 3> hilbertFilterStateCosR[maxBanks];
+
+    float reciprocalSampleRate = 0;
+
+    float_4 getFrequency(int bank);
+    void shift(int bank,
+               int input,
+               int sinOutput,
+               int cosOutput,
+               float_4 x,
+               float_4 y,
+               BiquadState<float_4, 3>& stateSin,
+               BiquadState<float_4, 3>& stateCos);
 };
 
 template <class TBase>
-inline void FrequencyShifter<TBase>::step() {
-    assert(exponential2->isValid());
-
+inline float_4 FrequencyShifter<TBase>::getFrequency(int bank) {
     // Add the knob and the CV value.
-    T freqHz;
-    T cvTotal = TBase::params[PITCH_PARAM].value + TBase::inputs[CV_INPUT].getVoltage(0);
-    if (cvTotal > 5) {
-        cvTotal = 5;
-    }
-    if (cvTotal < -5) {
-        cvTotal = -5;
-    }
+    float_4 cvTotal = TBase::params[PITCH_PARAM].value +
+                      TBase::inputs[CV_INPUT].template getPolyVoltageSimd<float_4>(bank * 4);
+    cvTotal = rack::simd::clamp(cvTotal, -5.f, 5.f);
     if (freqRange > .2) {
-        cvTotal *= freqRange;
-        cvTotal *= T(1. / 5.);
-        freqHz = cvTotal;
-    } else {
-        cvTotal += 7;  // shift up to GE 2 (min value for out 1v/oct lookup)
-        freqHz = LookupTable<T>::lookup(*exponential2, cvTotal);
-        freqHz /= 2;  // down to 2..2k range that we want.
+        return cvTotal * (freqRange * T(1. / 5.));
     }
 
-    SinOscillator<float, true>::setFrequency(oscParams, freqHz * reciprocalSampleRate);
-
-    // Generate the quadrature sin oscillators.
-    T x, xR, y, yR;
-    SinOscillator<T, true>::runQuadrature(x, y, oscState, oscParams);
-    SinOscillator<T, true>::runQuadrature(xR, yR, oscStateR, oscParams);
+    // 1V/octave, 2..2k range.
+    return rack::dsp::approxExp2_taylor5(cvTotal + 7) * .5f;
+}
 
+template <class TBase>
+inline void FrequencyShifter<TBase>::shift(int bank,
+                                           int input,
+                                           int sinOutput,
+                                           int cosOutput,
+                                           float_4 x,
+                                           float_4 y,
+                                           BiquadState<float_4, 3>& stateSin,
+                                           BiquadState<float_4, 3>& stateCos) {
     // Filter the input through the quadrature filter
-    const T input = TBase::inputs[AUDIO_INPUT].getVoltage(0);
-    const T inputR = TBase::inputs[AUDIO_R_INPUT].getVoltage(0);
-    const T hilbertSin = BiquadFilter<T>::run(input, hilbertFilterStateSin, hilbertFilterParamsSin);
-    const T hilbertCos = BiquadFilter<T>::run(input, hilbertFilterStateCos, hilbertFilterParamsCos);
-    const T hilbertSinR = BiquadFilter<T>::run(inputR, hilbertFilterStateSinR, hilbertFilterParamsSin);
-    const T hilbertCosR = BiquadFilter<T>::run(inputR, hilbertFilterStateCosR, hilbertFilterParamsCos);
+    const float_4 audio = TBase::inputs[input].template getVoltageSimd<float_4>(bank * 4);
+    const float_4 hilbertSin = BiquadFilter<float_4>::run(audio, stateSin, hilbertFilterParamsSin);
+    const float_4 hilbertCos = BiquadFilter<float_4>::run(audio, stateCos, hilbertFilterParamsCos);
+
     // Cross modulate the two sections.
     x *= hilbertSin;
     y *= hilbertCos;
-    xR *= hilbertSinR;
-    yR *= hilbertCosR;
 
     // And combine for final SSB output.
-    TBase::outputs[SIN_OUTPUT].setVoltage(x + y, 0);
-    TBase::outputs[SIN_R_OUTPUT].setVoltage(xR + yR, 0);
-    TBase::outputs[COS_OUTPUT].setVoltage(x - y, 0);
-    TBase::outputs[COS_R_OUTPUT].setVoltage(xR - yR, 0);
+    TBase::outputs[sinOutput].setVoltageSimd(x + y, bank * 4);
+    TBase::outputs[cosOutput].setVoltageSimd(x - y, bank * 4);
+}
+
+template <class TBase>
+inline void FrequencyShifter<TBase>::step() {
+    assert(reciprocalSampleRate > 0);
+
+    const int numChannels = std::max<int>(1, TBase::inputs[AUDIO_INPUT].channels);
+    const int numChannelsR = std::max<int>(1, TBase::inputs[AUDIO_R_INPUT].channels);
+    TBase::outputs[SIN_OUTPUT].setChannels(numChannels);
+    TBase::outputs[COS_OUTPUT].setChannels(numChannels);
+    TBase::outputs[SIN_R_OUTPUT].setChannels(numChannelsR);
+    TBase::outputs[COS_R_OUTPUT].setChannels(numChannelsR);
+
+    const int numBanks = (numChannels + 3) / 4;
+    const int numBanksR = (numChannelsR + 3) / 4;
+    for (int bank = 0; bank < std::max(numBanks, numBanksR); ++bank) {
+        // Generate the quadrature sin oscillators.
+        const float_4 x = SimdBlocks::sinPhase(phase[bank]);
+        const float_4 y = SimdBlocks::sinPhase(phase[bank] + .25f);
+        phase[bank] = SimdBlocks::wrapPhase01(phase[bank] + getFrequency(bank) * reciprocalSampleRate);
+
+        if (bank < numBanks) {
+            shift(bank, AUDIO_INPUT, SIN_OUTPUT, COS_OUTPUT, x, y,
+                  hilbertFilterStateSin[bank], hilbertFilterStateCos[bank]);
+        }
+        if (bank < numBanksR) {
+            shift(bank, AUDIO_R_INPUT, SIN_R_OUTPUT, COS_R_OUTPUT, x, y,
+                  hilbertFilterStateSinR[bank], hilbertFilterStateCosR[bank]);
+        }
+    }
 }
 
 template <class TBase>
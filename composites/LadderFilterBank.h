@@ -1,12 +1,28 @@
 #pragma once
-#include "LadderFilter.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <type_traits>
+
+#include "AudioMath_4.h"
+#include "LadderFilter_4.h"
+#include "LookupTableFactory.h"
 #include "PeakDetector.h"
 #include "SqPort.h"
 #include "SqStream.h"
 
+
+/**
+ * All the filters for Filt.
+ * T is float_4. Each LadderFilter<T> runs four channels, so
+ * filterL[0] has channels 0..3, filterL[1] has 4..7, etc.
+ */
 template <typename T>
 class LadderFilterBank {
 public:
+    static_assert(std::is_same<T, float_4>::value, "LadderFilterBank is float_4 only");
+
     enum class Modes {
         normal,    // mono, poly. R out == L out
         stereo,    // in L -> out L, in R -> out R
@@ -16,7 +32,7 @@ public:
     void stepn(float sampleTime, int numChannels,
                SqInput& fc1Input, SqInput& fc2Input, SqInput& qInput, SqInput& driveInput, SqInput& edgeInput, SqInput& slopeInput,
                float fcParam, float fc1TrimParam, float fc2TrimParam,
-               T volume,
+               float volume,
                float qParam, float qTrimParam, float makeupGainParam,
                typename LadderFilter<T>::Types type, typename LadderFilter<T>::Voicing voicing,
                float driveParam, float driveTrim,
@@ -39,33 +55,131 @@ public:
         s.add("[");
         s.add(channel);
         s.add("] ");
-        filterL[channel]._dump(s.str());
-        filterR[channel]._dump(s.str());
+        filterL[channel / 4]._dump(s.str());
+        filterR[channel / 4]._dump(s.str());
     }
+
+    /**
+     * returns the filter that is running channel.
+     */
     const LadderFilter<T>& get(int channel) {
-        //return filters[channel];
-        return filterL[channel];
+        return filterL[channel / 4];
     }
 
 private:
-    LadderFilter<T> filterL[16];
-    LadderFilter<T> filterR[16];
+    LadderFilter<T> filterL[4];
+    LadderFilter<T> filterR[4];
+
+    /**
+     * Everything that is the same for all channels.
+     */
+    struct Controls {
+        float sampleTime;
+        float fcParam, fc1TrimParam, fc2TrimParam;
+        float volume;
+        float qCV, qParam, qTrimParam, makeupGainParam;
+        int type, voicing;
+        float driveParam, driveTrim;
+        float edgeParam, edgeTrim;
+        float slopeParam, slopeTrim;
+        float spread;
+    };
+
+    /**
+     * The CV that a bank of filters was last set up with.
+     */
+    struct BankCV {
+        T fc1, fc2, drive, edge, slope;
+    };
+
+    Controls lastControls;
+    bool lastControlsValid = false;
+    BankCV lastCV[4];
+    int lastNumBanks = 0;
+
+    float feedback = 0;
+    float makeupGain = 1;
 
-    std::shared_ptr<LookupTableParams<T>> expLookup = ObjectCache<T>::getExp2();  // Do we need more precision?
     AudioMath::ScaleFun<float> scaleGain = AudioMath::makeLinearScaler<float>(0, 1);
     std::shared_ptr<LookupTableParams<float>> audioTaper = {ObjectCache<float>::getAudioTaper()};
 
-    AudioMath::ScaleFun<float> scaleFc = AudioMath::makeScalerWithBipolarAudioTrim(-5, 5);
+    AudioMath_4::ScaleFun scaleFc = AudioMath_4::makeScalerWithBipolarAudioTrim(-5, 5, -5, 5);
     AudioMath::ScaleFun<float> scaleQ = AudioMath::makeScalerWithBipolarAudioTrim(0, 4);
-    AudioMath::ScaleFun<float> scaleSlope = AudioMath::makeScalerWithBipolarAudioTrim(0, 3);
-    AudioMath::ScaleFun<float> scaleEdge = AudioMath::makeScalerWithBipolarAudioTrim(0, 1);
+    AudioMath_4::ScaleFun scaleSlope = AudioMath_4::makeScalerWithBipolarAudioTrim(-5, 5, 0, 3);
+    AudioMath_4::ScaleFun scaleEdge = AudioMath_4::makeScalerWithBipolarAudioTrim(-5, 5, 0, 1);
+
+    void updateFeedback(const Controls&);
+    T calcNormalizedFc(T fc1CV, T fc2CV, const Controls&);
+    T calcGain(T driveCV, const Controls&);
+
+    static bool changed(T a, T b) {
+        return rack::simd::movemask(a != b) != 0;
+    }
+
+    static void peakStep(PeakDetector& peak, T output, int numChannels, int channel) {
+        const int lanes = std::min(4, numChannels - channel);
+        for (int i = 0; i < lanes; ++i) {
+            peak.step(output[i]);
+        }
+    }
 };
 
+template <typename T>
+inline void LadderFilterBank<T>::updateFeedback(const Controls& controls) {
+    // Q only looks at the first channel, so it's the same for every bank.
+    float res = scaleQ(
+        controls.qCV,
+        controls.qParam,
+        controls.qTrimParam);
+    const float qMiddle = 2.8f;
+    res = (res < 2) ? (res * qMiddle / 2) : .5f * (res - 2) * (4 - qMiddle) + qMiddle;
+    if (res < 0 || res > 4) fprintf(stderr, "res out of bounds %f\n", res);
+
+    feedback = res;
+    makeupGain = 1 + controls.makeupGainParam * res;
+}
+
+template <typename T>
+inline T LadderFilterBank<T>::calcNormalizedFc(T fc1CV, T fc2CV, const Controls& controls) {
+    // clip the Fc CV to the range of the old exp lookup table.
+    const float minFcCV = float(LookupTableFactory<float>::exp2XMin());
+    const float maxFcCV = float(LookupTableFactory<float>::exp2XMax());
+
+    T freqCV1 = scaleFc(
+        fc1CV,
+        controls.fcParam,
+        controls.fc1TrimParam);
+    T freqCV2 = scaleFc(
+        fc2CV,
+        0,
+        controls.fc2TrimParam);  // note: test second inputs
+    T freqCV = rack::simd::clamp(freqCV1 + freqCV2 + 6, minFcCV, maxFcCV);
+    const T fc = rack::dsp::approxExp2_taylor5(freqCV) * 10;
+    const T normFc = fc * controls.sampleTime;
+    return rack::simd::clamp(normFc, .0000001f, .48f);
+}
+
+template <typename T>
+inline T LadderFilterBank<T>::calcGain(T driveCV, const Controls& controls) {
+    T gain;
+    for (int i = 0; i < 4; ++i) {
+        const float gainInput = scaleGain(driveCV[i], controls.driveParam, controls.driveTrim);
+        gain[i] = .15f + 4 * LookupTable<float>::lookup(*audioTaper, gainInput, false);
+    }
+    return gain;
+}
+
+/**
+ * Only does work for banks whose CV changed, or for all of them when
+ * something they share changed (knobs, Q CV, type...).
+ * When a CV input has only one channel it is the same for every bank, so
+ * we calculate it once and give the result to all of them.
+ */
 template <typename T>
 inline void LadderFilterBank<T>::stepn(float sampleTime, int numChannels,
                                        SqInput& fc1Input, SqInput& fc2Input, SqInput& qInput, SqInput& driveInput, SqInput& edgeInput, SqInput& slopeInput,
                                        float fcParam, float fc1TrimParam, float fc2TrimParam,
-                                       T volume,
+                                       float volume,
                                        float qParam, float qTrimParam, float makeupGainParam,
                                        typename LadderFilter<T>::Types type, typename LadderFilter<T>::Voicing voicing,
                                        float driveParam, float driveTrimParam,
@@ -73,84 +187,105 @@ inline void LadderFilterBank<T>::stepn(float sampleTime, int numChannels,
                                        float slopeParam, float slopeTrim,
                                        float spreadParam) {
 
-    for (int channel = 0; channel < numChannels; ++channel) {
-        LadderFilter<T>& filt = filterL[channel];
-        LadderFilter<T>& filtR = filterR[channel];
-
-        filt.setType(type);
-        filtR.setType(type);
-        filt.setVoicing(voicing);
-        filtR.setVoicing(voicing);
-        filt.setVolume(volume);
-        filtR.setVolume(volume);
-
-        // filter Fc calc
-        {
-            T fcClipped = 0;
-            T freqCV1 = scaleFc(
-                fc1Input.getPolyVoltage(channel),
-                fcParam,
-                fc1TrimParam);
-            T freqCV2 = scaleFc(
-                fc2Input.getPolyVoltage(channel),
-                0,
-                fc2TrimParam);  // note: test second inputs
-            T freqCV = freqCV1 + freqCV2 + 6;
-            const T fc = LookupTable<T>::lookup(*expLookup, freqCV, true) * 10;
-            const T normFc = fc * sampleTime;
-
-            fcClipped = std::min(normFc, T(.48));
-            fcClipped = std::max(fcClipped, T(.0000001));
-            filt.setNormalizedFc(fcClipped);
-            filtR.setNormalizedFc(fcClipped);
-        }
-        {
-            T res = scaleQ(
-                qInput.getPolyVoltage(0),
-                qParam,
-                qTrimParam);
-            const T qMiddle = 2.8;
-            res = (res < 2) ? (res * qMiddle / 2) : .5 * (res - 2) * (4 - qMiddle) + qMiddle;
+    const Controls controls = {
+        sampleTime,
+        fcParam, fc1TrimParam, fc2TrimParam,
+        volume,
+        qInput.getPolyVoltage(0), qParam, qTrimParam, makeupGainParam,
+        int(type), int(voicing),
+        driveParam, driveTrimParam,
+        edgeParam, edgeTrim,
+        slopeParam, slopeTrim,
+        spreadParam};
+    const bool controlsChanged = !lastControlsValid || (memcmp(&controls, &lastControls, sizeof(Controls)) != 0);
+    if (controlsChanged) {
+        lastControls = controls;
+        lastControlsValid = true;
+        updateFeedback(controls);
+    }
 
-            if (res < 0 || res > 4) fprintf(stderr, "res out of bounds %f\n", res);
+    const bool fcShared = (fc1Input.channels <= 1) && (fc2Input.channels <= 1);
+    const bool driveShared = driveInput.channels <= 1;
+    const bool edgeShared = edgeInput.channels <= 1;
+    const bool slopeShared = slopeInput.channels <= 1;
+    bool haveFc = false;
+    bool haveGain = false;
+    bool haveEdge = false;
+    bool haveSlope = false;
+    T fc, gain, edge, slope;
 
-            const T bAmt = makeupGainParam;
-            const T makeupGain = 1 + bAmt * (res);
+    const int numBanks = (numChannels + 3) / 4;
+    for (int bank = 0; bank < numBanks; ++bank) {
+        const int channel = bank * 4;
 
-            filt.setFeedback(res);
-            filtR.setFeedback(res);
+        // a bank that was not running may have old settings.
+        const bool updateAll = controlsChanged || (bank >= lastNumBanks);
+        const BankCV cv = {
+            fc1Input.getPolyVoltageSimd<T>(channel),
+            fc2Input.getPolyVoltageSimd<T>(channel),
+            driveInput.getPolyVoltageSimd<T>(channel),
+            edgeInput.getPolyVoltageSimd<T>(channel),
+            slopeInput.getPolyVoltageSimd<T>(channel)};
+        BankCV& last = lastCV[bank];
+        const bool fcChanged = updateAll || changed(cv.fc1, last.fc1) || changed(cv.fc2, last.fc2);
+        const bool driveChanged = updateAll || changed(cv.drive, last.drive);
+        const bool edgeChanged = updateAll || changed(cv.edge, last.edge);
+        const bool slopeChanged = updateAll || changed(cv.slope, last.slope);
+        if (!fcChanged && !driveChanged && !edgeChanged && !slopeChanged) {
+            continue;
+        }
+        last = cv;
+
+        LadderFilter<T>& filt = filterL[bank];
+        LadderFilter<T>& filtR = filterR[bank];
+        if (updateAll) {
+            filt.setType(type);
+            filtR.setType(type);
+            filt.setVoicing(voicing);
+            filtR.setVoicing(voicing);
+            filt.setVolume(volume);
+            filtR.setVolume(volume);
+            filt.setFeedback(feedback);
+            filtR.setFeedback(feedback);
             filt.setBassMakeupGain(makeupGain);
             filtR.setBassMakeupGain(makeupGain);
+            filt.setFreqSpread(spreadParam);
+            filtR.setFreqSpread(spreadParam);
         }
-        {
-            float gainInput = scaleGain(
-                driveInput.getPolyVoltage(channel),
-                driveParam,
-                driveTrimParam);
-
-            T gain = T(.15) + 4 * LookupTable<float>::lookup(*audioTaper, gainInput, false);
+        if (fcChanged) {
+            if (!haveFc || !fcShared) {
+                fc = calcNormalizedFc(cv.fc1, cv.fc2, controls);
+                haveFc = true;
+            }
+            filt.setNormalizedFc(fc);
+            filtR.setNormalizedFc(fc);
+        }
+        if (driveChanged) {
+            if (!haveGain || !driveShared) {
+                gain = calcGain(cv.drive, controls);
+                haveGain = true;
+            }
             filt.setGain(gain);
             filtR.setGain(gain);
         }
-        {
-            const float edge = scaleEdge(
-                edgeInput.getPolyVoltage(channel),
-                edgeParam,
-                edgeTrim);
+        if (edgeChanged) {
+            if (!haveEdge || !edgeShared) {
+                edge = scaleEdge(cv.edge, edgeParam, edgeTrim);
+                haveEdge = true;
+            }
             filt.setEdge(edge);
             filtR.setEdge(edge);
         }
-        {
-            T slope = scaleSlope(
-                slopeInput.getPolyVoltage(channel),
-                slopeParam,
-                slopeTrim);
+        if (slopeChanged) {
+            if (!haveSlope || !slopeShared) {
+                slope = scaleSlope(cv.slope, slopeParam, slopeTrim);
+                haveSlope = true;
+            }
             filt.setSlope(slope);
             filtR.setSlope(slope);
         }
-        filt.setFreqSpread(spreadParam);
-        filtR.setFreqSpread(spreadParam);
     }
+    lastNumBanks = numBanks;
 }
 
 template <typename T>
@@ -159,23 +294,24 @@ inline void LadderFilterBank<T>::step(int numChannels, Modes mode,
                                       SqInput* inputForChannel0, SqInput* inputForChannel1,
                                       PeakDetector& peak, bool poly) {
 
-    for (int channel = 0; channel < numChannels; ++channel) {
-        LadderFilter<T>& filt = filterL[channel];
+    const int numBanks = (numChannels + 3) / 4;
+    for (int bank = 0; bank < numBanks; ++bank) {
+        const int channel = bank * 4;
+        LadderFilter<T>& filt = filterL[bank];
+        LadderFilter<T>& filtR = filterR[bank];
 
-        float input = audioInput.getVoltage(channel);
+        T input = audioInput.getVoltageSimd<float_4>(channel);
         if (!poly) {
             switch (mode) {
                 case Modes::stereo:
-                    if (channel == 1) {
-                        assert(inputForChannel1);
-                        // for legacy stereo mode, dsp1 gets input from right input
-                        input = inputForChannel1->getVoltage(0);
-                    }
+                    // for legacy stereo mode, dsp1 gets input from right input
+                    assert(inputForChannel1);
                     assert(numChannels == 2);
+                    input[1] = inputForChannel1->getVoltage(0);
                     break;
                 case Modes::rightOnly:
-                    assert(channel == 0);
-                    input = inputForChannel0->getVoltage(0);
+                    assert(numChannels == 1);
+                    input[0] = inputForChannel0->getVoltage(0);
                     break;
                 case Modes::normal:
                 case Modes::leftOnly:
@@ -184,44 +320,37 @@ inline void LadderFilterBank<T>::step(int numChannels, Modes mode,
                     assert(false);
             }
             filt.run(input);
-            const float output = (float)filt.getOutput();
-            audioOutput.setVoltage(output, channel);
-            peak.step(output);
-        }
-        else {
+            const T output = filt.getOutput();
+            audioOutput.setVoltageSimd(output, channel);
+            peakStep(peak, output, numChannels, channel);
+        } else {
             // It is poly
             switch (mode) {
                 case Modes::stereo: {
-
                     filt.run(input);
-                    const float output = (float)filt.getOutput();
-                    audioOutput.setVoltage(output, channel);
-                    peak.step(output);
-                    
-                    LadderFilter<T>& filtR = filterR[channel];
-                    float inputR = inputForChannel1->getVoltage(channel);
-                    filtR.run(inputR);
-                    const float outputr = (float)filtR.getOutput();
-                    audioOutputR.setVoltage(outputr, channel);
-                    }
-                    break; 
+                    const T output = filt.getOutput();
+                    audioOutput.setVoltageSimd(output, channel);
+                    peakStep(peak, output, numChannels, channel);
+
+                    filtR.run(inputForChannel1->getVoltageSimd<float_4>(channel));
+                    audioOutputR.setVoltageSimd(filtR.getOutput(), channel);
+                } break;
                 case Modes::rightOnly: {
-                    float inputR = inputForChannel0->getVoltage(channel);
-                    LadderFilter<T>& filtR = filterR[channel];
-                    filtR.run(inputR);
-                    const float outputr = (float)filtR.getOutput();
-                    audioOutputR.setVoltage(outputr, channel);
-                    peak.step(outputr); }
-                    break; 
+                    filtR.run(inputForChannel0->getVoltageSimd<float_4>(channel));
+                    const T outputR = filtR.getOutput();
+                    audioOutputR.setVoltageSimd(outputR, channel);
+                    peakStep(peak, outputR, numChannels, channel);
+                } break;
+                case Modes::normal:
                 case Modes::leftOnly: {
                     filt.run(input);
-                    const float output = (float)filt.getOutput();
-                    audioOutput.setVoltage(output, channel);
-                    peak.step(output); }
-                    break;   
+                    const T output = filt.getOutput();
+                    audioOutput.setVoltageSimd(output, channel);
+                    peakStep(peak, output, numChannels, channel);
+                } break;
                 default:
                     assert(false);
             }
         }
     }
-}
\ No newline at end of file
+}
@@ -9,7 +9,7 @@
 #include "Divider.h"
 #include "IComposite.h"
 #include "MixHelper.h"
-#include "MultiLag.h"
+#include "MultiSmoother.h"
 #include "ObjectCache.h"
 #include "SqMath.h"
 #include "mixpolyhelper.h"
@@ -170,34 +170,33 @@ public:
 
     void stepn(int steps);
 
-    // These are all calculated in stepn from the
-    // contents of filteredCV
-
-    float buf_channelSendGainsALeft[numChannels] = {0};
-    float buf_channelSendGainsARight[numChannels] = {0};
-    float buf_channelSendGainsBLeft[numChannels] = {0};
-    float buf_channelSendGainsBRight[numChannels] = {0};
-
     void _disableAntiPop();
 
 private:
+    static const int divRate = 4;
     Divider divider;
 
     /**
      *      0..3 for smoothed input gain * channel mute
      *      4..7 for left pan
      *      8..11 for right pan
-     *      12..15 for mute
+     *      12..15 for left send A
+     *      16..19 for right send A
+     *      20..23 for left send B
+     *      24..27 for right send B
      */
 
     static const int cvOffsetGain = 0;
     static const int cvOffsetPanLeft = 4;
     static const int cvOffsetPanRight = 8;
-    static const int cvOffsetMute = 12;
-    MultiLPF<16> filteredCV;
+    static const int cvOffsetSendALeft = 12;
+    static const int cvOffsetSendARight = 16;
+    static const int cvOffsetSendBLeft = 20;
+    static const int cvOffsetSendBRight = 24;
+    static const int cvFilterSize = 28;
+    MultiSmoother<cvFilterSize> filteredCV;
 
-    std::shared_ptr<LookupTableParams<float>> panL = ObjectCache<float>::getMixerPanL();
-    std::shared_ptr<LookupTableParams<float>> panR = ObjectCache<float>::getMixerPanR();
+    MixPanLaw4 panLaw;
 
     const float* expansionInputs = nullptr;
     float* expansionOutputs = nullptr;
@@ -210,7 +209,7 @@ private:
 
 template <class TBase>
 inline void Mix4<TBase>::stepn(int div) {
-    float unbufferedCV[cvOffsetMute + 4] = {0};
+    float unbufferedCV[cvFilterSize] = {0};
 
     const bool moduleIsMuted = TBase::params[ALL_CHANNELS_OFF_PARAM].value > .5f;
     const bool AisPreFader = TBase::params[PRE_FADERa_PARAM].value > .5;
@@ -228,6 +227,8 @@ inline void Mix4<TBase>::stepn(int div) {
         }
     }
 
+    float pans[numChannels];
+    float mutes[numChannels];
     for (int i = 0; i < numChannels; ++i) {
         float channelGain = 0;
 
@@ -260,43 +261,13 @@ inline void Mix4<TBase>::stepn(int div) {
 
         // now the raw channel gains are all computed
         unbufferedCV[cvOffsetGain + i] = channelGain;
-        unbufferedCV[cvOffsetMute + i] = rawMuteValue;
+        mutes[i] = rawMuteValue;
 
-        // now do the pan calculation
+        // the pan is done below, for all four channels at once
         {
             const float balance = TBase::params[i + PAN0_PARAM].value;
             const float cv = TBase::inputs[i + PAN0_INPUT].getVoltage(0);
-            const float panValue = std::clamp(balance + cv / 5, -1, 1);
-            unbufferedCV[cvOffsetPanLeft + i] = LookupTable<float>::lookup(*panL, panValue) * channelGain;
-            unbufferedCV[cvOffsetPanRight + i] = LookupTable<float>::lookup(*panR, panValue) * channelGain;
-        }
-
-        // TODO: precalc all the send gains
-        {
-            const float muteValue = filteredCV.get(cvOffsetMute + i);
-            const float sliderA = TBase::params[i + SEND0_PARAM].value;
-            const float sliderB = TBase::params[i + SENDb0_PARAM].value;
-
-            // TODO: we can do some main volume work ahead of time, just like the sends here
-            if (!AisPreFader) {
-                // post faster, gain sees mutes, faders,  pan, and send level
-                buf_channelSendGainsALeft[i] = filteredCV.get(i + cvOffsetPanLeft) * sliderA;
-                buf_channelSendGainsARight[i] = filteredCV.get(i + cvOffsetPanRight) * sliderA;
-            } else {
-                // pre-fader fader, gain sees mutes and send only
-                buf_channelSendGainsALeft[i] = muteValue * sliderA * (1.f / sqrt(2.f));
-                buf_channelSendGainsARight[i] = muteValue * sliderA * (1.f / sqrt(2.f));
-            }
-
-            if (!BisPreFader) {
-                // post faster, gain sees mutes, faders,  pan, and send level
-                buf_channelSendGainsBLeft[i] = filteredCV.get(i + cvOffsetPanLeft) * sliderB;
-                buf_channelSendGainsBRight[i] = filteredCV.get(i + cvOffsetPanRight) * sliderB;
-            } else {
-                // pref fader, gain sees mutes and send only
-                buf_channelSendGainsBLeft[i] = muteValue * sliderB * (1.f / sqrt(2.f));
-                buf_channelSendGainsBRight[i] = muteValue * sliderB * (1.f / sqrt(2.f));
-            }
+            pans[i] = std::clamp(balance + cv / 5, -1, 1);
         }
 
         // refresh the solo lights
@@ -305,13 +276,56 @@ inline void Mix4<TBase>::stepn(int div) {
             TBase::lights[i + SOLO0_LIGHT].value = (soloValue > .5f) ? 10.f : 0.f;
         }
     }
+
+    // The pan taper is only re-calculated when a pan moves.
+    panLaw.update(float_4::load(pans));
+    const float_4 channelGains = float_4::load(unbufferedCV + cvOffsetGain);
+    (panLaw.left * channelGains).store(unbufferedCV + cvOffsetPanLeft);
+    (panLaw.right * channelGains).store(unbufferedCV + cvOffsetPanRight);
+
+    // precalc all the send gains
+    {
+        const float_4 muteValue = float_4::load(mutes);
+        const float_4 sliderA(
+            TBase::params[SEND0_PARAM].value,
+            TBase::params[SEND0_PARAM + 1].value,
+            TBase::params[SEND0_PARAM + 2].value,
+            TBase::params[SEND0_PARAM + 3].value);
+        const float_4 sliderB(
+            TBase::params[SENDb0_PARAM].value,
+            TBase::params[SENDb0_PARAM + 1].value,
+            TBase::params[SENDb0_PARAM + 2].value,
+            TBase::params[SENDb0_PARAM + 3].value);
+
+        if (!AisPreFader) {
+            // post faster, gain sees mutes, faders,  pan, and send level
+            (panLaw.left * channelGains * sliderA).store(unbufferedCV + cvOffsetSendALeft);
+            (panLaw.right * channelGains * sliderA).store(unbufferedCV + cvOffsetSendARight);
+        } else {
+            // pre-fader fader, gain sees mutes and send only
+            float_4 gain = muteValue * sliderA * (1.f / sqrt(2.f));
+            gain.store(unbufferedCV + cvOffsetSendALeft);
+            gain.store(unbufferedCV + cvOffsetSendARight);
+        }
+
+        if (!BisPreFader) {
+            // post faster, gain sees mutes, faders,  pan, and send level
+            (panLaw.left * channelGains * sliderB).store(unbufferedCV + cvOffsetSendBLeft);
+            (panLaw.right * channelGains * sliderB).store(unbufferedCV + cvOffsetSendBRight);
+        } else {
+            // pref fader, gain sees mutes and send only
+            float_4 gain = muteValue * sliderB * (1.f / sqrt(2.f));
+            gain.store(unbufferedCV + cvOffsetSendBLeft);
+            gain.store(unbufferedCV + cvOffsetSendBRight);
+        }
+    }
+
     filteredCV.step(unbufferedCV);
 }
 
 template <class TBase>
 inline void Mix4<TBase>::init() {
-    const int divRate = 4;
-    divider.setup(divRate, [this, divRate] {
+    divider.setup(divRate, [this] {
         this->stepn(divRate);
     });
     setupFilters();
@@ -324,18 +338,19 @@ inline void Mix4<TBase>::onSampleRateChange() {
 
 template <class TBase>
 inline void Mix4<TBase>::_disableAntiPop() {
-    filteredCV.setCutoff(0.49f);  // set it super fast
+    // no lowpass, just the ramp over one control period
+    filteredCV.setTime(0, TBase::engineGetSampleTime(), divRate);
 }
 
 template <class TBase>
 inline void Mix4<TBase>::setupFilters() {
-    const float x = TBase::engineGetSampleTime() * 44100.f / 100.f;
-    filteredCV.setCutoff(x);
+    filteredCV.setTime(mixerSmoothingTime, TBase::engineGetSampleTime(), divRate);
 }
 
 template <class TBase>
 inline void Mix4<TBase>::step() {
     divider.step();
+    filteredCV.tick();
 
     float left = 0, right = 0;  // these variables will be summed up over all channels
     float lSend = 0, rSend = 0;
@@ -350,20 +365,24 @@ inline void Mix4<TBase>::step() {
         rSendb = expansionInputs[5];
     }
 
-    for (int i = 0; i < numChannels; ++i) {
-        const float channelInput = polyHelper.getNormalizedInputSum(this, i);
+    const float_4 channelInput(
+        polyHelper.getNormalizedInputSum(this, 0),
+        polyHelper.getNormalizedInputSum(this, 1),
+        polyHelper.getNormalizedInputSum(this, 2),
+        polyHelper.getNormalizedInputSum(this, 3));
 
-        // sum the channel output to the masters
-        left += channelInput * filteredCV.get(i + cvOffsetPanLeft);
-        right += channelInput * filteredCV.get(i + cvOffsetPanRight);
+    // sum the channel output to the masters
+    left += SimdBlocks::sum(channelInput * filteredCV.get4(cvOffsetPanLeft));
+    right += SimdBlocks::sum(channelInput * filteredCV.get4(cvOffsetPanRight));
 
-        // TODO: aux sends
-        lSend += channelInput * buf_channelSendGainsALeft[i];
-        lSendb += channelInput * buf_channelSendGainsBLeft[i];
-        rSend += channelInput * buf_channelSendGainsARight[i];
-        rSendb += channelInput * buf_channelSendGainsBRight[i];
+    lSend += SimdBlocks::sum(channelInput * filteredCV.get4(cvOffsetSendALeft));
+    lSendb += SimdBlocks::sum(channelInput * filteredCV.get4(cvOffsetSendBLeft));
+    rSend += SimdBlocks::sum(channelInput * filteredCV.get4(cvOffsetSendARight));
+    rSendb += SimdBlocks::sum(channelInput * filteredCV.get4(cvOffsetSendBRight));
 
-        TBase::outputs[i + CHANNEL0_OUTPUT].setVoltage(channelInput * filteredCV.get(i + cvOffsetGain), 0);
+    const float_4 channelOut = channelInput * filteredCV.get4(cvOffsetGain);
+    for (int i = 0; i < numChannels; ++i) {
+        TBase::outputs[i + CHANNEL0_OUTPUT].setVoltage(channelOut[i], 0);
     }
 
     // output the buses to the expansion port
@@ -7,7 +7,8 @@
 
 #include "Divider.h"
 #include "IComposite.h"
-#include "MultiLag.h"
+#include "MixHelper.h"
+#include "MultiSmoother.h"
 #include "ObjectCache.h"
 #include "SqMath.h"
 
@@ -220,30 +221,37 @@ public:
     void stepn(int steps);
 
     const static int numChannels = 8;
+    const static int numBanks = numChannels / 4;
 
-    float buf_inputs[numChannels] = {0};
-    float buf_channelGains[numChannels] = {0};
-    float buf_channelOuts[numChannels] = {0};
-    float buf_leftPanGains[numChannels] = {0};
-    float buf_rightPanGains[numChannels] = {0};
-    float buf_channelSendGains[numChannels] = {0};
-
-    /** 
-     * allocate extra bank for the master mute
+    /**
+     * Everything step() needs, filled in by stepn and smoothed by filteredCV.
+     *      0..7 for slider * level CV * mute
+     *      8..15 for left pan
+     *      16..23 for right pan
+     *      24..31 for left send (pan * send level)
+     *      32..39 for right send
+     *      40 for master volume * master mute
      */
-    float buf_muteInputs[numChannels + 4];
-    float buf_masterGain = 0;
+    static const int cvOffsetGain = 0;
+    static const int cvOffsetPanLeft = 8;
+    static const int cvOffsetPanRight = 16;
+    static const int cvOffsetSendLeft = 24;
+    static const int cvOffsetSendRight = 32;
+    static const int cvOffsetMaster = 40;
+    static const int cvFilterSize = 44;
+
+    float unbufferedCV[cvFilterSize] = {0};
     float buf_auxReturnGain = 0;
 
+    void onSampleRateChange() override;
+
 private:
+    static const int divRate = 4;
     Divider divider;
+    MultiSmoother<cvFilterSize> filteredCV;
+    MixPanLaw4 panLaw[numBanks];
 
-    /**
-     * 8 input channels and one master
-     */
-    MultiLPF<12> antiPop;
-    std::shared_ptr<LookupTableParams<float>> panL = ObjectCache<float>::getMixerPanL();
-    std::shared_ptr<LookupTableParams<float>> panR = ObjectCache<float>::getMixerPanR();
+    void setupFilters();
 };
 
 #ifndef _CLAMP
@@ -276,7 +284,7 @@ static inline float PanR(float balance, float cv)
 
 template <class TBase>
 inline void Mix8<TBase>::stepn(int div) {
-    // fill buf_channelGains
+    float pans[numChannels];
     for (int i = 0; i < numChannels; ++i) {
         const float slider = TBase::params[i + GAIN0_PARAM].value;
 
@@ -286,28 +294,15 @@ inline void Mix8<TBase>::stepn(int div) {
             rawCV / 10.0f,
             0.0f,
             1.0f);
-        buf_channelGains[i] = slider * cv;
-    }
-
-    buf_masterGain = TBase::params[MASTER_VOLUME_PARAM].value;
-    buf_auxReturnGain = TBase::params[RETURN_GAIN_PARAM].value;
-
-    // send gains
-    for (int i = 0; i < numChannels; ++i) {
-        const float slider = TBase::params[i + SEND0_PARAM].value;
-        buf_channelSendGains[i] = slider;
-    }
+        unbufferedCV[cvOffsetGain + i] = slider * cv;
 
-    // fill buf_leftPanGains and buf_rightPanGains
-    for (int i = 0; i < numChannels; ++i) {
         const float balance = TBase::params[i + PAN0_PARAM].value;
-        const float cv = TBase::inputs[i + PAN0_INPUT].getVoltage(0);
-        const float panValue = std::clamp(balance + cv / 5, -1, 1);
-        buf_leftPanGains[i] = LookupTable<float>::lookup(*panL, panValue);
-        buf_rightPanGains[i] = LookupTable<float>::lookup(*panR, panValue);
+        const float panCV = TBase::inputs[i + PAN0_INPUT].getVoltage(0);
+        pans[i] = std::clamp(balance + panCV / 5, -1, 1);
     }
 
-    buf_masterGain = TBase::params[MASTER_VOLUME_PARAM].value;
+    buf_auxReturnGain = TBase::params[RETURN_GAIN_PARAM].value;
+    unbufferedCV[cvOffsetMaster] = TBase::params[MASTER_VOLUME_PARAM].value * (1.0f - TBase::params[MASTER_MUTE_PARAM].value);
 
     bool anySolo = false;
     for (int i = 0; i < numChannels; ++i) {
@@ -317,75 +312,95 @@ inline void Mix8<TBase>::stepn(int div) {
         }
     }
 
-    if (anySolo) {
-        for (int i = 0; i < numChannels; ++i) {
-            buf_muteInputs[i] = TBase::params[i + SOLO0_PARAM].value;
-        }
-    } else {
-        for (int i = 0; i < numChannels; ++i) {
+    for (int i = 0; i < numChannels; ++i) {
+        float muteValue = 0;
+        if (anySolo) {
+            muteValue = TBase::params[i + SOLO0_PARAM].value;
+        } else {
             const bool muteActivated = ((TBase::params[i + MUTE0_PARAM].value > .5f) ||
                                         (TBase::inputs[i + MUTE0_INPUT].getVoltage(0) > 2));
-            buf_muteInputs[i] = muteActivated ? 0.f : 1.f;
-            // buf_muteInputs[i] = 1.0f - TBase::params[i + MUTE0_PARAM].value;       // invert mute
+            muteValue = muteActivated ? 0.f : 1.f;
         }
+        unbufferedCV[cvOffsetGain + i] *= muteValue;
+    }
+
+    // now the pans and sends, four channels at a time
+    for (int bank = 0; bank < numBanks; ++bank) {
+        const int base = bank * 4;
+
+        // the pan taper is only re-calculated when the pan moves
+        MixPanLaw4& law = panLaw[bank];
+        law.update(float_4::load(pans + base));
+        law.left.store(unbufferedCV + cvOffsetPanLeft + base);
+        law.right.store(unbufferedCV + cvOffsetPanRight + base);
+
+        const float_4 send(
+            TBase::params[base + SEND0_PARAM].value,
+            TBase::params[base + SEND0_PARAM + 1].value,
+            TBase::params[base + SEND0_PARAM + 2].value,
+            TBase::params[base + SEND0_PARAM + 3].value);
+        (law.left * send).store(unbufferedCV + cvOffsetSendLeft + base);
+        (law.right * send).store(unbufferedCV + cvOffsetSendRight + base);
     }
-    buf_muteInputs[8] = 1.0f - TBase::params[MASTER_MUTE_PARAM].value;
-    antiPop.step(buf_muteInputs);
+
+    filteredCV.step(unbufferedCV);
 }
 
 template <class TBase>
 inline void Mix8<TBase>::init() {
-    const int divRate = 4;
-    divider.setup(divRate, [this, divRate] {
+    divider.setup(divRate, [this] {
         this->stepn(divRate);
     });
+    setupFilters();
+}
 
-    // 400 was smooth, 100 popped
-    antiPop.setCutoff(1.0f / 100.f);
+template <class TBase>
+inline void Mix8<TBase>::onSampleRateChange() {
+    setupFilters();
+}
+
+template <class TBase>
+inline void Mix8<TBase>::setupFilters() {
+    filteredCV.setTime(mixerSmoothingTime, TBase::engineGetSampleTime(), divRate);
 }
 
 template <class TBase>
 inline void Mix8<TBase>::step() {
     divider.step();
-
-    // fill buf_inputs
-    for (int i = 0; i < numChannels; ++i) {
-        buf_inputs[i] = TBase::inputs[i + AUDIO0_INPUT].getVoltage(0);
-    }
-
-    // compute buf_channelOuts
-    for (int i = 0; i < numChannels; ++i) {
-        const float muteValue = antiPop.get(i);
-        buf_channelOuts[i] = buf_inputs[i] * buf_channelGains[i] * muteValue;
-    }
-
-    // compute and output master outputs
-    float left = 0, right = 0;
-    float lSend = 0, rSend = 0;
-    for (int i = 0; i < numChannels; ++i) {
-        left += buf_channelOuts[i] * buf_leftPanGains[i];
-        right += buf_channelOuts[i] * buf_rightPanGains[i];
-
-        lSend += buf_channelOuts[i] * buf_leftPanGains[i] * buf_channelSendGains[i];
-        rSend += buf_channelOuts[i] * buf_rightPanGains[i] * buf_channelSendGains[i];
+    filteredCV.tick();
+
+    float_4 left = 0, right = 0;
+    float_4 lSend = 0, rSend = 0;
+    for (int bank = 0; bank < numBanks; ++bank) {
+        const int base = bank * 4;
+        const float_4 input(
+            TBase::inputs[base + AUDIO0_INPUT].getVoltage(0),
+            TBase::inputs[base + AUDIO0_INPUT + 1].getVoltage(0),
+            TBase::inputs[base + AUDIO0_INPUT + 2].getVoltage(0),
+            TBase::inputs[base + AUDIO0_INPUT + 3].getVoltage(0));
+
+        const float_4 channelOut = input * filteredCV.get4(cvOffsetGain + base);
+        left += channelOut * filteredCV.get4(cvOffsetPanLeft + base);
+        right += channelOut * filteredCV.get4(cvOffsetPanRight + base);
+        lSend += channelOut * filteredCV.get4(cvOffsetSendLeft + base);
+        rSend += channelOut * filteredCV.get4(cvOffsetSendRight + base);
+
+        // output channel outputs
+        for (int i = 0; i < 4; ++i) {
+            TBase::outputs[base + i + CHANNEL0_OUTPUT].setVoltage(channelOut[i], 0);
+        }
     }
 
-    left += TBase::inputs[LEFT_RETURN_INPUT].getVoltage(0) * buf_auxReturnGain;
-    right += TBase::inputs[RIGHT_RETURN_INPUT].getVoltage(0) * buf_auxReturnGain;
+    const float leftSum = SimdBlocks::sum(left) + TBase::inputs[LEFT_RETURN_INPUT].getVoltage(0) * buf_auxReturnGain;
+    const float rightSum = SimdBlocks::sum(right) + TBase::inputs[RIGHT_RETURN_INPUT].getVoltage(0) * buf_auxReturnGain;
 
     // output the masters
-    const float masterMuteValue = antiPop.get(8);
-    const float masterGain = buf_masterGain * masterMuteValue;
-    TBase::outputs[LEFT_OUTPUT].setVoltage(left * masterGain + TBase::inputs[LEFT_EXPAND_INPUT].getVoltage(0), 0);
-    TBase::outputs[RIGHT_OUTPUT].setVoltage(right * masterGain + TBase::inputs[RIGHT_EXPAND_INPUT].getVoltage(0), 0);
-
-    TBase::outputs[LEFT_SEND_OUTPUT].setVoltage(lSend, 0);
-    TBase::outputs[RIGHT_SEND_OUTPUT].setVoltage(rSend, 0);
+    const float masterGain = filteredCV.get(cvOffsetMaster);
+    TBase::outputs[LEFT_OUTPUT].setVoltage(leftSum * masterGain + TBase::inputs[LEFT_EXPAND_INPUT].getVoltage(0), 0);
+    TBase::outputs[RIGHT_OUTPUT].setVoltage(rightSum * masterGain + TBase::inputs[RIGHT_EXPAND_INPUT].getVoltage(0), 0);
 
-    // output channel outputs
-    for (int i = 0; i < numChannels; ++i) {
-        TBase::outputs[i + CHANNEL0_OUTPUT].setVoltage(buf_channelOuts[i], 0);
-    }
+    TBase::outputs[LEFT_SEND_OUTPUT].setVoltage(SimdBlocks::sum(lSend), 0);
+    TBase::outputs[RIGHT_SEND_OUTPUT].setVoltage(SimdBlocks::sum(rSend), 0);
 }
 
 template <class TBase>
@@ -1,9 +1,17 @@
 #pragma once
 
 #include "GateTrigger.h"
+#include "SimdBlocks.h"
 
 #define _CHAUDIOTAPER  // not needed any more?
 
+/**
+ * Time constant, in seconds, of the MultiSmoother that all the mixers use on
+ * their gains, pans and mutes. This is the same as the control rate lowpass
+ * they used to have (1/100 of 44.1k / 4), which was just long enough not to pop.
+ */
+static const float mixerSmoothingTime = 1.f / (2 * 3.14159265f * 110.25f);
+
 /**
  * Does all of the mute and mute CD processing for mixers
  * 
@@ -123,3 +131,41 @@ inline void MixHelper<TMixComposite>::procOneMute(
     mixer->params[muteStateParam].value = muted ? 1.f : 0.f;
     mixer->lights[light].value = muted ? 10.f : 0.f;
 }
+
+/**
+ * The constant power pan law for four mixer channels at once.
+ * As pan goes from -1 to 1 the angle goes from 0 to pi / 2, and
+ * left = cos(angle), right = sin(angle).
+ *
+ * Remembers the pan it was last given, and only evaluates the
+ * taper when one of the channels moves.
+ */
+class MixPanLaw4 {
+public:
+    /**
+     * @param pan is -1..1 for each channel.
+     * returns true if the gains changed.
+     */
+    bool update(float_4 pan);
+
+    float_4 left = 0;
+    float_4 right = 0;
+
+private:
+    // no real pan is this far out, so the first update always evaluates
+    float_4 lastPan = 100;
+};
+
+inline bool MixPanLaw4::update(float_4 pan) {
+    if (!rack::simd::movemask(pan != lastPan)) {
+        return false;
+    }
+    lastPan = pan;
+
+    // sinPhase takes phase in cycles, so the angle is (pan + 1) / 8 of a cycle
+    const float_4 phase = (pan + 1) * .125f;
+    right = SimdBlocks::sinPhase(phase);
+    left = SimdBlocks::sinPhase(phase + .25f);
+    return true;
+}
+
@@ -9,7 +9,7 @@
 #include "Divider.h"
 #include "IComposite.h"
 #include "MixHelper.h"
-#include "MultiLag.h"
+#include "MultiSmoother.h"
 #include "ObjectCache.h"
 #include "SqMath.h"
 
@@ -144,13 +144,6 @@ public:
 
     void stepn(int steps);
 
-    // These are all calculated in stepn from the
-    // contents of filteredCV
-
-    // TODO: this should be numGroups
-    float buf_channelSendGainA[numChannels] = {0};
-    float buf_channelSendGainB[numChannels] = {0};
-
     // TODO: reduce this number to what we actually need
 
     /**
@@ -160,16 +153,18 @@ public:
      *      4..5 for right pan
      *      6..7 for mute
      * 
-     * New idea
-     *      0..1 for smoothed input gain * channel mute
-     *      2..5 gain * balance (per channel)
-     *      6..7 mute
+     * New idea, one for each channel so step() can do them four at a time
+     *      0..3 gain * balance
+     *      4..7 group gain (so 4 and 5 are the same)
+     *      8..11 send A
+     *      12..15 send B
      */
 
-    static const int cvOffsetGain = 0;
-    static const int cvOffsetGainBalance = 2;
-    static const int cvOffsetMute = 6;
-    static const int cvFilterSize = 8;
+    static const int cvOffsetGainBalance = 0;
+    static const int cvOffsetGain = 4;
+    static const int cvOffsetSendA = 8;
+    static const int cvOffsetSendB = 12;
+    static const int cvFilterSize = 16;
 
     // This is where we build up all the inputs to the CV filter
     float unbufferedCV[cvFilterSize] = {0};
@@ -181,9 +176,10 @@ public:
     void _disableAntiPop();
 
 private:
+    static const int divRate = 4;
     Divider divider;
 
-    MultiLPF<cvFilterSize> filteredCV;
+    MultiSmoother<cvFilterSize> filteredCV;
 
     // std::shared_ptr<LookupTableParams<float>> panL = ObjectCache<float>::getMixerPanL();
     // std::shared_ptr<LookupTableParams<float>> panR = ObjectCache<float>::getMixerPanR();
@@ -257,10 +253,8 @@ inline void MixStereo<TBase>::stepn(int div) {
 
         // now the raw channel gains are all computed
         // TODO: split this out into a separate function, only needs to be done on groups
-        assert(cvOffsetGain + group < cvFilterSize);
-        assert(cvOffsetMute + group < cvFilterSize);
-        unbufferedCV[cvOffsetGain + group] = groupGain;
-        unbufferedCV[cvOffsetMute + group] = rawMuteValue;
+        unbufferedCV[cvOffsetGain + group * 2] = groupGain;
+        unbufferedCV[cvOffsetGain + group * 2 + 1] = groupGain;
 
         // now do the pan calculation
         {
@@ -282,30 +276,27 @@ inline void MixStereo<TBase>::stepn(int div) {
             assert(group + SEND0_PARAM < NUM_PARAMS);
             assert(group + SENDb0_PARAM < NUM_PARAMS);
 
-            const float muteValue = filteredCV.get(cvOffsetMute + group);
             const float sliderA = TBase::params[group + SEND0_PARAM].value;
             const float sliderB = TBase::params[group + SENDb0_PARAM].value;
 
             const float panAttenuation = .5f;  // 6db pan law
 
-            // TODO: we can do some main volume work ahead of time, just like the sends here
-            if (!AisPreFader) {
-                // post faster, gain sees mutes, faders,  pan, and send level
-                buf_channelSendGainA[group * 2] = filteredCV.get(group * 2 + cvOffsetGainBalance) * sliderA;
-                buf_channelSendGainA[group * 2 + 1] = filteredCV.get(group * 2 + 1 + cvOffsetGainBalance) * sliderA;
-            } else {
-                // pre-fader fader, gain sees mutes and send only
-                buf_channelSendGainA[group * 2] = muteValue * sliderA * panAttenuation;
-                buf_channelSendGainA[group * 2 + 1] = muteValue * sliderA * panAttenuation;
-            }
-
-            if (!BisPreFader) {
-                // post faster, gain sees mutes, faders,  pan, and send level
-                buf_channelSendGainB[group * 2] = filteredCV.get(group * 2 + cvOffsetGainBalance) * sliderB;
-                buf_channelSendGainB[group * 2 + 1] = filteredCV.get(group * 2 + 1 + cvOffsetGainBalance) * sliderB;
-            } else {
-                buf_channelSendGainB[group * 2] = muteValue * sliderB * panAttenuation;
-                buf_channelSendGainB[group * 2 + 1] = muteValue * sliderB * panAttenuation;
+            for (int channel = group * 2; channel < group * 2 + 2; ++channel) {
+                const float gainBalance = unbufferedCV[cvOffsetGainBalance + channel];
+                if (!AisPreFader) {
+                    // post faster, gain sees mutes, faders,  pan, and send level
+                    unbufferedCV[cvOffsetSendA + channel] = gainBalance * sliderA;
+                } else {
+                    // pre-fader fader, gain sees mutes and send only
+                    unbufferedCV[cvOffsetSendA + channel] = rawMuteValue * sliderA * panAttenuation;
+                }
+
+                if (!BisPreFader) {
+                    // post faster, gain sees mutes, faders,  pan, and send level
+                    unbufferedCV[cvOffsetSendB + channel] = gainBalance * sliderB;
+                } else {
+                    unbufferedCV[cvOffsetSendB + channel] = rawMuteValue * sliderB * panAttenuation;
+                }
             }
         }
 
@@ -331,8 +322,7 @@ inline void MixStereo<TBase>::stepn(int div) {
 
 template <class TBase>
 inline void MixStereo<TBase>::init() {
-    const int divRate = 4;
-    divider.setup(divRate, [this, divRate] {
+    divider.setup(divRate, [this] {
         this->stepn(divRate);
     });
     setupFilters();
@@ -345,19 +335,19 @@ inline void MixStereo<TBase>::onSampleRateChange() {
 
 template <class TBase>
 inline void MixStereo<TBase>::setupFilters() {
-    // 400 was smooth, 100 popped
-    const float x = TBase::engineGetSampleTime() * 44100.f / 100.f;
-    filteredCV.setCutoff(x);
+    filteredCV.setTime(mixerSmoothingTime, TBase::engineGetSampleTime(), divRate);
 }
 
 template <class TBase>
 inline void MixStereo<TBase>::_disableAntiPop() {
-    filteredCV.setCutoff(0.49f);  // set it super fast
+    // no lowpass, just the ramp over one control period
+    filteredCV.setTime(0, TBase::engineGetSampleTime(), divRate);
 }
 
 template <class TBase>
 inline void MixStereo<TBase>::step() {
     divider.step();
+    filteredCV.tick();
 
     float left = 0, right = 0;  // these variables will be summed up over all channels
     float lSendA = 0, rSendA = 0;
@@ -372,43 +362,41 @@ inline void MixStereo<TBase>::step() {
         rSendB = expansionInputs[5];
     }
 
+    float inputs[numChannels];
     for (int channel = 0; channel < numChannels; ++channel) {
-        const int group = channel / 2;
-        const bool isLeft = !(channel & 1);
-
         int inputChannel = channel;
 #ifdef _NN
-        if (!isLeft && groupIsMono[group]) {
+        const bool isLeft = !(channel & 1);
+        if (!isLeft && groupIsMono[channel / 2]) {
             inputChannel--;
         }
 #endif
         assert(channel + AUDIO0_INPUT < NUM_INPUTS);
-        const float channelInput = TBase::inputs[inputChannel + AUDIO0_INPUT].getVoltage(0);
-
-        if (isLeft) {
-            left += channelInput * filteredCV.get(channel + cvOffsetGainBalance);
-            lSendA += channelInput * buf_channelSendGainA[channel];
-            lSendB += channelInput * buf_channelSendGainB[channel];
-        } else {
-            right += channelInput * filteredCV.get(channel + cvOffsetGainBalance);
-            rSendA += channelInput * buf_channelSendGainA[channel];
-            rSendB += channelInput * buf_channelSendGainB[channel];
-        }
-
-        // now calculate and output the channel outs
-        // TODO: clean this up
-        assert(channel + CHANNEL0_OUTPUT < NUM_OUTPUTS);
+        inputs[channel] = TBase::inputs[inputChannel + AUDIO0_INPUT].getVoltage(0);
+    }
+    const float_4 channelInput = float_4::load(inputs);
+
+    // the even lanes are left, the odd ones right
+    const float_4 panned = channelInput * filteredCV.get4(cvOffsetGainBalance);
+    const float_4 sendA = channelInput * filteredCV.get4(cvOffsetSendA);
+    const float_4 sendB = channelInput * filteredCV.get4(cvOffsetSendB);
+    left += panned[0] + panned[2];
+    right += panned[1] + panned[3];
+    lSendA += sendA[0] + sendA[2];
+    rSendA += sendA[1] + sendA[3];
+    lSendB += sendB[0] + sendB[2];
+    rSendB += sendB[1] + sendB[3];
+
+    // now output the channel outs
 #ifdef _NN
-        float channelOutput = 0;
-        if (groupIsMono[group] || true) {  // mod for artem - pan all the time
-            channelOutput = channelInput * filteredCV.get(channel + cvOffsetGainBalance);
-        } else {
-            channelOutput = channelInput * filteredCV.get(group + cvOffsetGain);
-        }
-        TBase::outputs[channel + CHANNEL0_OUTPUT].setVoltage(channelOutput, 0);
+    // mod for artem - pan all the time
+    const float_4 channelOutput = panned;
 #else
-        TBase::outputs[channel + CHANNEL0_OUTPUT].value = channelInput * filteredCV.get(group + cvOffsetGain);
+    const float_4 channelOutput = channelInput * filteredCV.get4(cvOffsetGain);
 #endif
+    for (int channel = 0; channel < numChannels; ++channel) {
+        assert(channel + CHANNEL0_OUTPUT < NUM_OUTPUTS);
+        TBase::outputs[channel + CHANNEL0_OUTPUT].setVoltage(channelOutput[channel], 0);
     }
 
     // output the buses to the expansion port
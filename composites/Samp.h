@@ -4,11 +4,13 @@
 #include <assert.h>
 
 #include <memory>
+#include <vector>
 
 #include "CompiledInstrument.h"
 #include "Divider.h"
 #include "GateDelay.h"
 #include "IComposite.h"
+#include "InstrumentCache.h"
 #include "InstrumentInfo.h"
 #include "LookupTable.h"
 #include "ManagedPool.h"
@@ -64,12 +66,31 @@ public:
 
     /**
      * Used in both directions.
-     * plugin->server: these are the old values to be disposed of by server.
+     * plugin->server: the patch we are playing now. The server holds on to it until
+     *          we are done with it, and then disposes of it.
      * server->plugin: new values from parsed and loaded patch.
      */
     CompiledInstrumentPtr instrument;
     WaveLoaderPtr waves;
 
+    /**
+     * plugin->server: if true, only the start of each sample
+     * is loaded, and the rest is streamed from disk as it plays.
+     */
+    bool streamSamples = false;
+
+    /**
+     * plugin->server: if true, compiled instruments are kept in the
+     * InstrumentCache, and decoded samples in the SampleDiskCache.
+     */
+    bool useDiskCache = false;
+
+    /**
+     * plugin->server: don't load anything, just delete the old patches
+     * we have said we are done with.
+     */
+    bool retireOnly = false;
+
     /**
      * A thread safe way to communicate
      * with the other threads
@@ -113,6 +134,10 @@ public:
     }
 
     virtual ~Samp() {
+#ifdef _ATOM
+        // Audio thread isn't running any more, so the server may delete anything it's holding.
+        sharedState->au_grantSampleReloadRequest(~0u);
+#endif
         thread.reset();  // kill the threads before deleting other things
     }
 
@@ -135,6 +160,8 @@ public:
         SCHEMA_PARAM,
         TRIGGERDELAY_PARAM,
         OCTAVE_PARAM,
+        STREAMING_PARAM,
+        DISKCACHE_PARAM,
         NUM_PARAMS
     };
 
@@ -219,7 +246,7 @@ private:
     SqSchmittTrigger trig[4];
 
     // here we hold onto a reference to these so we can give it back
-    // Actually, I think we reference some of these - should consider updating...
+    // with the next patch request.
     WaveLoaderPtr gcWaveLoader;
     CompiledInstrumentPtr gcInstrument;
 
@@ -255,13 +282,29 @@ private:
 
     int lastServicedKeyswitchValue = {-1};
 
+    /**
+     * Counts the patches that have come back from the server.
+     * The server won't delete the patch that each one replaced until we
+     * grant that generation.
+     */
+    unsigned patchGeneration = 0;
+    unsigned grantedGeneration = 0;
+
+    /**
+     * After a new patch comes in, how much longer (in step_n calls) voices
+     * may keep playing the old samples.
+     */
+    int retiredSamplesCountdown_n = 0;
+    static const int retiredSamplesTimeout_n = 44100 / 32;  // about a second
+
     bool lastGate = false;  // just for test now
 
     /**
-     * Messages moved between thread, messagePool, and crossFader
-     * as new noise slopes are requested in response to CV/knob changes.
+     * Messages moved between thread and messagePool as new patches are requested.
+     * Only one, so that only one patch is loading at a time. That way the patch we send
+     * in the request is always the one that the new patch replaces.
      */
-    ManagedPool<SampMessage, 2> messagePool;
+    ManagedPool<SampMessage, 1> messagePool;
 
     void step_n();
 
@@ -466,14 +509,41 @@ inline float Samp<TBase>::_getTranspose(int voice) const {
     return playback[bank]._transAmt(subChannel);
 }
 
+/**
+ * The server is holding on to the samples from before the last new patch,
+ * since some voices may still be playing them. Let it have them once nothing
+ * is playing them, or they have played long enough.
+ */
 template <class TBase>
 inline void Samp<TBase>::serviceSampleReloadRequest() {
 #ifdef _ATOM
-    if (sharedState->au_isSampleReloadRequested()) {
+    if (!sharedState->au_isSampleReloadRequested() || (grantedGeneration == patchGeneration)) {
+        return;
+    }
+    if (retiredSamplesCountdown_n > 0) {
+        --retiredSamplesCountdown_n;
         for (int i = 0; i < 4; ++i) {
-            playback[i].clearSamples();
+            if (playback[i].isPlayingRetiredSamples()) {
+                return;
+            }
+        }
+    }
+    for (int i = 0; i < 4; ++i) {
+        playback[i].clearRetiredSamples();
+    }
+    grantedGeneration = patchGeneration;
+    sharedState->au_grantSampleReloadRequest(grantedGeneration);
+
+    // Tell the server, so it can delete them now. If our message is out,
+    // a patch is loading, and the server will do it when it gets that.
+    if (!messagePool.empty()) {
+        SampMessage* msg = messagePool.pop();
+        msg->sharedState = sharedState;
+        msg->retireOnly = true;
+        if (!thread->sendMessage(msg)) {
+            msg->retireOnly = false;
+            messagePool.push(msg);
         }
-        sharedState->au_grantSampleReloadRequest();
     }
 #endif
 }
@@ -675,6 +745,12 @@ inline IComposite::Config SampDescription<TBase>::getParamValue(int i) {
         case Samp<TBase>::OCTAVE_PARAM:
             ret = {0, 10, 4, "Octave"};
             break;
+        case Samp<TBase>::STREAMING_PARAM:
+            ret = {0, 1, 0, "Stream samples from disk"};
+            break;
+        case Samp<TBase>::DISKCACHE_PARAM:
+            ret = {0, 1, 0, "Cache instruments and samples on disk"};
+            break;
         default:
             assert(false);
     }
@@ -695,37 +771,99 @@ public:
         // trivailly down-cast to the particular message type
         assert(msg->type == ThreadMessage::Type::SAMP);
         SampMessage* smsg = static_cast<SampMessage*>(msg);
-
-#ifdef _ATOM
-        //SQINFO("worker about to wait for sample access");
         assert(smsg->sharedState);
-        smsg->sharedState->uiw_requestAndWaitForSampleReload();
-        //SQINFO("worker got sample access");
-#endif
+        SamplerSharedStatePtr sharedState = smsg->sharedState;
+
+        // Delete anything the audio thread is done with. It lets us know it's done
+        // by sending a retireOnly message, so we never have to wait for it here.
+        freeRetiredPatches(*sharedState);
+        if (smsg->retireOnly) {
+            sendMessageToClient(msg);
+            return;
+        }
 
-        // First thing we do it throw away the old patch data.
-        // We couldn't do that on the audio thread, since mem allocation will block the thread
-        smsg->waves.reset();
-        smsg->instrument.reset();
+        // The audio thread keeps playing the old patch until we send it the new one.
+        // Take it out of the message, so we can delete it when the audio thread is done with it.
+        // (We couldn't do that on the audio thread, since mem allocation will block the thread).
+        CompiledInstrumentPtr oldInstrument = std::move(smsg->instrument);
+        WaveLoaderPtr oldWaves = std::move(smsg->waves);
 
+        loadPatch(smsg);
+
+        sendMessageToClient(msg);
+        retirePatch(*sharedState, std::move(oldInstrument), std::move(oldWaves));
+    }
+
+private:
+    FilePath samplePath;
+    //  std::string fullPath;
+    //  std::string globalPath;
+    FilePath fullPath;  // what gets passed in
+
+    /**
+     * Counts the patches we send back, the same way Samp does.
+     */
+    unsigned patchGeneration = 0;
+
+    /**
+     * Old patches the audio thread may still be playing.
+     */
+    std::vector<CompiledInstrumentPtr> retiredInstruments;
+    std::vector<WaveLoaderPtr> retiredWaves;
+
+    /**
+     * Hang on to the patch that the one we just sent replaced, and ask
+     * the audio thread to tell us when it's done with it.
+     */
+    void retirePatch(SamplerSharedState& sharedState, CompiledInstrumentPtr oldInstrument, WaveLoaderPtr oldWaves) {
+        ++patchGeneration;
+        if (oldInstrument) {
+            retiredInstruments.push_back(oldInstrument);
+        }
+        if (oldWaves) {
+            retiredWaves.push_back(oldWaves);
+        }
+        if (retiredInstruments.empty() && retiredWaves.empty()) {
+            return;
+        }
+        sharedState.uiw_requestSampleReload(patchGeneration);
+    }
+
+    void freeRetiredPatches(const SamplerSharedState& sharedState) {
+        if (sharedState.uiw_isSampleReloadGranted(patchGeneration)) {
+            retiredInstruments.clear();
+            retiredWaves.clear();
+        }
+    }
+
+    void loadPatch(SampMessage* smsg) {
         parsePath(smsg);
 
-        SInstrumentPtr inst = std::make_shared<SInstrument>();
+        // If we compiled this instrument before, and it hasn't changed, use that.
+        CompiledInstrumentPtr cinst = smsg->useDiskCache ? InstrumentCache::get().find(fullPath) : nullptr;
+        if (!cinst) {
+            SInstrumentPtr inst = std::make_shared<SInstrument>();
 
-        // now load it, and then return it.
-        auto err = SParse::goFile(fullPath, inst);
+            // now load it, and then return it.
+            std::vector<FilePath> includedFiles;
+            auto err = SParse::goFile(fullPath, inst, &includedFiles);
 
-        SamplerErrorContext errc;
-        CompiledInstrumentPtr cinst = err.empty() ? CompiledInstrument::make(errc, inst) : CompiledInstrument::make(err);
-        errc.dump();
+            SamplerErrorContext errc;
+            cinst = err.empty() ? CompiledInstrument::make(errc, inst) : CompiledInstrument::make(err);
+            errc.dump();
+            if (cinst && !cinst->isInError() && smsg->useDiskCache) {
+                InstrumentCache::get().store(fullPath, includedFiles, *cinst);
+            }
+        }
         if (!cinst) {
             //SQWARN("comp was null (should never happen)");
-            sendMessageToClient(msg);
             return;
         }
 
         WaveLoader::LoaderState loadedState = WaveLoader::LoaderState::Error;
         WaveLoaderPtr waves = std::make_shared<WaveLoader>();
+        waves->setStreaming(smsg->streamSamples);
+        waves->setUseDiskCache(smsg->useDiskCache);
         if (!cinst->isInError()) {
 
             assert(cinst->getInfo());
@@ -771,15 +909,8 @@ public:
         }
 
         //SQINFO("****** loader thread returning %d", int(loadedState));
-        sendMessageToClient(msg);
     }
 
-private:
-    FilePath samplePath;
-    //  std::string fullPath;
-    //  std::string globalPath;
-    FilePath fullPath;  // what gets passed in
-
     /** parse out the original file location and other info
      * to find the path to the folder containing the samples.
      * this path will then be used to locate all samples.
@@ -828,10 +959,7 @@ void Samp<TBase>::servicePendingPatchRequest() {
     }
 
     if (messagePool.empty()) {
-        //SQWARN("enable to request new patch will del");
-        auto value = patchRequestFromUI.exchange(nullptr);
-        delete value;
-        //patchRequest.clear();
+        // still loading the last one. We will send this one when it's done.
         return;
     }
 
@@ -842,24 +970,18 @@ void Samp<TBase>::servicePendingPatchRequest() {
     msg->sharedState = sharedState;
 #endif
     msg->pathToSfz = patchRequestFromUI;
+    msg->retireOnly = false;
+    msg->streamSamples = TBase::params[STREAMING_PARAM].value > .5;
+    msg->useDiskCache = TBase::params[DISKCACHE_PARAM].value > .5;
+    // Keep playing the current patch while the new one loads. The server
+    // will hold on to it, so it's never deleted on the audio thread.
     msg->instrument = this->gcInstrument;
     msg->waves = this->gcWaveLoader;
 
-    // Now that we have put together our patch request,
-    // and memory deletion request, we can let go
-    // of shared resources that we hold.
-
-    // we have passed ownership from Samp to message. So clear
+    // we have passed ownership of the path string from Samp to message. So clear
     // out the value in Samp, but don't delete it
     patchRequestFromUI.exchange(nullptr);
 
-    gcInstrument.reset();
-    gcWaveLoader.reset();
-    for (int i = 0; i < 4; ++i) {
-        playback[i].setPatch(nullptr);
-        playback[i].setLoader(nullptr);
-    }
-
     bool sent = thread->sendMessage(msg);
     if (sent) {
     } else {
@@ -876,7 +998,14 @@ void Samp<TBase>::serviceMessagesReturnedToComposite() {
         //SQINFO("new patch message back from worker thread!");
         assert(newMsg->type == ThreadMessage::Type::SAMP);
         SampMessage* smsg = static_cast<SampMessage*>(newMsg);
+        if (smsg->retireOnly) {
+            smsg->retireOnly = false;
+            messagePool.push(smsg);
+            return;
+        }
         setNewPatch(smsg);
+        ++patchGeneration;
+        retiredSamplesCountdown_n = retiredSamplesTimeout_n;
         //SQINFO("new patch message back from worker thread done!");
         messagePool.push(smsg);
         //SQINFO("leave snpm");
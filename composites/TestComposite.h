@@ -228,11 +228,20 @@ public:
     std::vector<Light> lights;
 
     float engineGetSampleTime() {
-        return 1.0f / 44100.0f;
+        return 1.0f / sampleRate;
     }
 
     float engineGetSampleRate() {
-        return 44100.f;
+        return sampleRate;
+    }
+
+    /**
+     * Unit tests run at 44.1k unless they ask for something else.
+     * Calls onSampleRateChange(), like VCV does.
+     */
+    void engineSetSampleRate(float rate) {
+        sampleRate = rate;
+        onSampleRateChange();
     }
 
     virtual void step() {
@@ -242,4 +251,7 @@ public:
     }
     virtual void onSampleRateChange() {
     }
+
+private:
+    float sampleRate = 44100.f;
 };
@@ -155,6 +155,18 @@ inline T& BiquadParams<T, N>::A2(int stage)
     return _taps[stage * 5 + 4];
 }
 
+/**
+ * Only for simd T: sets one lane of every tap.
+ */
+template <typename T, int N>
+inline void BiquadParams<T, N>::setFromScalar(int index, const BiquadParams<float, N>& scalarParams)
+{
+    assert(index >= 0 && index < 4);
+    for (int i = 0; i < N * 5; ++i) {
+        _taps[i][index] = scalarParams.getAtIndex(i);
+    }
+}
+
 template <typename T, int N>
 inline T BiquadParams<T, N>::getAtIndex(int index) const
 {
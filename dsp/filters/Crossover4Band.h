@@ -0,0 +1,149 @@
+#pragma once
+
+#include <assert.h>
+#include <cmath>
+
+#include "BiquadFilter.h"
+#include "BiquadParams.h"
+#include "BiquadState.h"
+#include "simd.h"
+
+/**
+ * The filter coefficients for Crossover4Band. Since they only depend on the
+ * frequencies, one of these can be shared by any number of crossovers.
+ *
+ * It's a tree: first split at the mid frequency into (low, low, high, high),
+ * then split each half again (low, mid-low, mid-high, high). Each half then
+ * goes through the allpass of the other half's crossover, so the four bands
+ * sum to a flat allpass of the input. Every stage is one float_4 biquad,
+ * so the whole thing is five simd biquad sections.
+ *
+ * An LR4 is two identical two pole butterworths in series.
+ *
+ * setFrequencies does not allocate memory, so it may be called from the audio thread.
+ */
+class Crossover4BandParams {
+public:
+    /**
+     * All normalized (fc / sample rate), and must be increasing.
+     */
+    void setFrequencies(float low, float mid, float high);
+
+    BiquadParams<float_4, 2> splitParams;
+    BiquadParams<float_4, 2> bandParams;
+    BiquadParams<float_4, 1> allpassParams;
+
+    /**
+     * Same as ButterworthFilterDesigner::designTwoPoleLowpass / Highpass,
+     * worked out directly (bilinear transform, with prewarping).
+     */
+    static void designButterworth(BiquadParams<float, 1>& params, float fc, bool highpass);
+
+private:
+    static void designLR4(BiquadParams<float, 2>& params, float fc, bool highpass);
+    static void designAllpass(BiquadParams<float, 1>& params, float fc);
+};
+
+/**
+ * Splits one signal into four bands with 4th order Linkwitz-Riley crossovers.
+ * All four bands come out together in one float_4, lowest band in lane 0,
+ * so they can go right into the four lanes of a Cmprsr.
+ *
+ * Only holds the filter state, the coefficients come from a Crossover4BandParams.
+ */
+class Crossover4Band {
+public:
+    float_4 step(float input, const Crossover4BandParams& params);
+
+    /**
+     * Forget the past input, as if it had been silent.
+     */
+    void clear();
+
+private:
+    BiquadState<float_4, 2> splitState;
+    BiquadState<float_4, 2> bandState;
+    BiquadState<float_4, 1> allpassState;
+};
+
+inline float_4 Crossover4Band::step(float input, const Crossover4BandParams& params) {
+    float_4 x = BiquadFilter<float_4>::run(float_4(input), splitState, params.splitParams);
+    x = BiquadFilter<float_4>::run(x, bandState, params.bandParams);
+    return BiquadFilter<float_4>::run(x, allpassState, params.allpassParams);
+}
+
+inline void Crossover4Band::clear() {
+    for (int stage = 0; stage < 2; ++stage) {
+        splitState.z0(stage) = 0;
+        splitState.z1(stage) = 0;
+        bandState.z0(stage) = 0;
+        bandState.z1(stage) = 0;
+    }
+    allpassState.z0(0) = 0;
+    allpassState.z1(0) = 0;
+}
+
+inline void Crossover4BandParams::setFrequencies(float low, float mid, float high) {
+    assert(low > 0 && low < mid && mid < high && high < .5f);
+
+    BiquadParams<float, 2> lp;
+    BiquadParams<float, 2> hp;
+    designLR4(lp, mid, false);
+    designLR4(hp, mid, true);
+    splitParams.setFromScalar(0, lp);
+    splitParams.setFromScalar(1, lp);
+    splitParams.setFromScalar(2, hp);
+    splitParams.setFromScalar(3, hp);
+
+    designLR4(lp, low, false);
+    designLR4(hp, low, true);
+    bandParams.setFromScalar(0, lp);
+    bandParams.setFromScalar(1, hp);
+    designLR4(lp, high, false);
+    designLR4(hp, high, true);
+    bandParams.setFromScalar(2, lp);
+    bandParams.setFromScalar(3, hp);
+
+    BiquadParams<float, 1> ap;
+    designAllpass(ap, high);
+    allpassParams.setFromScalar(0, ap);
+    allpassParams.setFromScalar(1, ap);
+    designAllpass(ap, low);
+    allpassParams.setFromScalar(2, ap);
+    allpassParams.setFromScalar(3, ap);
+}
+
+/**
+ * (our A1 and A2 have the opposite sign from the usual a1, a2).
+ */
+inline void Crossover4BandParams::designButterworth(BiquadParams<float, 1>& params, float fc, bool highpass) {
+    const double k = std::tan(3.14159265358979323846 * fc);
+    const double kk = k * k;
+    const double norm = 1 / (1 + std::sqrt(2.0) * k + kk);
+    const double b0 = highpass ? norm : kk * norm;
+    params.B0(0) = float(b0);
+    params.B1(0) = float(highpass ? -2 * b0 : 2 * b0);
+    params.B2(0) = float(b0);
+    params.A1(0) = float(-2 * (kk - 1) * norm);
+    params.A2(0) = float(-(1 - std::sqrt(2.0) * k + kk) * norm);
+}
+
+inline void Crossover4BandParams::designLR4(BiquadParams<float, 2>& params, float fc, bool highpass) {
+    BiquadParams<float, 1> butter;
+    designButterworth(butter, fc, highpass);
+    for (int i = 0; i < 5; ++i) {
+        params.setAtIndex(butter.getAtIndex(i), i);
+        params.setAtIndex(butter.getAtIndex(i), i + 5);
+    }
+}
+
+/**
+ * LR4 lowpass + highpass is a two pole allpass with the butterworth poles,
+ * so the numerator is just the denominator backwards.
+ */
+inline void Crossover4BandParams::designAllpass(BiquadParams<float, 1>& params, float fc) {
+    designButterworth(params, fc, false);
+    params.B0(0) = -params.A2(0);
+    params.B1(0) = -params.A1(0);
+    params.B2(0) = 1;
+}
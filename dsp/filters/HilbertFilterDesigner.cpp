@@ -6,6 +6,7 @@
 #include "HilbertFilterDesigner.h"
 #include "DspFilter.h"
 #include "BiquadFilter.h"
+#include "simd.h"
 #include <memory>
 
 
@@ -217,4 +218,5 @@ void HilbertFilterDesigner<T>::design(double sampleRate, BiquadParams<T, 3>& out
 // Or put all in header
 template class HilbertFilterDesigner<double>;
 template class HilbertFilterDesigner<float>;
+template class HilbertFilterDesigner<rack::simd::float_4>;
 
@@ -877,8 +877,12 @@ inline T LadderFilter<T>::processFeedback(T fcNorm, T feedback) const
 
 
 
+/**
+ * Maximum feedback vs. normalized Fc, so that Q is roughly
+ * constant across the audio range.
+ */
 template <typename T>
-void LadderFilter<T>::initQLookup()
+inline std::shared_ptr<NonUniformLookupTableParams<T>> makeLadderFeedbackLookup()
 {
     std::shared_ptr<NonUniformLookupTableParams<T>> ret =
         std::make_shared<NonUniformLookupTableParams<T>>();
@@ -900,7 +904,13 @@ void LadderFilter<T>::initQLookup()
     NonUniformLookupTable<T>::addPoint(*ret, T(0.498866), T(2.390137));
     
     NonUniformLookupTable<T>::finalize(*ret);
-    feedbackAdjust = ret;
+    return ret;
+}
+
+template <typename T>
+void LadderFilter<T>::initQLookup()
+{
+    feedbackAdjust = makeLadderFeedbackLookup<T>();
 }
 #if 0 // gain=40 = too much
 template <typename T>
@@ -0,0 +1,426 @@
+#pragma once
+
+#include "simd.h"
+#include "SimdBlocks.h"
+
+#include "BiquadFilter.h"
+#include "BiquadParams.h"
+#include "BiquadState.h"
+#include "IIRDecimator.h"
+#include "LadderFilter.h"
+
+/**
+ * SIMD version of the ladder filter.
+ * Runs four independent filters, one per lane of a float_4.
+ *
+ * Everything that can be different per voice (Fc, Q, drive, edge, slope, spread, volume)
+ * is a float_4. Type and voicing are the same for all lanes.
+ *
+ * The audio path is all float_4. The control rate functions that need
+ * a table lookup (Fc, Q compensation, edge) do four scalar lookups,
+ * but only when the input changes.
+ *
+ * Output should be within rounding error of LadderFilter<float>.
+ */
+template <>
+class LadderFilter<float_4>
+{
+public:
+    using T = float_4;
+    using Types = LadderFilter<float>::Types;
+    using Voicing = LadderFilter<float>::Voicing;
+
+    LadderFilter();
+
+    void run(T);
+    T getOutput();
+
+    /**
+     * input range >0 to < .5
+     */
+    void setNormalizedFc(T);
+
+    void setFeedback(T f);
+    void setType(Types);
+    void setVoicing(Voicing);
+    void setGain(T);
+    void setEdge(T);        // 0..1
+    void setFreqSpread(T);
+    void setBassMakeupGain(T);
+    void setSlope(T);       // 0..3. only works in 4 pole
+    void setVolume(T vol);  // 0..1
+
+    /**
+     * LED values are for the first lane.
+     */
+    float getLEDValue(int tapNumber) const;
+
+    static std::vector<std::string> getTypeNames()
+    {
+        return LadderFilter<float>::getTypeNames();
+    }
+    static std::vector<std::string> getVoicingNames()
+    {
+        return LadderFilter<float>::getVoicingNames();
+    }
+
+    // Only calibration routines will do this
+    void disableQComp()
+    {
+        _disableQComp = true;
+    }
+
+    void _dump(const std::string&)
+    {
+    }
+private:
+    TrapezoidalLowpass<T> lpfs[4];
+    EdgeTables edgeLookup;
+
+    T _g = .001f;
+    T stageG[4] = {.001f, .001f, .001f, .001f};
+    T stageTaps[4] = {0, 0, 0, 1};
+
+    T bassMakeupGain = 1;
+    T mixedOutput = 0;
+    T requestedFeedback = 0;
+    T adjustedFeedback = 0;
+    T gain = .3f;
+    T stageOutputs[4] = {0, 0, 0, 0};
+    T rawEdge = 0;
+    T freqSpread = 0;
+    T slope = 3;
+
+    T stageGain[4] = {1, 1, 1, 1};
+    T stageFreqOffsets[4] = {1, 1, 1, 1};
+
+    Types type = Types::_4PLP;
+    Voicing voicing = Voicing::Classic;
+    T lastNormalizedFc = .0001f;
+    T lastVolume = -1;
+    T finalVolume = 1;
+
+    bool bypassFirstStage = false;
+    bool _disableQComp = false;
+
+    std::shared_ptr<NonUniformLookupTableParams<float>> fs2gLookup = makeTrapFilter_Lookup<float>();
+    std::shared_ptr<NonUniformLookupTableParams<float>> feedbackAdjust = makeLadderFeedbackLookup<float>();
+    std::shared_ptr<LookupTableParams<float>> tanhLookup = ObjectCache<float>::getTanh5();
+
+    static const int oversampleRate = 4;
+
+    /**
+     * The scalar filter uses IIRUpsampler, which is float only.
+     * Here is the same thing, with float_4.
+     */
+    std::shared_ptr<BiquadParams<T, 3>> upParams;
+    BiquadState<T, 3> upState;
+    IIRDecimator<T> down;
+
+    void upsample(T* buffer, T input);
+
+    template <Voicing v>
+    void runBuffer(T* buffer);
+
+    template <Voicing v>
+    T shape(T x, int stage) const;
+
+    T lookupTanh(T x) const;
+
+    void updateFilter();
+    void updateSlope();
+    void updateFeedback();
+    void updateStageGains();
+    float getGfromNormFreq(float nf) const;
+
+    static bool isEqual(T a, T b)
+    {
+        return rack::simd::movemask(a == b) == 0xf;
+    }
+};
+
+inline LadderFilter<float_4>::LadderFilter()
+{
+    upParams = ObjectCache<T>::get6PLPParams(1.f / (4.0f * oversampleRate));
+    down.setup(oversampleRate);
+}
+
+inline float LadderFilter<float_4>::getLEDValue(int tapNumber) const
+{
+    return (type == Types::_4PLP) ? stageTaps[tapNumber][0] : 0;
+}
+
+inline float LadderFilter<float_4>::getGfromNormFreq(float nf) const
+{
+    nf *= (1.0 / oversampleRate);
+    return NonUniformLookupTable<float>::lookup(*fs2gLookup, nf);
+}
+
+inline void LadderFilter<float_4>::setNormalizedFc(T input)
+{
+    if (isEqual(input, lastNormalizedFc)) {
+        return;
+    }
+    lastNormalizedFc = input;
+    for (int i = 0; i < 4; ++i) {
+        _g[i] = getGfromNormFreq(input[i]);
+    }
+    updateFilter();
+    updateFeedback();
+}
+
+inline void LadderFilter<float_4>::setFeedback(T f)
+{
+    if (isEqual(f, requestedFeedback)) {
+        return;
+    }
+    requestedFeedback = f;
+    updateFeedback();
+}
+
+inline void LadderFilter<float_4>::updateFeedback()
+{
+    if (_disableQComp) {
+        adjustedFeedback = requestedFeedback;
+        return;
+    }
+
+    // same as LadderFilter<T>::processFeedback
+    const T x = requestedFeedback * .25f;
+    const T y = x * (2 - x);
+    T maxFeedback;
+    for (int i = 0; i < 4; ++i) {
+        maxFeedback[i] = NonUniformLookupTable<float>::lookup(*feedbackAdjust, lastNormalizedFc[i]);
+    }
+    adjustedFeedback = y * maxFeedback;
+}
+
+inline void LadderFilter<float_4>::setBassMakeupGain(T g)
+{
+    assert(rack::simd::movemask(g >= 1) == 0xf);
+    bassMakeupGain = g;
+}
+
+inline void LadderFilter<float_4>::setGain(T g)
+{
+    gain = g;
+}
+
+inline void LadderFilter<float_4>::setVolume(T vol)
+{
+    if (isEqual(vol, lastVolume)) {
+        return;
+    }
+    lastVolume = vol;
+    finalVolume = 4 * vol * vol;
+}
+
+inline void LadderFilter<float_4>::setFreqSpread(T s)
+{
+    if (isEqual(s, freqSpread)) {
+        return;
+    }
+    freqSpread = s;
+    for (int lane = 0; lane < 4; ++lane) {
+        const float s2 = s[lane] * .5f + 1;       // 1..2
+        float offsets[4];
+        AudioMath::distributeEvenly(offsets, 4, s2);
+        for (int stage = 0; stage < 4; ++stage) {
+            stageFreqOffsets[stage][lane] = offsets[stage];
+        }
+    }
+    updateFilter();
+}
+
+inline void LadderFilter<float_4>::updateFilter()
+{
+    for (int i = 0; i < 4; ++i) {
+        stageG[i] = _g * stageFreqOffsets[i];
+    }
+    if (bypassFirstStage) {
+        stageG[0] = getGfromNormFreq(.9f);
+    }
+}
+
+inline void LadderFilter<float_4>::setEdge(T e)
+{
+    if (isEqual(e, rawEdge)) {
+        return;
+    }
+    rawEdge = e;
+    updateStageGains();
+}
+
+inline void LadderFilter<float_4>::updateStageGains()
+{
+    const bool is4PLP = (type == Types::_4PLP);
+    for (int lane = 0; lane < 4; ++lane) {
+        float gains[4];
+        edgeLookup.lookup(is4PLP, rawEdge[lane], gains);
+        for (int stage = 0; stage < 4; ++stage) {
+            stageGain[stage][lane] = gains[stage];
+        }
+    }
+}
+
+inline void LadderFilter<float_4>::setSlope(T _slope)
+{
+    slope = rack::simd::clamp(_slope, 0.f, 3.f);
+    updateSlope();
+}
+
+/**
+ * Same result as the scalar version: each tap gets the
+ * part of slope that is within one of its stage number.
+ */
+inline void LadderFilter<float_4>::updateSlope()
+{
+    if (type != Types::_4PLP) {
+        return;
+    }
+    for (int i = 0; i < 4; ++i) {
+        stageTaps[i] = rack::simd::fmax(0.f, 1.f - rack::simd::fabs(slope - float(i)));
+    }
+}
+
+inline void LadderFilter<float_4>::setVoicing(Voicing v)
+{
+    voicing = v;
+}
+
+inline void LadderFilter<float_4>::setType(Types t)
+{
+    if (t == type) {
+        return;
+    }
+
+    // same taps as LadderFilter<T>::setType. stage 0 first.
+    static const float taps[(int)Types::NUM_TYPES][4] = {
+        {0, 0, 0, 1},                                       // _4PLP
+        {0, 0, 1, 0},                                       // _3PLP
+        {0, 1, 0, 0},                                       // _2PLP
+        {1, 0, 0, 0},                                       // _1PLP
+        {.68f * 2, -.68f * 2, 0, 0},                        // _2PBP
+        {.68f * 2, -1.36f * 2, .68f * 2, 0},                // _2HP1LP
+        {.68f * 4, -2.05f * 4, 2.05f * 4, -.68f * 4},       // _3HP1LP
+        {0, -.68f * 4, 1.36f * 4, -.68f * 4},               // _4PBP
+        {.68f, -1.36f, 1.36f, 0},                           // _1LPNotch
+        {.68f, -2.05f, 4.12f, -2.73f},                      // _3AP1LP
+        {1, -3, 3, -1},                                     // _3PHP
+        {1, -2, 1, 0},                                      // _2PHP
+        {1, -1, 0, 0},                                      // _1PHP
+        {1, -2, 2, 0},                                      // _NOTCH
+        {1, -3, 6, -4}                                      // _PHASER
+    };
+
+    type = t;
+    switch (type) {
+        case Types::_3PHP:
+        case Types::_2PHP:
+        case Types::_1PHP:
+        case Types::_NOTCH:
+        case Types::_PHASER:
+            bypassFirstStage = true;
+            break;
+        default:
+            bypassFirstStage = false;
+    }
+    for (int i = 0; i < 4; ++i) {
+        stageTaps[i] = taps[(int)type][i];
+    }
+
+    updateFilter();
+    updateSlope();
+    updateStageGains();         // many filter types turn off the edge
+}
+
+inline float_4 LadderFilter<float_4>::getOutput()
+{
+    return mixedOutput * 5 * bassMakeupGain;
+}
+
+inline void LadderFilter<float_4>::upsample(T* buffer, T input)
+{
+    input *= float(oversampleRate);
+    for (int i = 0; i < oversampleRate; ++i) {
+        buffer[i] = BiquadFilter<T>::run(input, upState, *upParams);
+        input = 0;
+    }
+}
+
+inline float_4 LadderFilter<float_4>::lookupTanh(T x) const
+{
+    return LookupTable<float>::lookup(*tanhLookup, x);
+}
+
+/**
+ * The distortion for each stage of each voicing.
+ * v and stage are always constants, so all the switching goes away.
+ */
+template <LadderFilter<float_4>::Voicing v>
+inline float_4 LadderFilter<float_4>::shape(T x, int stage) const
+{
+    const bool even = !(stage & 1);
+    switch (v) {
+        case Voicing::Classic:
+            return 2 * lookupTanh(.5f * x);
+        case Voicing::Clip2:
+            return even ? rack::simd::fmin(x, 1.f) : rack::simd::fmax(x, -1.f);
+        case Voicing::Fold:
+            return SimdBlocks::fold((stage == 0) ? x * .5f : x);
+        case Voicing::Fold2:
+            return SimdBlocks::ifelse(even ? (x > 0) : (x < 0), SimdBlocks::fold(x), x);
+        case Voicing::Clean:
+        default:
+            return x;
+    }
+}
+
+template <LadderFilter<float_4>::Voicing v>
+inline void LadderFilter<float_4>::runBuffer(T* buffer)
+{
+    for (int i = 0; i < oversampleRate; ++i) {
+        T temp = buffer[i] - adjustedFeedback * stageOutputs[3];
+        temp = rack::simd::clamp(temp, -3.f, 3.f);
+        for (int stage = 0; stage < 4; ++stage) {
+            temp *= stageGain[stage];
+            temp = shape<v>(temp, stage);
+            temp = lpfs[stage].run(temp, stageG[stage]);
+            stageOutputs[stage] = temp;
+        }
+
+        temp = 0;
+        for (int stage = 0; stage < 4; ++stage) {
+            temp += stageOutputs[stage] * stageTaps[stage];
+        }
+        buffer[i] = rack::simd::clamp(temp, -1.7f, 1.7f);
+    }
+}
+
+inline void LadderFilter<float_4>::run(T input)
+{
+    input *= gain;
+    T buffer[oversampleRate];
+    upsample(buffer, input);
+
+    switch (voicing) {
+        case Voicing::Classic:
+            runBuffer<Voicing::Classic>(buffer);
+            break;
+        case Voicing::Clip2:
+            runBuffer<Voicing::Clip2>(buffer);
+            break;
+        case Voicing::Fold:
+            runBuffer<Voicing::Fold>(buffer);
+            break;
+        case Voicing::Fold2:
+            runBuffer<Voicing::Fold2>(buffer);
+            break;
+        case Voicing::Clean:
+            runBuffer<Voicing::Clean>(buffer);
+            break;
+        default:
+            assert(false);
+    }
+    mixedOutput = down.process(buffer) * finalVolume;
+}
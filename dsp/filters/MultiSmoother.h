@@ -0,0 +1,105 @@
+#pragma once
+
+#include <assert.h>
+
+#include <cmath>
+
+#include "SimdBlocks.h"
+
+/**
+ * De-zippers N control values (gains, pans, mutes) for things like the mixers.
+ *
+ * Like MultiLPF, the new values come in at the control rate, every "div" samples,
+ * and are smoothed there with a one pole lowpass. But the output is then
+ * ramped linearly from one control step to the next, so it changes a little
+ * every sample instead of in steps. That ramp is just one float_4 add for every four
+ * values, so the per sample cost is tiny.
+ *
+ * With a time of zero there is no lowpass, and a new value is reached by a
+ * straight ramp over one control period.
+ *
+ * N must be a multiple of four.
+ */
+template <int N>
+class MultiSmoother {
+public:
+    /**
+     * @param seconds is the time constant of the lowpass.
+     * @param sampleTime is 1 / sample rate.
+     * @param div is how many samples between calls to step().
+     */
+    void setTime(float seconds, float sampleTime, int div);
+
+    /**
+     * Call every div samples, with new values.
+     */
+    void step(const float* input);
+
+    /**
+     * Call every sample, after any step().
+     */
+    void tick();
+
+    /**
+     * Jumps straight to input, with no smoothing.
+     */
+    void reset(const float* input);
+
+    float get(int index) const {
+        assert(index >= 0 && index < N);
+        return value[index / 4][index % 4];
+    }
+
+    /**
+     * The four values starting at index, which must be a multiple of four.
+     */
+    float_4 get4(int index) const {
+        assert(index >= 0 && index < N && (index % 4) == 0);
+        return value[index / 4];
+    }
+
+private:
+    static const int numBanks = N / 4;
+    static_assert((N % 4) == 0, "MultiSmoother size must be a multiple of four");
+
+    float_4 value[numBanks] = {0};      // what we output
+    float_4 delta[numBanks] = {0};      // added to value each sample
+    float_4 smoothed[numBanks] = {0};   // lowpass output, where value is ramping to
+
+    float k = 1;
+    float l = 0;
+    float rampScale = 1;
+};
+
+template <int N>
+inline void MultiSmoother<N>::setTime(float seconds, float sampleTime, int div) {
+    assert(div > 0);
+    assert(seconds >= 0);
+    rampScale = 1.f / div;
+    l = (seconds > 0) ? float(std::exp(-div * sampleTime / seconds)) : 0.f;
+    k = 1 - l;
+}
+
+template <int N>
+inline void MultiSmoother<N>::step(const float* input) {
+    for (int i = 0; i < numBanks; ++i) {
+        smoothed[i] = smoothed[i] * l + float_4::load(input + i * 4) * k;
+        delta[i] = (smoothed[i] - value[i]) * rampScale;
+    }
+}
+
+template <int N>
+inline void MultiSmoother<N>::tick() {
+    for (int i = 0; i < numBanks; ++i) {
+        value[i] += delta[i];
+    }
+}
+
+template <int N>
+inline void MultiSmoother<N>::reset(const float* input) {
+    for (int i = 0; i < numBanks; ++i) {
+        smoothed[i] = float_4::load(input + i * 4);
+        value[i] = smoothed[i];
+        delta[i] = 0;
+    }
+}
@@ -9,6 +9,7 @@
 #include <string>
 
 #include "CompiledRegion.h"
+#include "InstrumentCache.h"
 #include "InstrumentInfo.h"
 #include "PitchUtils.h"
 #include "SInstrument.h"
@@ -147,6 +148,43 @@ CompiledInstrumentPtr CompiledInstrument::make(const std::string& parseError) {
     return instOut;
 }
 
+void CompiledInstrument::write(InstrumentWriter& w) const {
+    assert(!_isInError);
+    w.write(defaultPath.toString());
+    w.write(nextIndex);
+    w.write(unsigned(relativeFilePaths.size()));
+    for (auto entry : relativeFilePaths) {
+        w.write(entry.first);
+        w.write(entry.second);
+    }
+    regionPool.write(w);
+}
+
+CompiledInstrumentPtr CompiledInstrument::read(InstrumentReader& r) {
+    CompiledInstrumentPtr instOut = std::make_shared<CompiledInstrument>();
+    std::string path;
+    r.read(path);
+    instOut->defaultPath = FilePath(path);
+    r.read(instOut->nextIndex);
+
+    unsigned int numFiles = 0;
+    r.read(numFiles);
+    for (unsigned int i = 0; i < numFiles && r.ok(); ++i) {
+        std::string file;
+        int index = 0;
+        r.read(file);
+        r.read(index);
+        instOut->relativeFilePaths.insert({file, index});
+    }
+    if (!r.ok() || !instOut->regionPool.read(r)) {
+        return nullptr;
+    }
+
+    // info isn't saved, since it's quick to make it again.
+    instOut->deriveInfo();
+    return instOut;
+}
+
 float CompiledInstrument::velToGain1(int midiVelocity, float veltrack) {
     const float v = float(midiVelocity);
     // const float t = veltrack;
@@ -307,17 +345,33 @@ void CompiledInstrument::setWaves(WaveLoaderPtr loader, const FilePath& rootPath
         tempPaths[waveIndex - 1] = path;
     }
 
-    for (auto path : tempPaths) {
+    // Looping needs random access to the whole sample, so those can't be streamed.
+    std::vector<bool> mustBeResident(num, false);
+    regionPool.visitRegions([&mustBeResident](CompiledRegion* region) {
+        const int waveIndex = region->sampleIndex;
+        if (waveIndex < 1 || waveIndex > int(mustBeResident.size())) {
+            return;
+        }
+        const auto mode = region->loopData.loop_mode;
+        const bool looped = (mode == SamplerSchema::DiscreteValue::LOOP_CONTINUOUS) ||
+                            (mode == SamplerSchema::DiscreteValue::LOOP_SUSTAIN);
+        if (looped || region->loopData.oscillator) {
+            mustBeResident[waveIndex - 1] = true;
+        }
+    });
+
+    for (size_t i = 0; i < tempPaths.size(); ++i) {
+        const std::string& path = tempPaths[i];
         assert(!path.empty());
         FilePath relativePath(path);
         if (relativePath.isAbsolute()) {
             //SQINFO("found an absolute %s", relativePath.toString().c_str());
-            loader->addNextSample(relativePath);
+            loader->addNextSample(relativePath, mustBeResident[i]);
         } else {
             FilePath fullPath(rootPath);
 
             fullPath.concat(relativePath);
-            loader->addNextSample(fullPath);
+            loader->addNextSample(fullPath, mustBeResident[i]);
         }
     }
 }
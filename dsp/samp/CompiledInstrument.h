@@ -11,6 +11,8 @@
 #include "SamplerPlayback.h"
 
 class FilePath;
+class InstrumentReader;
+class InstrumentWriter;
 class SInstrument;
 // class SRegion;
 class WaveLoader;
@@ -75,6 +77,13 @@ public:
     static CompiledInstrumentPtr make(SamplerErrorContext&, const SInstrumentPtr);
     static CompiledInstrumentPtr make(const std::string& parseError);
 
+    /**
+     * Save and restore a successfully compiled instrument, for the InstrumentCache.
+     * read will return null if the data is bad.
+     */
+    void write(InstrumentWriter&) const;
+    static CompiledInstrumentPtr read(InstrumentReader&);
+
     // returns true if caused keyswitch
     bool play(VoicePlayInfo&, const VoicePlayParameter& params, WaveLoader* loader, float sampleRate) override;
     void _dump(int depth) const override;
@@ -6,6 +6,7 @@
 
 #include "CompiledInstrument.h"
 #include "FilePath.h"
+#include "InstrumentCache.h"
 #include "SParse.h"
 #include "SamplerSchema.h"
 #include "SqLog.h"
@@ -175,6 +176,90 @@ void CompiledRegion::finalize() {
     }
 }
 
+void CompiledRegion::write(InstrumentWriter& w) const {
+    w.write(lokey);
+    w.write(hikey);
+    w.write(keycenter);
+    w.write(lovel);
+    w.write(hivel);
+    w.write(lorand);
+    w.write(hirand);
+    w.write(amp_veltrack);
+    w.write(ampeg_release);
+    w.write(lineNumber);
+    w.write(sampleIndex);
+    w.write(sampleFile.toString());
+    w.write(baseFileName);
+    w.write(defaultPathName);
+    w.write(sequenceSwitched);
+    w.write(sequenceCounter);
+    w.write(sequenceLength);
+    w.write(sequencePosition);
+    w.write(keySwitched);
+    w.write(sw_lolast);
+    w.write(sw_hilast);
+    w.write(sw_lokey);
+    w.write(sw_hikey);
+    w.write(sw_default);
+    w.write(sw_label);
+    w.write(hicc64);
+    w.write(locc64);
+    w.write(volume);
+    w.write(tune);
+    w.write(loopData.offset);
+    w.write(loopData.end);
+    w.write(loopData.loop_start);
+    w.write(loopData.loop_end);
+    w.write(int(loopData.loop_mode));
+    w.write(loopData.oscillator);
+    w.write(int(trigger));
+}
+
+void CompiledRegion::read(InstrumentReader& r) {
+    r.read(lokey);
+    r.read(hikey);
+    r.read(keycenter);
+    r.read(lovel);
+    r.read(hivel);
+    r.read(lorand);
+    r.read(hirand);
+    r.read(amp_veltrack);
+    r.read(ampeg_release);
+    r.read(lineNumber);
+    r.read(sampleIndex);
+    std::string sampleFileName;
+    r.read(sampleFileName);
+    sampleFile = FilePath(sampleFileName);
+    r.read(baseFileName);
+    r.read(defaultPathName);
+    r.read(sequenceSwitched);
+    r.read(sequenceCounter);
+    r.read(sequenceLength);
+    r.read(sequencePosition);
+    r.read(keySwitched);
+    r.read(sw_lolast);
+    r.read(sw_hilast);
+    r.read(sw_lokey);
+    r.read(sw_hikey);
+    r.read(sw_default);
+    r.read(sw_label);
+    r.read(hicc64);
+    r.read(locc64);
+    r.read(volume);
+    r.read(tune);
+    r.read(loopData.offset);
+    r.read(loopData.end);
+    r.read(loopData.loop_start);
+    r.read(loopData.loop_end);
+    int mode = 0;
+    r.read(mode);
+    loopData.loop_mode = SamplerSchema::DiscreteValue(mode);
+    r.read(loopData.oscillator);
+    int trig = 0;
+    r.read(trig);
+    trigger = SamplerSchema::DiscreteValue(trig);
+}
+
 bool CompiledRegion::shouldIgnore() const {
     // Ignore release triggered samples - we don't implement
     bool dontIgnore = trigger == SamplerSchema::DiscreteValue::NONE || trigger == SamplerSchema::DiscreteValue::ATTACK;
@@ -11,6 +11,8 @@
 class CompiledRegion;
 class VoicePlayInfo;
 class ISamplerPlayback;
+class InstrumentReader;
+class InstrumentWriter;
 
 using CompiledRegionPtr = std::shared_ptr<CompiledRegion>;
 
@@ -154,6 +156,12 @@ public:
      */
     void finalize();
 
+    /**
+     * Save and restore for the InstrumentCache.
+     */
+    void write(InstrumentWriter&) const;
+    void read(InstrumentReader&);
+
 protected:
     CompiledRegion(CompiledRegionPtr);
     CompiledRegion& operator=(const CompiledRegion&) = default;
@@ -13,6 +13,12 @@ public:
     static bool canInterpolate(T offset, unsigned int totalSize);
     static T interpolate(const T* data, T offset);
     static T interpolate(T offset, T y0, T y1, T y2, T y3);
+
+    /**
+     * Like interpolate, but x is already the fractional part (0..1).
+     * All the math is done in T, so this works for float_4 as well as float.
+     */
+    static T interpolateFrac(T x, T y0, T y1, T y2, T y3);
     static unsigned int getIntegerPart(T);
 
 private:
@@ -51,6 +57,20 @@ inline T CubicInterpolator<T>::interpolate(T offset, T y0, T y1, T y2, T y3) {
     return dRet;
 }
 
+template <typename T>
+inline T CubicInterpolator<T>::interpolateFrac(T x, T y0, T y1, T y2, T y3) {
+    // same polynomial as above, with x0..x3 = -1, 0, 1, 2
+    const T xMinusX0 = x + T(1);
+    const T xMinusX2 = x - T(1);
+    const T xMinusX3 = x - T(2);
+
+    T ret = T(-1.f / 6.f) * y0 * x * xMinusX2 * xMinusX3;
+    ret += T(1.f / 2.f) * y1 * xMinusX0 * xMinusX2 * xMinusX3;
+    ret += T(-1.f / 2.f) * y2 * xMinusX0 * x * xMinusX3;
+    ret += T(1.f / 6.f) * y3 * xMinusX0 * x * xMinusX2;
+    return ret;
+}
+
 template <typename T>
 inline T CubicInterpolator<T>::interpolate(const T* data, T offset) {
     //SQINFO("cubic int : int ofset=%f", offset );
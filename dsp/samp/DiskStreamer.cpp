@@ -0,0 +1,206 @@
+#include "DiskStreamer.h"
+
+#include <algorithm>
+
+#include "SqLog.h"
+
+StreamBuffer::StreamBuffer(unsigned int capacityFrames, DiskStreamer* owner) : capacity(capacityFrames),
+                                                                               mask(capacityFrames - 1),
+                                                                               owner(owner) {
+    // must be power of two
+    assert((capacityFrames & mask) == 0);
+    assert(capacityFrames > (chunkFrames + guardFrames));
+    ring.resize(capacity, 0);
+    rd_scratch.resize(chunkFrames, 0);
+}
+
+void StreamBuffer::au_start(WaveInfoInterface* wave, unsigned int firstFrame) {
+    // odd generation means "request being written"
+    requestGeneration.fetch_add(1);
+    requestWave.store(wave);
+    requestFirstFrame.store(firstFrame);
+    readFrame.store(firstFrame);
+    requestGeneration.fetch_add(1);
+    au_wakeReader();
+}
+
+void StreamBuffer::au_wakeReader() {
+    wakeFrame.store(neverWake, std::memory_order_relaxed);
+    if (owner) {
+        owner->au_wakeReader();
+    }
+}
+
+void StreamBuffer::au_stop() {
+    au_start(nullptr, 0);
+}
+
+bool StreamBuffer::au_getFrames(unsigned int firstFrame, unsigned int totalFrames, float* dest) {
+    const unsigned int gen = requestGeneration.load(std::memory_order_relaxed);
+    bool ok = (servedGeneration.load(std::memory_order_acquire) == gen);
+    if (ok) {
+        const unsigned int start = windowStart.load(std::memory_order_relaxed);
+        const unsigned int end = writeFrame.load(std::memory_order_acquire);
+        for (unsigned int i = 0; i < 4; ++i) {
+            const unsigned int frame = firstFrame + i;
+            if (frame >= totalFrames) {
+                dest[i] = 0;
+            } else if (frame < start || frame >= end) {
+                ok = false;
+            } else {
+                dest[i] = ring[frame & mask];
+            }
+        }
+
+        // Now that we have the data, make sure the reader didn't lap us while we copied.
+        // The slot for frame x is intact as long as x + capacity hasn't been written yet.
+        const unsigned int endAfter = writeFrame.load(std::memory_order_acquire);
+        if ((endAfter > capacity) && (firstFrame < (endAfter - capacity))) {
+            ok = false;
+        }
+    }
+
+    if (!ok) {
+        ++underruns;
+        dest[0] = dest[1] = dest[2] = dest[3] = 0;
+    }
+    return ok;
+}
+
+bool StreamBuffer::rd_startRequest() {
+    unsigned int gen = 0;
+    WaveInfoInterface* wave = nullptr;
+    unsigned int firstFrame = 0;
+    for (bool done = false; !done;) {
+        gen = requestGeneration.load();
+        if (gen & 1) {
+            // audio thread is in the middle of a request. come back later.
+            return false;
+        }
+        wave = requestWave.load();
+        firstFrame = requestFirstFrame.load();
+        done = (gen == requestGeneration.load());
+    }
+
+    // this is where we close the previous file, if any
+    rd_generation = gen;
+    rd_source.reset();
+    rd_totalFrames = 0;
+    if (wave) {
+        rd_totalFrames = unsigned(wave->getTotalFrameCount());
+        rd_source = wave->openStream();
+        if (rd_source && !rd_source->seek(firstFrame)) {
+            //SQWARN("unable to seek stream to %d", firstFrame);
+            rd_source.reset();
+        }
+    }
+
+    wakeFrame.store(neverWake, std::memory_order_relaxed);
+    windowStart.store(firstFrame, std::memory_order_relaxed);
+    writeFrame.store(firstFrame, std::memory_order_relaxed);
+    servedGeneration.store(gen, std::memory_order_release);
+    return true;
+}
+
+bool StreamBuffer::rd_service() {
+    if (requestGeneration.load() != rd_generation) {
+        return rd_startRequest();
+    }
+    if (!rd_source) {
+        return false;
+    }
+
+    const unsigned int end = writeFrame.load(std::memory_order_relaxed);
+    if (end >= rd_totalFrames) {
+        // all done - let go of the file
+        rd_source.reset();
+        return false;
+    }
+
+    // we may write up to the point where we would clobber
+    // the frames just behind the play position.
+    const unsigned int rf = readFrame.load(std::memory_order_acquire);
+    const unsigned int limit = ((rf > guardFrames) ? (rf - guardFrames) : 0) + capacity;
+
+    // small reads are inefficient. wait for more room, unless we are at the end.
+    const unsigned int worthReading = std::min(chunkFrames / 4, rd_totalFrames - end);
+    if ((end + worthReading) > limit) {
+        // limit is at least capacity, so this can't go negative.
+        wakeFrame.store(end + worthReading + guardFrames - capacity, std::memory_order_relaxed);
+        return false;
+    }
+    const unsigned int framesToRead = std::min(std::min(chunkFrames, limit - end), rd_totalFrames - end);
+
+    unsigned int framesRead = rd_source->read(rd_scratch.data(), framesToRead);
+    if (framesRead < framesToRead) {
+        // Short read means the file is truncated or corrupt.
+        // Play silence for the rest of it rather than glitching.
+        std::fill(rd_scratch.begin() + framesRead, rd_scratch.begin() + framesToRead, 0.f);
+    }
+
+    for (unsigned int i = 0; i < framesToRead; ++i) {
+        ring[(end + i) & mask] = rd_scratch[i];
+    }
+
+    // if a new request came in while we were reading, just drop this block.
+    if (requestGeneration.load() == rd_generation) {
+        writeFrame.store(end + framesToRead, std::memory_order_release);
+    }
+    return true;
+}
+
+//----------------------------------------------------------------------------
+
+DiskStreamer::DiskStreamer(unsigned int bufferFrames) {
+    for (int i = 0; i < numVoices; ++i) {
+        voices.push_back(std::unique_ptr<StreamBuffer>(new StreamBuffer(bufferFrames, this)));
+    }
+}
+
+DiskStreamer::~DiskStreamer() {
+    stopRequested = true;
+    au_wakeReader();
+    if (thread) {
+        thread->join();
+    }
+}
+
+void DiskStreamer::start() {
+    assert(!thread);
+    auto startupFunc = [this]() {
+        this->threadFunction();
+    };
+    std::unique_ptr<std::thread> th(new std::thread(startupFunc));
+    thread = std::move(th);
+}
+
+bool DiskStreamer::_serviceAll() {
+    bool didWork = false;
+    for (auto& voice : voices) {
+        didWork |= voice->rd_service();
+    }
+    return didWork;
+}
+
+void DiskStreamer::au_wakeReader() {
+    if (readerAsleep.exchange(false)) {
+        wakeup.post();
+    }
+}
+
+void DiskStreamer::threadFunction() {
+    while (!stopRequested) {
+        if (_serviceAll()) {
+            continue;
+        }
+
+        // Nothing to do. Say we are going to sleep, then look once more, since
+        // the audio thread may have asked for something before it could see that.
+        readerAsleep = true;
+        const bool moreToDo = _serviceAll() || stopRequested;
+        if (!moreToDo || !readerAsleep.exchange(false)) {
+            // Either we have to wait for a wakeup, or one is already on its way.
+            wakeup.wait();
+        }
+    }
+}
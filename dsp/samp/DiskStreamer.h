@@ -0,0 +1,193 @@
+#pragma once
+
+#include <assert.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "Semaphore.h"
+#include "WaveLoader.h"
+
+class DiskStreamer;
+
+/**
+ * StreamBuffer is the per-voice ring buffer used when samples are
+ * streamed from disk.
+ *
+ * Only the first part of a streamed sample (the "head") is resident in
+ * memory. When a voice starts playing a streamed sample the audio thread
+ * asks for the frames after the head, and the DiskStreamer thread fills
+ * this buffer ahead of the play position.
+ *
+ * Frames are stored at their absolute position in the file, modulo the capacity.
+ * Valid frames are [windowStart, writeFrame).
+ *
+ * Thread safety:
+ *      functions starting with au_ are called from the audio thread, and never block.
+ *      functions starting with rd_ are called from the reader thread.
+ *      Single producer / single consumer, so everything is done with atomics.
+ *
+ * The reader sleeps when there is nothing to do. The audio thread wakes it when
+ * a request starts or stops, and when playback has made enough room for a read.
+ */
+class StreamBuffer {
+public:
+    /**
+     * @param capacityFrames must be a power of two.
+     * @param owner is the DiskStreamer whose reader gets woken up. May be null
+     *      in unit tests that call rd_service themselves.
+     */
+    StreamBuffer(unsigned int capacityFrames, DiskStreamer* owner = nullptr);
+    StreamBuffer(const StreamBuffer&) = delete;
+
+    /**
+     * Start streaming "wave" from "firstFrame" up to its end.
+     * Any previous request is abandoned.
+     */
+    void au_start(WaveInfoInterface* wave, unsigned int firstFrame);
+    void au_stop();
+
+    /**
+     * Gets the four frames that start at firstFrame, which is what the cubic interpolator needs.
+     * Frames at or after totalFrames come back as zero, like Streamer's end buffer.
+     * returns false if the data isn't there yet (underrun). In that case dest is all zeros.
+     */
+    bool au_getFrames(unsigned int firstFrame, unsigned int totalFrames, float* dest);
+
+    /**
+     * Tell the reader how far playback has gotten, so it
+     * knows which frames it may overwrite.
+     */
+    void au_setReadFrame(unsigned int frame) {
+        readFrame.store(frame, std::memory_order_release);
+        // this gets called every sample, so all we do is one compare
+        // until the reader is waiting for us to get here.
+        if (frame >= wakeFrame.load(std::memory_order_relaxed)) {
+            au_wakeReader();
+        }
+    }
+
+    /**
+     * Does a bit of work, if there is any.
+     * returns true if it did something.
+     */
+    bool rd_service();
+
+    unsigned int _underruns() const { return underruns.load(); }
+
+    /**
+     * We keep a few frames behind the read position intact, since
+     * the interpolator looks back, and linear FM can move us backwards.
+     */
+    static const unsigned int guardFrames = 64;
+
+    /**
+     * How many frames the reader will decode at a time.
+     */
+    static const unsigned int chunkFrames = 4096;
+
+private:
+    const unsigned int capacity;
+    const unsigned int mask;
+    std::vector<float> ring;
+    DiskStreamer* const owner;
+
+    /**
+     * Requests from the audio thread. The request fields are written before the
+     * generation is bumped, so the reader can detect a torn read by checking the
+     * generation before and after.
+     */
+    std::atomic<WaveInfoInterface*> requestWave = {nullptr};
+    std::atomic<unsigned int> requestFirstFrame = {0};
+    std::atomic<unsigned int> requestGeneration = {0};
+
+    /**
+     * Written by the reader. Once servedGeneration matches requestGeneration
+     * the window [windowStart, writeFrame) is good data for that request.
+     */
+    std::atomic<unsigned int> servedGeneration = {0};
+    std::atomic<unsigned int> windowStart = {0};
+    std::atomic<unsigned int> writeFrame = {0};
+    std::atomic<unsigned int> readFrame = {0};
+    std::atomic<unsigned int> underruns = {0};
+
+    /**
+     * When the reader runs out of room it sets this to the read frame that
+     * will make enough room for it, and goes to sleep.
+     */
+    static const unsigned int neverWake = 0xffffffff;
+    std::atomic<unsigned int> wakeFrame = {neverWake};
+
+    // reader private state
+    unsigned int rd_generation = 0;
+    unsigned int rd_totalFrames = 0;
+    WaveStreamSourcePtr rd_source;
+    std::vector<float> rd_scratch;
+
+    bool rd_startRequest();
+    void au_wakeReader();
+};
+
+/**
+ * DiskStreamer owns one StreamBuffer for every voice, and the thread that refills them.
+ * It is created by the WaveLoader when any of its samples are streamed, and it goes
+ * away with the WaveLoader.
+ */
+class DiskStreamer {
+public:
+    /**
+     * Samp plays 16 voices
+     */
+    static const int numVoices = 16;
+
+    /**
+     * 64k frames is about 1.5 seconds at 44.1k - plenty to ride through a slow disk read.
+     */
+    static const unsigned int defaultBufferFrames = 64 * 1024;
+
+    DiskStreamer(unsigned int bufferFrames = defaultBufferFrames);
+    ~DiskStreamer();
+    DiskStreamer(const DiskStreamer&) = delete;
+    const DiskStreamer& operator=(const DiskStreamer&) = delete;
+
+    /**
+     * start the reader thread. Unit tests may skip this
+     * and call _serviceAll() directly.
+     */
+    void start();
+
+    StreamBuffer* getVoice(int voice) {
+        assert(voice >= 0 && voice < numVoices);
+        return voices[voice].get();
+    }
+
+    /**
+     * Does one pass over all the voices.
+     * returns true if any work was done.
+     */
+    bool _serviceAll();
+
+    /**
+     * Called by the StreamBuffers when they have work for the reader.
+     * Never blocks.
+     */
+    void au_wakeReader();
+
+private:
+    std::vector<std::unique_ptr<StreamBuffer>> voices;
+    std::unique_ptr<std::thread> thread;
+    std::atomic<bool> stopRequested = {false};
+
+    /**
+     * readerAsleep is set by the reader before it waits. Whoever clears it
+     * owes the reader one post.
+     */
+    std::atomic<bool> readerAsleep = {false};
+    Semaphore wakeup;
+
+    void threadFunction();
+};
+
+using DiskStreamerPtr = std::shared_ptr<DiskStreamer>;
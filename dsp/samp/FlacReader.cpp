@@ -4,6 +4,7 @@
 #include <assert.h>
 #include <stdlib.h>
 
+#include <algorithm>
 #include <limits>
 
 #include "FilePath.h"
@@ -217,3 +218,139 @@ void FlacReader::error_callback(const FLAC__StreamDecoder* decoder, FLAC__Stream
     // TODO
     assert(false);
 }
+
+//------------------------------------------------------------------
+
+FlacStreamReader::~FlacStreamReader() {
+    if (decoder) {
+        FLAC__stream_decoder_finish(decoder);
+        FLAC__stream_decoder_delete(decoder);
+    }
+}
+
+bool FlacStreamReader::open(const FilePath& filePath) {
+    assert(!decoder);
+    if (filePath.empty()) {
+        return false;
+    }
+    if ((decoder = FLAC__stream_decoder_new()) == NULL) {
+        return false;
+    }
+
+    FLAC__stream_decoder_set_md5_checking(decoder, false);
+#ifdef ARCH_WIN
+    flac_set_utf8_filenames(true);
+#endif
+    auto init_status = FLAC__stream_decoder_init_file(decoder, filePath.toString().c_str(), write_callback, metadata_callback, error_callback, /*client_data=*/this);
+    if (init_status != FLAC__STREAM_DECODER_INIT_STATUS_OK) {
+        return false;
+    }
+
+    // this will get us the stream info, but no audio
+    if (!FLAC__stream_decoder_process_until_end_of_metadata(decoder)) {
+        return false;
+    }
+    return formatOk;
+}
+
+bool FlacStreamReader::seek(uint64_t frame) {
+    if (!decoder || !formatOk || frame >= totalFrames_) {
+        return false;
+    }
+    pending.clear();
+    pendingReadIndex = 0;
+
+    // flac will call write_callback with the block containing "frame",
+    // already trimmed so that it starts at "frame".
+    FLAC__bool ok = FLAC__stream_decoder_seek_absolute(decoder, frame);
+    if (!ok && FLAC__stream_decoder_get_state(decoder) == FLAC__STREAM_DECODER_SEEK_ERROR) {
+        FLAC__stream_decoder_flush(decoder);
+    }
+    return ok != false;
+}
+
+unsigned FlacStreamReader::read(float* dest, unsigned frames) {
+    if (!decoder || !formatOk) {
+        return 0;
+    }
+    unsigned framesDone = 0;
+    while (framesDone < frames) {
+        if (pendingReadIndex >= pending.size()) {
+            pending.clear();
+            pendingReadIndex = 0;
+            if (FLAC__stream_decoder_get_state(decoder) == FLAC__STREAM_DECODER_END_OF_STREAM) {
+                break;
+            }
+            if (!FLAC__stream_decoder_process_single(decoder)) {
+                break;
+            }
+            if (pending.empty() && FLAC__stream_decoder_get_state(decoder) == FLAC__STREAM_DECODER_END_OF_STREAM) {
+                break;
+            }
+            continue;
+        }
+        const size_t available = pending.size() - pendingReadIndex;
+        const unsigned toCopy = unsigned(std::min(available, size_t(frames - framesDone)));
+        std::copy(pending.begin() + pendingReadIndex, pending.begin() + pendingReadIndex + toCopy, dest + framesDone);
+        pendingReadIndex += toCopy;
+        framesDone += toCopy;
+    }
+    return framesDone;
+}
+
+bool FlacStreamReader::onData(unsigned samples, const int32_t* leftData, const int32_t* rightData) {
+    if (!formatOk) {
+        return false;
+    }
+
+    // pending is always drained before we ask flac for another block,
+    // so this normally starts out empty.
+    const size_t base = pending.size();
+    pending.resize(base + samples);
+    float* writePtr = pending.data() + base;
+
+    if (bitsPerSample_ == 16) {
+        for (unsigned i = 0; i < samples; ++i) {
+            float x = FlacReader::read16Bit(leftData++);
+            if (rightData) {
+                x += FlacReader::read16Bit(rightData++);
+                x /= 2;
+            }
+            *writePtr++ = x;
+        }
+    } else {
+        for (unsigned i = 0; i < samples; ++i) {
+            float x = FlacReader::read24Bit(leftData++);
+            if (rightData) {
+                x += FlacReader::read24Bit(rightData++);
+                x /= 2;
+            }
+            *writePtr++ = x;
+        }
+    }
+    return true;
+}
+
+FLAC__StreamDecoderWriteStatus FlacStreamReader::write_callback(const FLAC__StreamDecoder* decoder, const FLAC__Frame* frame, const FLAC__int32* const buffer[], void* client_data) {
+    FlacStreamReader* client = reinterpret_cast<FlacStreamReader*>(client_data);
+    const int32_t* rightData = (client->channels_ > 1) ? buffer[1] : nullptr;
+    const bool ok = client->onData(frame->header.blocksize, buffer[0], rightData);
+    return ok ? FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE : FLAC__STREAM_DECODER_WRITE_STATUS_ABORT;
+}
+
+void FlacStreamReader::metadata_callback(const FLAC__StreamDecoder* decoder, const FLAC__StreamMetadata* metadata, void* client_data) {
+    if (metadata->type == FLAC__METADATA_TYPE_STREAMINFO) {
+        FlacStreamReader* client = reinterpret_cast<FlacStreamReader*>(client_data);
+        client->totalFrames_ = metadata->data.stream_info.total_samples;
+        client->sampleRate_ = metadata->data.stream_info.sample_rate;
+        client->channels_ = metadata->data.stream_info.channels;
+        client->bitsPerSample_ = metadata->data.stream_info.bits_per_sample;
+        client->formatOk = (client->totalFrames_ > 0) &&
+                           (client->channels_ == 1 || client->channels_ == 2) &&
+                           (client->bitsPerSample_ == 16 || client->bitsPerSample_ == 24);
+    }
+}
+
+void FlacStreamReader::error_callback(const FLAC__StreamDecoder* decoder, FLAC__StreamDecoderErrorStatus status, void* client_data) {
+    // a bad block will just come out short. The streamer will fill the gap with silence.
+}
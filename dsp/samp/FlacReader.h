@@ -2,6 +2,8 @@
 
 #include <stdio.h>
 
+#include <vector>
+
 #include "stream_decoder.h"
 
 class FilePath;
@@ -18,10 +20,10 @@ public:
     unsigned int getSampleRate();
     virtual uint64_t getTotalFrameCount();
 
-private:
     static float read16Bit(const int32_t*);
     static float read24Bit(const int32_t*);
 
+private:
     FLAC__StreamDecoder* decoder = nullptr;
     bool isOk = false;
 
@@ -48,3 +50,48 @@ private:
     static void metadata_callback(const FLAC__StreamDecoder* decoder, const FLAC__StreamMetadata* metadata, void* client_data);
     static void error_callback(const FLAC__StreamDecoder* decoder, FLAC__StreamDecoderErrorStatus status, void* client_data);
 };
+
+/**
+ * Incremental version of FlacReader, used for disk streaming.
+ * Instead of decoding the whole file in one shot, the caller
+ * may seek anywhere and pull out mono frames a block at a time.
+ * Same format restrictions as FlacReader (16 or 24 bit, mono or stereo).
+ */
+class FlacStreamReader {
+public:
+    ~FlacStreamReader();
+    bool open(const FilePath& filePath);
+    bool seek(uint64_t frame);
+
+    /**
+     * decode up to "frames" mono frames into dest.
+     * returns the number of frames actually decoded, which will
+     * only be less than requested at the end of the file, or on error.
+     */
+    unsigned read(float* dest, unsigned frames);
+
+    unsigned int getSampleRate() const { return sampleRate_; }
+    uint64_t getTotalFrameCount() const { return totalFrames_; }
+
+private:
+    FLAC__StreamDecoder* decoder = nullptr;
+    bool formatOk = false;
+
+    uint64_t totalFrames_ = 0;
+    unsigned channels_ = 0;
+    unsigned bitsPerSample_ = 0;
+    unsigned sampleRate_ = 0;
+
+    /**
+     * flac hands us a whole block at a time. Anything the caller
+     * didn't ask for yet waits here.
+     */
+    std::vector<float> pending;
+    size_t pendingReadIndex = 0;
+
+    bool onData(unsigned samples, const int32_t* leftData, const int32_t* rightData);
+
+    static FLAC__StreamDecoderWriteStatus write_callback(const FLAC__StreamDecoder* decoder, const FLAC__Frame* frame, const FLAC__int32* const buffer[], void* client_data);
+    static void metadata_callback(const FLAC__StreamDecoder* decoder, const FLAC__StreamMetadata* metadata, void* client_data);
+    static void error_callback(const FLAC__StreamDecoder* decoder, FLAC__StreamDecoderErrorStatus status, void* client_data);
+};
@@ -0,0 +1,249 @@
+#include "InstrumentCache.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "CompiledInstrument.h"
+#include "SqLog.h"
+#include "StableHash.h"
+#include "share/windows_unicode_filenames.h"
+
+void InstrumentWriter::writeBytes(const void* p, size_t size) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(p);
+    buffer.insert(buffer.end(), bytes, bytes + size);
+}
+
+void InstrumentWriter::write(int x) {
+    writeBytes(&x, sizeof(x));
+}
+
+void InstrumentWriter::write(unsigned int x) {
+    writeBytes(&x, sizeof(x));
+}
+
+void InstrumentWriter::write(uint64_t x) {
+    writeBytes(&x, sizeof(x));
+}
+
+void InstrumentWriter::write(float x) {
+    writeBytes(&x, sizeof(x));
+}
+
+void InstrumentWriter::write(bool x) {
+    const uint8_t b = x ? 1 : 0;
+    writeBytes(&b, 1);
+}
+
+void InstrumentWriter::write(const std::string& s) {
+    write(unsigned(s.size()));
+    writeBytes(s.data(), s.size());
+}
+
+//-----------------------------------------------------------------------
+
+void InstrumentReader::readBytes(void* p, size_t count) {
+    if (error || (count > (size - pos))) {
+        error = true;
+        memset(p, 0, count);
+        return;
+    }
+    memcpy(p, data + pos, count);
+    pos += count;
+}
+
+void InstrumentReader::read(int& x) {
+    readBytes(&x, sizeof(x));
+}
+
+void InstrumentReader::read(unsigned int& x) {
+    readBytes(&x, sizeof(x));
+}
+
+void InstrumentReader::read(uint64_t& x) {
+    readBytes(&x, sizeof(x));
+}
+
+void InstrumentReader::read(float& x) {
+    readBytes(&x, sizeof(x));
+}
+
+void InstrumentReader::read(bool& x) {
+    uint8_t b = 0;
+    readBytes(&b, 1);
+    x = (b != 0);
+}
+
+void InstrumentReader::read(std::string& s) {
+    unsigned int len = 0;
+    read(len);
+    if (len > remaining()) {
+        error = true;
+        s.clear();
+        return;
+    }
+    s.assign(reinterpret_cast<const char*>(data + pos), len);
+    pos += len;
+}
+
+//-----------------------------------------------------------------------
+
+#if defined(ARCH_WIN)
+static FILE* openFile(const std::string& path, const char* mode) {
+    flac_set_utf8_filenames(true);
+    return flac_internal_fopen_utf8(path.c_str(), mode);
+}
+
+static bool replaceFile(const std::string& from, const std::string& to) {
+    flac_set_utf8_filenames(true);
+    flac_internal_unlink_utf8(to.c_str());
+    return flac_internal_rename_utf8(from.c_str(), to.c_str()) == 0;
+}
+#else
+static FILE* openFile(const std::string& path, const char* mode) {
+    return fopen(path.c_str(), mode);
+}
+
+static bool replaceFile(const std::string& from, const std::string& to) {
+    return rename(from.c_str(), to.c_str()) == 0;
+}
+#endif
+
+static bool readFile(const std::string& path, std::string& content) {
+    FILE* fp = openFile(path, "rb");
+    if (!fp) {
+        return false;
+    }
+    content.clear();
+    char buffer[16 * 1024];
+    for (size_t count; (count = fread(buffer, 1, sizeof(buffer), fp)) > 0;) {
+        content.append(buffer, count);
+    }
+    fclose(fp);
+    return true;
+}
+
+static uint64_t hashFile(const FilePath& file, bool& ok) {
+    std::string content;
+    ok = readFile(file.toString(), content);
+    return ok ? stableHash(content) : 0;
+}
+
+static const char cacheMagic[] = "SQCI";
+
+//-----------------------------------------------------------------------
+
+InstrumentCache& InstrumentCache::get() {
+    static InstrumentCache cache;
+    return cache;
+}
+
+void InstrumentCache::setFolder(const std::string& f) {
+    std::lock_guard<std::mutex> lock(mutex);
+    folder = f;
+    if (!folder.empty() && folder.back() != FilePath::nativeSeparator() && folder.back() != FilePath::foreignSeparator()) {
+        folder += FilePath::nativeSeparator();
+    }
+}
+
+std::string InstrumentCache::getCacheFileName(const FilePath& sfzFile) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (folder.empty() || sfzFile.empty()) {
+        return "";
+    }
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%016llx.sqci", (unsigned long long)stableHash(sfzFile.toString()));
+    return folder + buffer;
+}
+
+CompiledInstrumentPtr InstrumentCache::find(const FilePath& sfzFile) {
+    const std::string cacheFileName = getCacheFileName(sfzFile);
+    std::string content;
+    if (cacheFileName.empty() || !readFile(cacheFileName, content)) {
+        return nullptr;
+    }
+
+    InstrumentReader reader(reinterpret_cast<const uint8_t*>(content.data()), content.size());
+    std::string magic;
+    unsigned int version = 0;
+    std::string sfzPath;
+    reader.read(magic);
+    reader.read(version);
+    reader.read(sfzPath);
+    if (!reader.ok() || magic != cacheMagic || version != fileVersion || sfzPath != sfzFile.toString()) {
+        return nullptr;
+    }
+
+    // the sfz, and everything it includes, must be unchanged.
+    unsigned int numFiles = 0;
+    reader.read(numFiles);
+    for (unsigned int i = 0; i < numFiles && reader.ok(); ++i) {
+        std::string path;
+        uint64_t hash = 0;
+        reader.read(path);
+        reader.read(hash);
+        bool ok = false;
+        const uint64_t currentHash = hashFile(FilePath(path), ok);
+        if (!ok || currentHash != hash) {
+            //SQINFO("instrument cache stale because of %s", path.c_str());
+            return nullptr;
+        }
+    }
+    if (!reader.ok()) {
+        return nullptr;
+    }
+
+    CompiledInstrumentPtr ret = CompiledInstrument::read(reader);
+    if (!ret || !reader.atEnd()) {
+        //SQWARN("bad instrument cache file %s", cacheFileName.c_str());
+        return nullptr;
+    }
+    return ret;
+}
+
+bool InstrumentCache::store(const FilePath& sfzFile, const std::vector<FilePath>& includedFiles, const CompiledInstrument& instrument) {
+    assert(!instrument.isInError());
+    const std::string cacheFileName = getCacheFileName(sfzFile);
+    if (cacheFileName.empty()) {
+        return false;
+    }
+
+    InstrumentWriter writer;
+    writer.write(std::string(cacheMagic));
+    writer.write(unsigned(fileVersion));
+    writer.write(sfzFile.toString());
+
+    std::vector<FilePath> files;
+    files.push_back(sfzFile);
+    files.insert(files.end(), includedFiles.begin(), includedFiles.end());
+    writer.write(unsigned(files.size()));
+    for (const FilePath& file : files) {
+        bool ok = false;
+        const uint64_t hash = hashFile(file, ok);
+        if (!ok) {
+            return false;
+        }
+        writer.write(file.toString());
+        writer.write(hash);
+    }
+
+    instrument.write(writer);
+
+    // write a temp file and move it into place, so a reader never sees a partial file.
+    char suffix[32];
+    snprintf(suffix, sizeof(suffix), ".%p.tmp", (void*)&writer);
+    const std::string tempFileName = cacheFileName + suffix;
+    FILE* fp = openFile(tempFileName, "wb");
+    if (!fp) {
+        return false;
+    }
+    const auto& data = writer.data();
+    bool ok = fwrite(data.data(), 1, data.size(), fp) == data.size();
+    ok = (fclose(fp) == 0) && ok;
+    ok = ok && replaceFile(tempFileName, cacheFileName);
+    if (!ok) {
+        //SQWARN("failed to write instrument cache %s", cacheFileName.c_str());
+        remove(tempFileName.c_str());
+    }
+    return ok;
+}
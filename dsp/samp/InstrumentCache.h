@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "FilePath.h"
+
+class CompiledInstrument;
+using CompiledInstrumentPtr = std::shared_ptr<CompiledInstrument>;
+
+/**
+ * Minimal binary writer for saving compiled instruments.
+ * Everything is in native byte order, since the cache is only ever
+ * read back on the machine that wrote it.
+ */
+class InstrumentWriter {
+public:
+    void write(int);
+    void write(unsigned int);
+    void write(uint64_t);
+    void write(float);
+    void write(bool);
+    void write(const std::string&);
+
+    const std::vector<uint8_t>& data() const { return buffer; }
+
+private:
+    std::vector<uint8_t> buffer;
+    void writeBytes(const void* p, size_t size);
+};
+
+/**
+ * Reads back what InstrumentWriter wrote.
+ * If we run off the end, all further reads return zero and ok() returns false.
+ */
+class InstrumentReader {
+public:
+    InstrumentReader(const uint8_t* data, size_t size) : data(data), size(size) {}
+    void read(int&);
+    void read(unsigned int&);
+    void read(uint64_t&);
+    void read(float&);
+    void read(bool&);
+    void read(std::string&);
+
+    bool ok() const { return !error; }
+    bool atEnd() const { return pos == size; }
+
+    /**
+     * For sanity checking counts before we allocate anything.
+     */
+    size_t remaining() const { return size - pos; }
+
+private:
+    const uint8_t* const data;
+    const size_t size;
+    size_t pos = 0;
+    bool error = false;
+    void readBytes(void* p, size_t size);
+};
+
+/**
+ * Cache of compiled instruments on disk.
+ *
+ * Lexing, parsing and compiling a big SFZ can take seconds. Once it has
+ * been compiled, we save the resulting RegionPool. The cache file records a hash
+ * of the SFZ text and of every file it #includes. If none of them have changed the next
+ * load reads back the compiled instrument and skips all the lexing, parsing and
+ * overlap removal.
+ *
+ * All functions are thread safe.
+ */
+class InstrumentCache {
+public:
+    static InstrumentCache& get();
+
+    /**
+     * Folder to keep the cache files in. Must already exist.
+     * Empty (the default) disables the cache.
+     */
+    void setFolder(const std::string& folder);
+
+    /**
+     * returns the compiled instrument for sfzFile if the cache has an up to date one,
+     * otherwise returns nullptr.
+     */
+    CompiledInstrumentPtr find(const FilePath& sfzFile);
+
+    /**
+     * @param includedFiles is every file that was included while parsing sfzFile
+     * returns false if it couldn't write the cache file.
+     */
+    bool store(const FilePath& sfzFile, const std::vector<FilePath>& includedFiles, const CompiledInstrument&);
+
+    /**
+     * Bump this whenever CompiledRegion, RegionPool, or the compiler changes
+     */
+    static const uint32_t fileVersion = 1;
+
+private:
+    std::mutex mutex;
+    std::string folder;
+
+    std::string getCacheFileName(const FilePath& sfzFile);
+};
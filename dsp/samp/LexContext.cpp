@@ -105,6 +105,7 @@ bool LexContext::pushOneLevel(const std::string& relativePath, int currentLine)
         std::string str((std::istreambuf_iterator<char>(t)),
                         std::istreambuf_iterator<char>());
         sIncludeContent = std::move(str);
+        includedFiles.push_back(fullPath);
     }
     if (sIncludeContent.empty()) {
         errorString_ = ("Include file empty ");
@@ -6,6 +6,7 @@
 #include <map>
 #include <string>
 #include <memory>
+#include <vector>
 
 class LexFileScope {
 public:
@@ -67,6 +68,11 @@ public:
     std::string errorString() const { return errorString_; }
     FilePath getRootFilePath() const { return rootFilePath; }
 
+    /**
+     * Every file that was read to resolve an #include.
+     */
+    const std::vector<FilePath>& getIncludedFiles() const { return includedFiles; }
+
   
 private:
     std::string currentContent;
@@ -75,6 +81,7 @@ private:
 
     int includeRecursionDepth = 0;
     std::list<LexFileScopePtr> scopes;
+    std::vector<FilePath> includedFiles;
 
     // key is path, value is content.
     // kind of a kluge converting path back to string here, but
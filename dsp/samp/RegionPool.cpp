@@ -2,8 +2,11 @@
 
 #include "RegionPool.h"
 
+#include <map>
+
 #include "CompiledRegion.h"
 #include "HeadingTracker.h"
+#include "InstrumentCache.h"
 #include "SInstrument.h"
 #include "SParse.h"
 #include "SamplerPlayback.h"
@@ -100,6 +103,82 @@ void RegionPool::visitRegions(RegionVisitor visitor) const {
     }
 }
 
+/**
+ * The lookup lists are saved as indexes into regions.
+ */
+static void writeRegionList(InstrumentWriter& w, const std::vector<CompiledRegion*>& list, const std::map<const CompiledRegion*, int>& indexes) {
+    w.write(unsigned(list.size()));
+    for (auto region : list) {
+        auto it = indexes.find(region);
+        assert(it != indexes.end());
+        w.write(it->second);
+    }
+}
+
+static bool readRegionList(InstrumentReader& r, std::vector<CompiledRegion*>& list, const std::vector<CompiledRegionPtr>& regions) {
+    unsigned int size = 0;
+    r.read(size);
+    if (size > r.remaining()) {
+        return false;
+    }
+    list.clear();
+    for (unsigned int i = 0; i < size; ++i) {
+        int index = -1;
+        r.read(index);
+        if (index < 0 || index >= int(regions.size())) {
+            return false;
+        }
+        list.push_back(regions[index].get());
+    }
+    return r.ok();
+}
+
+void RegionPool::write(InstrumentWriter& w) const {
+    std::map<const CompiledRegion*, int> indexes;
+    w.write(unsigned(regions.size()));
+    for (auto region : regions) {
+        const int index = int(indexes.size());
+        indexes[region.get()] = index;
+        region->write(w);
+    }
+
+    assert(noteActivationLists_.size() == 128);
+    for (const auto& list : noteActivationLists_) {
+        writeRegionList(w, list, indexes);
+    }
+    for (const auto& list : lastKeyswitchLists_) {
+        writeRegionList(w, list, indexes);
+    }
+    w.write(currentSwitch_);
+}
+
+bool RegionPool::read(InstrumentReader& r) {
+    assert(regions.empty());
+    unsigned int size = 0;
+    r.read(size);
+    if (size > r.remaining()) {
+        return false;
+    }
+    for (unsigned int i = 0; i < size; ++i) {
+        CompiledRegionPtr region = std::make_shared<CompiledRegion>(0);
+        region->read(r);
+        regions.push_back(region);
+    }
+
+    for (auto& list : noteActivationLists_) {
+        if (!readRegionList(r, list, regions)) {
+            return false;
+        }
+    }
+    for (auto& list : lastKeyswitchLists_) {
+        if (!readRegionList(r, list, regions)) {
+            return false;
+        }
+    }
+    r.read(currentSwitch_);
+    return r.ok();
+}
+
 void RegionPool::sortByVelocity(std::vector<CompiledRegionPtr>& array) {
     std::sort(array.begin(), array.end(), [](const CompiledRegionPtr a, const CompiledRegionPtr b) -> bool {
         bool less = false;
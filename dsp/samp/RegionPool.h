@@ -6,6 +6,8 @@
 #include <array>
 
 class CompiledRegion;
+class InstrumentReader;
+class InstrumentWriter;
 class SInstrument;
 class VoicePlayParameter;
 
@@ -37,6 +39,13 @@ public:
 
     void visitRegions(RegionVisitor) const;
 
+    /**
+     * Save and restore a fully built pool for the InstrumentCache.
+     * read returns false if the data is bad.
+     */
+    void write(InstrumentWriter&) const;
+    bool read(InstrumentReader&);
+
 private:
     std::vector<CompiledRegionPtr> regions;
     bool fixupCompiledTree();
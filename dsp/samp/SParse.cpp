@@ -50,18 +50,18 @@ std::string SParse::readFileIntoString(FILE* fp) {
     return res;
 }
 
-std::string SParse::goFile(const FilePath& filePath, SInstrumentPtr inst) {
+std::string SParse::goFile(const FilePath& filePath, SInstrumentPtr inst, std::vector<FilePath>* includedFiles) {
     FILE* fp = openFile(filePath);
     if (!fp) {
         return "can't open " + filePath.toString();
     }
     std::string sContent = readFileIntoString(fp);
     fclose(fp);
-    return goCommon(sContent, inst, filePath);
+    return goCommon(sContent, inst, filePath, includedFiles);
 }
 
 std::string SParse::go(const std::string& s, SInstrumentPtr inst) {
-    return goCommon(s, inst, FilePath());
+    return goCommon(s, inst, FilePath(), nullptr);
 }
 
 static std::string filter(const std::string& sInput) {
@@ -74,13 +74,16 @@ static std::string filter(const std::string& sInput) {
     return ret;
 }
 
-std::string SParse::goCommon(const std::string& sContentIn, SInstrumentPtr outParsedInstrument, const FilePath& fullPathToSFZ) {
+std::string SParse::goCommon(const std::string& sContentIn, SInstrumentPtr outParsedInstrument, const FilePath& fullPathToSFZ, std::vector<FilePath>* includedFiles) {
     std::string sContent = filter(sContentIn);
     LexContextPtr lexContext = std::make_shared<LexContext>(sContent);
     if (!fullPathToSFZ.empty()) {
         lexContext->addRootPath(fullPathToSFZ);
     }
     SLexPtr lex = SLex::go(lexContext);
+    if (includedFiles) {
+        *includedFiles = lexContext->getIncludedFiles();
+    }
     if (!lex) {
         std::string sError = lexContext->errorString();
         assert(!sError.empty());
@@ -87,12 +87,16 @@ using SHeadingList = std::vector<SHeadingPtr>;
 class SParse {
 public:
     static std::string go(const std::string& s, SInstrumentPtr);
-    static std::string goFile(const FilePath& filePath, SInstrumentPtr);
+
+    /**
+     * @param includedFiles if not null, will get all the files that were #included.
+     */
+    static std::string goFile(const FilePath& filePath, SInstrumentPtr, std::vector<FilePath>* includedFiles = nullptr);
 
 private:
     static FILE* openFile(const FilePath& fp);
     static std::string readFileIntoString(FILE* fp);
-    static std::string goCommon(const std::string& sContent, SInstrumentPtr outParsedInstrument, const FilePath& fullPathToSFZ);
+    static std::string goCommon(const std::string& sContent, SInstrumentPtr outParsedInstrument, const FilePath& fullPathToSFZ, std::vector<FilePath>* includedFiles);
 
     class Result {
     public:
@@ -0,0 +1,114 @@
+#include "SampleCache.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <algorithm>
+
+#include "SqLog.h"
+#include "WaveLoader.h"
+
+#ifdef ARCH_WIN
+#include "share/windows_unicode_filenames.h"
+#endif
+
+SampleCache& SampleCache::get() {
+    static SampleCache cache;
+    return cache;
+}
+
+#ifdef ARCH_WIN
+std::string SampleCache::makeKey(const FilePath& file, unsigned int headFrames) {
+    wchar_t* widePath = wchar_from_utf8(file.toString().c_str());
+    if (!widePath) {
+        return "";
+    }
+    struct _stat64 st;
+    wchar_t fullPath[_MAX_PATH];
+    const bool ok = (_wstat64(widePath, &st) == 0) && _wfullpath(fullPath, widePath, _MAX_PATH);
+    free(widePath);
+    if (!ok) {
+        return "";
+    }
+
+    // file names are case insensitive on windows.
+    _wcslwr(fullPath);
+    std::string ret(reinterpret_cast<const char*>(fullPath), wcslen(fullPath) * sizeof(wchar_t));
+    ret += "|" + std::to_string(st.st_size) + "|" + std::to_string(st.st_mtime) + "|" + std::to_string(headFrames);
+    return ret;
+}
+#else
+std::string SampleCache::makeKey(const FilePath& file, unsigned int headFrames) {
+    struct stat st;
+    char* fullPath = realpath(file.toString().c_str(), nullptr);
+    const bool ok = fullPath && (stat(fullPath, &st) == 0);
+    std::string ret;
+    if (ok) {
+        ret = fullPath;
+        ret += "|" + std::to_string(st.st_size) + "|" + std::to_string(st.st_mtime) + "|" + std::to_string(headFrames);
+    }
+    free(fullPath);
+    return ret;
+}
+#endif
+
+SampleCache::WaveInfoPtr SampleCache::find(const FilePath& file, unsigned int headFrames) {
+    const std::string key = makeKey(file, headFrames);
+    if (key.empty()) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(key);
+    if (it == entries.end()) {
+        return nullptr;
+    }
+    WaveInfoPtr ret = it->second.lock();
+    if (!ret) {
+        entries.erase(it);
+    }
+    return ret;
+}
+
+SampleCache::WaveInfoPtr SampleCache::add(const FilePath& file, unsigned int headFrames, WaveInfoPtr wave) {
+    assert(wave && wave->isValid());
+    const std::string key = makeKey(file, headFrames);
+    if (key.empty()) {
+        return wave;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& entry = entries[key];
+    WaveInfoPtr existing = entry.lock();
+    if (existing) {
+        //SQINFO("two threads loaded %s, keeping the first", file.toString().c_str());
+        return existing;
+    }
+    entry = wave;
+
+    // Only sweep when the map has doubled since last time, so loading
+    // N samples is O(N log N), not O(N * N).
+    if (entries.size() >= pruneSize) {
+        removeExpired();
+        pruneSize = std::max(size_t(minPruneSize), 2 * entries.size());
+    }
+    return wave;
+}
+
+size_t SampleCache::size() {
+    std::lock_guard<std::mutex> lock(mutex);
+    removeExpired();
+    return entries.size();
+}
+
+void SampleCache::removeExpired() {
+    for (auto it = entries.begin(); it != entries.end();) {
+        if (it->second.expired()) {
+            it = entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
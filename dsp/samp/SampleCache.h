@@ -0,0 +1,67 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "FilePath.h"
+
+class WaveInfoInterface;
+
+/**
+ * Process wide cache of loaded samples, so that several Samp instances
+ * playing the same library share one copy of each sample.
+ *
+ * Entries are keyed by the canonical path of the file, plus its size and
+ * modification time, so editing a sample on disk will cause it to be re-loaded.
+ * The number of frames kept resident is also part of the key, since
+ * a streamed wave only holds the head of the file.
+ *
+ * The cache does not own anything - it only holds weak references. A sample
+ * goes away when the last WaveLoader using it does.
+ *
+ * All functions are thread safe.
+ */
+class SampleCache {
+public:
+    using WaveInfoPtr = std::shared_ptr<WaveInfoInterface>;
+
+    static SampleCache& get();
+
+    /**
+     * returns a loaded wave, or nullptr if it isn't in the cache.
+     */
+    WaveInfoPtr find(const FilePath& file, unsigned int headFrames);
+
+    /**
+     * Adds a wave that was just loaded from "file".
+     * If another thread added the same file first, returns that one,
+     * otherwise returns "wave".
+     */
+    WaveInfoPtr add(const FilePath& file, unsigned int headFrames, WaveInfoPtr wave);
+
+    /**
+     * number of waves still in use.
+     */
+    size_t size();
+
+    /**
+     * Unique key for the current contents of "file", loaded with "headFrames".
+     * returns an empty key if the file can't be found.
+     */
+    static std::string makeKey(const FilePath& file, unsigned int headFrames);
+
+private:
+    std::mutex mutex;
+    std::map<std::string, std::weak_ptr<WaveInfoInterface>> entries;
+
+    /**
+     * Expired entries are removed when find() trips over them,
+     * or all at once when the map gets to this size.
+     */
+    static const size_t minPruneSize = 64;
+    size_t pruneSize = minPruneSize;
+
+    void removeExpired();
+};
@@ -0,0 +1,435 @@
+#include "SampleDiskCache.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "SampleCache.h"
+#include "SqLog.h"
+#include "StableHash.h"
+#include "WaveLoader.h"
+
+#ifdef ARCH_WIN
+#include <sys/utime.h>
+#include <windows.h>
+#include "share/windows_unicode_filenames.h"
+#else
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+/**
+ * Cache file layout:
+ *      CacheFileHeader
+ *      key (keyLength bytes)
+ *      padding up to dataOffset
+ *      totalFrames mono floats
+ */
+struct CacheFileHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t sampleRate;
+    uint32_t keyLength;
+    uint64_t totalFrames;
+    uint64_t dataOffset;
+};
+
+static const char cacheMagic[4] = {'S', 'Q', 'S', 'C'};
+static const char cacheExtension[] = ".sqsc";
+
+static bool isCacheFileName(const std::string& name) {
+    const size_t extLength = sizeof(cacheExtension) - 1;
+    return name.size() > extLength && name.compare(name.size() - extLength, extLength, cacheExtension) == 0;
+}
+
+struct CacheFileInfo {
+    std::string path;
+    uint64_t size;
+    int64_t lastUsed;
+};
+
+// Keep the sample data nicely aligned for SIMD.
+static const uint64_t dataAlignment = 64;
+
+/**
+ * A read only memory mapping of an entire file.
+ */
+class MappedFile {
+public:
+    ~MappedFile();
+    bool open(const std::string& path);
+    const uint8_t* data() const { return base; }
+    uint64_t size() const { return length; }
+
+private:
+    const uint8_t* base = nullptr;
+    uint64_t length = 0;
+#ifdef ARCH_WIN
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#endif
+};
+
+#ifdef ARCH_WIN
+bool MappedFile::open(const std::string& path) {
+    wchar_t* widePath = wchar_from_utf8(path.c_str());
+    file = CreateFileW(widePath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    free(widePath);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        return false;
+    }
+    mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        return false;
+    }
+    base = reinterpret_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    length = base ? uint64_t(fileSize.QuadPart) : 0;
+    return base != nullptr;
+}
+
+MappedFile::~MappedFile() {
+    if (base) {
+        UnmapViewOfFile(base);
+    }
+    if (mapping) {
+        CloseHandle(mapping);
+    }
+    if (file != INVALID_HANDLE_VALUE) {
+        CloseHandle(file);
+    }
+}
+
+static FILE* openForWrite(const std::string& path) {
+    wchar_t* widePath = wchar_from_utf8(path.c_str());
+    FILE* ret = _wfopen(widePath, L"wb");
+    free(widePath);
+    return ret;
+}
+
+static bool renameFile(const std::string& from, const std::string& to) {
+    wchar_t* wideFrom = wchar_from_utf8(from.c_str());
+    wchar_t* wideTo = wchar_from_utf8(to.c_str());
+    const bool ret = MoveFileExW(wideFrom, wideTo, MOVEFILE_REPLACE_EXISTING);
+    free(wideFrom);
+    free(wideTo);
+    return ret;
+}
+
+static bool removeFile(const std::string& path) {
+    wchar_t* widePath = wchar_from_utf8(path.c_str());
+    const bool ret = _wremove(widePath) == 0;
+    free(widePath);
+    return ret;
+}
+
+static void touchFile(const std::string& path) {
+    wchar_t* widePath = wchar_from_utf8(path.c_str());
+    _wutime(widePath, nullptr);
+    free(widePath);
+}
+
+static void listCacheFiles(const std::string& folder, std::vector<CacheFileInfo>& files) {
+    wchar_t* widePattern = wchar_from_utf8((folder + "*" + cacheExtension).c_str());
+    WIN32_FIND_DATAW data;
+    HANDLE find = FindFirstFileW(widePattern, &data);
+    free(widePattern);
+    if (find == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    do {
+        // our names are all plain ascii
+        std::string name;
+        for (const wchar_t* p = data.cFileName; *p; ++p) {
+            name += char(*p);
+        }
+        if (isCacheFileName(name)) {
+            const uint64_t size = (uint64_t(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+            const int64_t time = (int64_t(data.ftLastWriteTime.dwHighDateTime) << 32) | data.ftLastWriteTime.dwLowDateTime;
+            files.push_back({folder + name, size, time});
+        }
+    } while (FindNextFileW(find, &data));
+    FindClose(find);
+}
+#else
+bool MappedFile::open(const std::string& path) {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    void* p = MAP_FAILED;
+    if ((fstat(fd, &st) == 0) && (st.st_size > 0)) {
+        p = mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    }
+    // the mapping keeps its own reference to the file.
+    close(fd);
+    if (p == MAP_FAILED) {
+        return false;
+    }
+    base = reinterpret_cast<const uint8_t*>(p);
+    length = uint64_t(st.st_size);
+    return true;
+}
+
+MappedFile::~MappedFile() {
+    if (base) {
+        munmap(const_cast<uint8_t*>(base), size_t(length));
+    }
+}
+
+static FILE* openForWrite(const std::string& path) {
+    return fopen(path.c_str(), "wb");
+}
+
+static bool renameFile(const std::string& from, const std::string& to) {
+    return rename(from.c_str(), to.c_str()) == 0;
+}
+
+static bool removeFile(const std::string& path) {
+    return remove(path.c_str()) == 0;
+}
+
+static void touchFile(const std::string& path) {
+    utimes(path.c_str(), nullptr);
+}
+
+static void listCacheFiles(const std::string& folder, std::vector<CacheFileInfo>& files) {
+    DIR* dir = opendir(folder.c_str());
+    if (!dir) {
+        return;
+    }
+    while (const struct dirent* entry = readdir(dir)) {
+        const std::string name = entry->d_name;
+        struct stat st;
+        if (isCacheFileName(name) && stat((folder + name).c_str(), &st) == 0) {
+            files.push_back({folder + name, uint64_t(st.st_size), int64_t(st.st_mtime)});
+        }
+    }
+    closedir(dir);
+}
+#endif
+
+//---------------------------------------------------------------------------
+
+/**
+ * A wave whose data is mapped from a cache file.
+ */
+class MappedWave : public WaveInfoInterface {
+public:
+    MappedWave(const FilePath& source, std::unique_ptr<MappedFile> mapped) : fp(source), file(std::move(mapped)) {
+        const CacheFileHeader* header = reinterpret_cast<const CacheFileHeader*>(file->data());
+        sampleRate = header->sampleRate;
+        totalFrameCount = header->totalFrames;
+        data = reinterpret_cast<const float*>(file->data() + header->dataOffset);
+    }
+    unsigned int getSampleRate() override { return sampleRate; }
+    uint64_t getTotalFrameCount() override { return totalFrameCount; }
+    bool isValid() const override { return true; }
+    const float* getData() override { return data; }
+    std::string getFileName() override { return fp.toString(); }
+
+    // we are born loaded.
+    bool load(std::string& errorMsg) override { return true; }
+
+private:
+    const FilePath fp;
+    std::unique_ptr<MappedFile> file;
+    unsigned int sampleRate = 0;
+    uint64_t totalFrameCount = 0;
+    const float* data = nullptr;
+};
+
+//---------------------------------------------------------------------------
+
+SampleDiskCache& SampleDiskCache::get() {
+    static SampleDiskCache cache;
+    return cache;
+}
+
+void SampleDiskCache::setFolder(const std::string& f) {
+    std::lock_guard<std::mutex> lock(mutex);
+    folder = f;
+    if (!folder.empty() && folder.back() != FilePath::nativeSeparator() && folder.back() != FilePath::foreignSeparator()) {
+        folder += FilePath::nativeSeparator();
+    }
+    sizeKnown = false;
+}
+
+void SampleDiskCache::setMaxSize(uint64_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex);
+    maxSize = bytes;
+}
+
+std::string SampleDiskCache::getFolder() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return folder;
+}
+
+uint64_t SampleDiskCache::trim(uint64_t maxBytes) {
+    const std::string folderCopy = getFolder();
+    if (folderCopy.empty()) {
+        return 0;
+    }
+
+    std::vector<CacheFileInfo> files;
+    listCacheFiles(folderCopy, files);
+    uint64_t total = 0;
+    for (const CacheFileInfo& info : files) {
+        total += info.size;
+    }
+
+    if (total > maxBytes) {
+        std::sort(files.begin(), files.end(), [](const CacheFileInfo& a, const CacheFileInfo& b) {
+            return a.lastUsed < b.lastUsed;
+        });
+        for (size_t i = 0; i < files.size() && total > maxBytes; ++i) {
+            // on Windows we can't delete one that is mapped, so it stays.
+            if (removeFile(files[i].path)) {
+                total -= files[i].size;
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    sizeEstimate = total;
+    sizeKnown = true;
+    return total;
+}
+
+bool SampleDiskCache::isEnabled() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return !folder.empty();
+}
+
+std::string SampleDiskCache::getCacheFileName(const FilePath& file, std::string& key) {
+    std::string folderCopy;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        folderCopy = folder;
+    }
+    if (folderCopy.empty()) {
+        return "";
+    }
+    key = SampleCache::makeKey(file, 0);
+    if (key.empty()) {
+        return "";
+    }
+
+    // The key ends with |size|mtime|headFrames. Leave those out of the name,
+    // so when the source changes we find (and replace) the old cache file.
+    size_t pathLength = key.size();
+    for (int i = 0; i < 3 && pathLength != std::string::npos; ++i) {
+        pathLength = key.rfind('|', pathLength - 1);
+    }
+    assert(pathLength != std::string::npos);
+
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%016llx%s", (unsigned long long)stableHash(key.substr(0, pathLength)), cacheExtension);
+    return folderCopy + buffer;
+}
+
+SampleDiskCache::WaveInfoPtr SampleDiskCache::find(const FilePath& file) {
+    std::string key;
+    const std::string cacheFileName = getCacheFileName(file, key);
+    if (cacheFileName.empty()) {
+        return nullptr;
+    }
+
+    std::unique_ptr<MappedFile> mapped(new MappedFile());
+    if (!mapped->open(cacheFileName)) {
+        return nullptr;
+    }
+
+    // now make sure it's really the right file, and not truncated
+    if (mapped->size() < sizeof(CacheFileHeader)) {
+        return nullptr;
+    }
+    const CacheFileHeader* header = reinterpret_cast<const CacheFileHeader*>(mapped->data());
+    if (memcmp(header->magic, cacheMagic, sizeof(cacheMagic)) != 0 ||
+        header->version != fileVersion ||
+        header->keyLength != key.size() ||
+        (header->dataOffset % dataAlignment) != 0 ||
+        header->dataOffset < (sizeof(CacheFileHeader) + key.size()) ||
+        mapped->size() != header->dataOffset + header->totalFrames * sizeof(float)) {
+        //SQWARN("bad cache file %s", cacheFileName.c_str());
+        return nullptr;
+    }
+    if (memcmp(mapped->data() + sizeof(CacheFileHeader), key.data(), key.size()) != 0) {
+        // The source file changed (or a hash collision), so this one is no use to anyone.
+        mapped.reset();
+        removeFile(cacheFileName);
+        return nullptr;
+    }
+
+    touchFile(cacheFileName);
+    return std::make_shared<MappedWave>(file, std::move(mapped));
+}
+
+bool SampleDiskCache::store(const FilePath& file, WaveInfoInterface& wave) {
+    assert(wave.isValid());
+    if (wave.isStreamed()) {
+        return false;
+    }
+    std::string key;
+    const std::string cacheFileName = getCacheFileName(file, key);
+    if (cacheFileName.empty()) {
+        return false;
+    }
+
+    CacheFileHeader header;
+    memcpy(header.magic, cacheMagic, sizeof(cacheMagic));
+    header.version = fileVersion;
+    header.sampleRate = wave.getSampleRate();
+    header.keyLength = uint32_t(key.size());
+    header.totalFrames = wave.getTotalFrameCount();
+    header.dataOffset = sizeof(CacheFileHeader) + key.size();
+    header.dataOffset = ((header.dataOffset + dataAlignment - 1) / dataAlignment) * dataAlignment;
+    const uint64_t padding = header.dataOffset - (sizeof(CacheFileHeader) + key.size());
+    const char zeros[dataAlignment] = {0};
+
+    // Write to a temp file and rename it, so another instance never maps a partial file.
+    char suffix[32];
+    snprintf(suffix, sizeof(suffix), ".%p.tmp", (void*)&wave);
+    const std::string tempFileName = cacheFileName + suffix;
+    FILE* fp = openForWrite(tempFileName);
+    if (!fp) {
+        return false;
+    }
+    bool ok = fwrite(&header, sizeof(header), 1, fp) == 1;
+    ok = ok && fwrite(key.data(), 1, key.size(), fp) == key.size();
+    ok = ok && fwrite(zeros, 1, size_t(padding), fp) == padding;
+    ok = ok && fwrite(wave.getData(), sizeof(float), size_t(header.totalFrames), fp) == header.totalFrames;
+    ok = (fclose(fp) == 0) && ok;
+
+    ok = ok && renameFile(tempFileName, cacheFileName);
+    if (!ok) {
+        //SQWARN("failed to write cache file %s", cacheFileName.c_str());
+        removeFile(tempFileName);
+        return false;
+    }
+
+    bool needsTrim = false;
+    uint64_t limit = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        sizeEstimate += header.dataOffset + header.totalFrames * sizeof(float);
+        limit = maxSize;
+        needsTrim = (limit > 0) && (!sizeKnown || sizeEstimate > limit);
+    }
+    if (needsTrim) {
+        trim(limit);
+    }
+    return true;
+}
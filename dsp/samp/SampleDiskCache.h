@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "FilePath.h"
+
+class WaveInfoInterface;
+
+/**
+ * Optional cache of decoded samples on disk.
+ *
+ * Decoding FLAC and mixing down to mono is most of the time it takes to load
+ * an SFZ. So after we decode a sample we write the mono float data to a file in
+ * the cache folder. Next time the sample is loaded we mmap that file, and the
+ * mapping is played directly - nothing is decoded or copied.
+ *
+ * Cache files are named from a hash of the source file's path. The full key, which also
+ * has the size and modification time, is stored in the header. If the source file
+ * changes, the stale cache file is deleted the next time it is looked up.
+ *
+ * The cache is kept under a size limit by deleting the least recently used files.
+ * A hit touches the file's modification time, so that is the "last used" time.
+ *
+ * Only fully resident samples are cached. Streamed samples go to the source file anyway.
+ *
+ * All functions are thread safe.
+ */
+class SampleDiskCache {
+public:
+    using WaveInfoPtr = std::shared_ptr<WaveInfoInterface>;
+
+    static SampleDiskCache& get();
+
+    /**
+     * Folder to keep the cache files in. Must already exist.
+     * Empty (the default) disables the cache.
+     */
+    void setFolder(const std::string& folder);
+    bool isEnabled();
+
+    /**
+     * returns a mapped wave if there is a good cache file for "file", else nullptr.
+     */
+    WaveInfoPtr find(const FilePath& file);
+
+    /**
+     * Writes a loaded wave out to the cache.
+     * returns false on error, in which case there will be no cache file.
+     */
+    bool store(const FilePath& file, WaveInfoInterface& wave);
+
+    /**
+     * When the cache gets bigger than this it's trimmed, oldest files first.
+     * Zero means no limit.
+     */
+    void setMaxSize(uint64_t bytes);
+    static const uint64_t defaultMaxSize = uint64_t(2) * 1024 * 1024 * 1024;
+
+    /**
+     * Deletes least recently used cache files until they add up to no more than maxBytes.
+     * trim(0) empties the cache (except for files that are mapped, on Windows).
+     * returns the number of bytes left.
+     */
+    uint64_t trim(uint64_t maxBytes);
+
+    /**
+     * Bump this whenever the file format, or the way samples are decoded, changes.
+     */
+    static const uint32_t fileVersion = 1;
+
+private:
+    std::mutex mutex;
+    std::string folder;
+    uint64_t maxSize = defaultMaxSize;
+
+    /**
+     * Size of the cache as of the last trim, plus what we've written since.
+     * Not known until the first trim after setFolder.
+     */
+    uint64_t sizeEstimate = 0;
+    bool sizeKnown = false;
+
+    std::string getFolder();
+
+    /**
+     * returns empty path if disabled or if the file doesn't exist.
+     */
+    std::string getCacheFileName(const FilePath& file, std::string& key);
+};
@@ -2,6 +2,7 @@
 #include "Sampler4vx.h"
 
 #include "CompiledInstrument.h"
+#include "DiskStreamer.h"
 #include "PitchUtils.h"
 #include "SInstrument.h"
 #include "WaveLoader.h"
@@ -15,6 +16,18 @@ const float Sampler4vx::defaultDecaySec = {.1f};
 const float Sampler4vx::defaultReleaseSec = {.3f};
 
 void Sampler4vx::setLoader(WaveLoaderPtr loader) {
+    if (!loader) {
+        // nothing will play until we get a new loader, so
+        // don't leave any voices pointing at the old samples.
+        player.clearSamples();
+        retiredChannels = 0;
+    } else if (loader != waves) {
+        for (int channel = 0; channel < 4; ++channel) {
+            if (player.isPlaying(channel)) {
+                retiredChannels |= (1 << channel);
+            }
+        }
+    }
     waves = loader;
 
     // While we are at it, let's initialize the ADSR.
@@ -24,6 +37,24 @@ void Sampler4vx::setLoader(WaveLoaderPtr loader) {
     adsr.setRSec(defaultReleaseSec);
 }
 
+bool Sampler4vx::isPlayingRetiredSamples() const {
+    for (int channel = 0; channel < 4; ++channel) {
+        if ((retiredChannels & (1 << channel)) && player.isPlaying(channel)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Sampler4vx::clearRetiredSamples() {
+    for (int channel = 0; channel < 4; ++channel) {
+        if (retiredChannels & (1 << channel)) {
+            player.clearSamples(channel);
+        }
+    }
+    retiredChannels = 0;
+}
+
 #ifdef _SAMPFM
 float_4 Sampler4vx::step(const float_4& gates, float sampleTime, const float_4& lfm, bool lfmEnabled) {
     sampleTime_ = sampleTime;
@@ -42,6 +73,27 @@ float_4 Sampler4vx::step(const float_4& gates, float sampleTime, const float_4&
     return 0.f;
 }
 
+void Sampler4vx::processBlock(float_4* output, int frames, const float_4& gates, float sampleTime, const float_4& lfm, bool lfmEnabled) {
+    sampleTime_ = sampleTime;
+    if (!patch || !waves) {
+        for (int i = 0; i < frames; ++i) {
+            output[i] = 0;
+        }
+        return;
+    }
+
+    simd_assertMask(gates);
+    player.stepBlock(output, frames, lfm, lfmEnabled);
+    const bool useEnvelopes = !player.blockEnvelopes();
+    for (int i = 0; i < frames; ++i) {
+        float_4 samples = output[i] * _outputGain();
+        if (useEnvelopes) {
+            samples *= adsr.step(gates, sampleTime);
+        }
+        output[i] = samples;
+    }
+}
+
 void Sampler4vx::setExpFM(const float_4& value) {
     fmCV = value;
     updatePitch();
@@ -99,6 +151,9 @@ bool Sampler4vx::note_on(int channel, int midiPitch, int midiVelocity, float sam
     if (patch->isInError()) {
         assert(false);
     }
+
+    // whatever this channel was playing, it's about to play something from the current loader.
+    retiredChannels &= ~(1 << channel);
     VoicePlayInfo patchInfo;
     VoicePlayParameter params;
     params.midiPitch = midiPitch;
@@ -116,7 +171,14 @@ bool Sampler4vx::note_on(int channel, int midiPitch, int midiVelocity, float sam
     //SQINFO("played pitch=%d vel=%d file=%s", midiPitch, midiVelocity, waveInfo->getFileName().c_str());
 #endif
 
-    player.setSample(channel, waveInfo->getData(), int(waveInfo->getTotalFrameCount()));
+    DiskStreamer* diskStreamer = waves->getDiskStreamer();
+    if (diskStreamer && waveInfo->isStreamed()) {
+        assert(myIndex >= 0);
+        StreamBuffer* stream = diskStreamer->getVoice(myIndex * 4 + channel);
+        player.setStreamedSample(channel, waveInfo.get(), waveInfo->getData(), int(waveInfo->getResidentFrameCount()), int(waveInfo->getTotalFrameCount()), stream);
+    } else {
+        player.setSample(channel, waveInfo->getData(), int(waveInfo->getTotalFrameCount()));
+    }
     player.setLoopData(channel, patchInfo.loopData);
     player.setGain(channel, patchInfo.gain);
 
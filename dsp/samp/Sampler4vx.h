@@ -58,6 +58,12 @@ public:
     bool note_on(int channel, int midiPitch, int midiVelocity, float sampleRate);
 
     void setPatch(CompiledInstrumentPtr inst);
+
+    /**
+     * Voices that are playing when the loader changes keep playing the
+     * old samples, so the caller must keep the old loader alive until
+     * isPlayingRetiredSamples() is false, or it calls clearRetiredSamples().
+     */
     void setLoader(WaveLoaderPtr loader);
     void setIndex(int i) { myIndex = i; }
 
@@ -68,6 +74,12 @@ public:
 #ifdef _SAMPFM
     void setExpFM(const float_4& value);
     float_4 step(const float_4& gates, float sampleTime, const float_4& lfm, bool lfmEnabled);
+
+    /**
+     * Renders "frames" samples into output. Same as calling step "frames" times,
+     * so the gates and lfm must not change during the block.
+     */
+    void processBlock(float_4* output, int frames, const float_4& gates, float sampleTime, const float_4& lfm, bool lfmEnabled);
 #else
     float_4 step(const float_4& gates, float sampleTime);
 #endif
@@ -81,8 +93,12 @@ public:
     void clearSamples() {
         player.clearSamples();
         waves.reset();
+        retiredChannels = 0;
     }
 
+    bool isPlayingRetiredSamples() const;
+    void clearRetiredSamples();
+
     static const float defaultAttackSec;
     static const float defaultDecaySec;
     static const float defaultReleaseSec;
@@ -114,4 +130,9 @@ private:
     void updatePitch();
     int myIndex = -1;
     bool printErrors = true;
+
+    /**
+     * bit for each channel that is playing samples from the previous loader.
+     */
+    int retiredChannels = 0;
 };
\ No newline at end of file
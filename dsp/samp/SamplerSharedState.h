@@ -26,20 +26,23 @@ public:
     /** called from UI thread or worker thread
     */
 
-    /* Ask for permission to change the sample data.
-     * once permission is granted audio thread won't look at
-     * sample data, so others are free to change it safely.
+    /* Ask for permission to delete the sample data that was
+     * replaced by patch number "generation" (counting every patch sent to the
+     * audio thread). Once permission is granted the audio thread has switched to that
+     * patch, and no voice is still playing the old samples.
+     *
+     * Nobody waits for the grant. The audio thread keeps playing the old patch
+     * until it can grant it, and then sends Samp's server a retireOnly message,
+     * which is when the server checks uiw_isSampleReloadGranted and deletes it.
      */
-    void uiw_requestSampleReload() {
-        sampleReloadRequestGranted = false;
-        sampleReloadRequested = true;
+    void uiw_requestSampleReload(unsigned generation) {
+        if (generation > sampleReloadRequested) {
+            sampleReloadRequested = generation;
+        }
     }
 
-    // Same as uiw_requestSampleReload, but wait for audio thread to grant it
-    void uiw_requestAndWaitForSampleReload() {
-        uiw_requestSampleReload();
-        while (!sampleReloadRequestGranted) {
-        }  // busy wait on atomic variable
+    bool uiw_isSampleReloadGranted(unsigned generation) const {
+        return sampleReloadGranted >= generation;
     }
 
     float uiw_getProgressPercent() {
@@ -52,16 +55,19 @@ public:
 
     // called from audio thread
     bool au_isSampleReloadRequested() const {
-        return sampleReloadRequested;
+        return sampleReloadRequested > sampleReloadGranted;
     }
-    void au_grantSampleReloadRequest() {
-        sampleReloadRequested = false;
-        sampleReloadRequestGranted = true;
+
+    /**
+     * Grants every request up to and including generation.
+     */
+    void au_grantSampleReloadRequest(unsigned generation) {
+        sampleReloadGranted = generation;
     }
 
 private:
-    std::atomic<bool> sampleReloadRequested = {false};
-    std::atomic<bool> sampleReloadRequestGranted = {false};
+    std::atomic<unsigned> sampleReloadRequested = {0};
+    std::atomic<unsigned> sampleReloadGranted = {0};
     std::atomic<float> progressPercent = {0};
 };
 
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/**
+ * 64 bit FNV-1a.
+ * The on-disk caches need a hash that is the same from run to run, which std::hash doesn't promise.
+ */
+inline uint64_t stableHash(const std::string& s) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (char c : s) {
+        hash ^= uint8_t(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
@@ -7,123 +7,146 @@
 #include <algorithm>
 
 #include "CubicInterpolator.h"
+#include "DiskStreamer.h"
 #include "SqLog.h"
 
 #define _INTERP
 //#define _LOG
 
 float_4 Streamer::step(float_4 fm, bool fmEnabled) {
-    float_4 ret = 0;
     //SQINFO("St:Step %d, %s", fmEnabled, toStr(fm).c_str());
+    const bool inPlace[4] = {false, false, false, false};
+    return stepFrame(fm, inPlace);
+}
+
+void Streamer::stepBlock(float_4* output, int frames, float_4 fm, bool fmEnabled) {
+    assert(frames > 0);
+
+    // Channels that will stay in the middle of the sample for the whole block
+    // don't need any of the boundary checks.
+    bool inPlace[4];
+    for (int channel = 0; channel < 4; ++channel) {
+        inPlace[channel] = channels[channel].canStepInPlace(frames, fm[channel]);
+    }
+    for (int i = 0; i < frames; ++i) {
+        output[i] = stepFrame(fm, inPlace);
+    }
+}
+
+float_4 Streamer::stepFrame(float_4 fm, const bool* inPlace) {
+    // First each channel finds the four samples around its play position. These may
+    // come from the sample itself or from one of the buffers we use at the boundaries.
+    // Then we transpose them so that all four channels are interpolated at once.
+    float_4 taps[4];
+    float_4 x = 0;
+    float_4 scale = 0;
+    float_4 playing = 0;
+    float streamTaps[4][4];
     for (int channel = 0; channel < 4; ++channel) {
         ChannelData& cd = channels[channel];
 
         assert(!std::isinf(cd.curFloatSampleOffset));
         assert(!std::isinf(cd.transposeMultiplier));
 
-        // if (cd.canPlay()) {
-        if (cd.data) {
-            const bool doInterp = true;  // until we can figure out a way to enable it without pops, we will leave "no transpose" disabled.
-            //const bool doInterp = cd.transposeEnabled || fmEnabled;
-
-            float scalarData = doInterp ? stepTranspose(cd, fm[channel]) : stepNoTranspose(cd);
+        if (inPlace[channel]) {
+            // same as getWindow / advancePointer, without all the checks.
+            const float offset = float(cd.curFloatSampleOffset);
+            const unsigned int index = CubicInterpolator<float>::getIntegerPart(offset);
+            x[channel] = offset - float(index);
+            taps[channel] = float_4::load(cd.data + index - 1);
+            scale[channel] = cd.vol * cd.gain;
+            playing[channel] = 1;
+            cd.curFloatSampleOffset += cd.transposeMultiplier;
+            cd.curFloatSampleOffset += fm[channel];
+            continue;
+        }
 
-            // if we get rid of these dumb balidity checks, then our
-            // unit tests can pump crazy tests data. These never go off anyway.
-#if 0
-            const float acceptable = 1.1f;
-            if (scalarData > acceptable || scalarData < -acceptable) {
-                //SQWARN("bad sample value from step %f", scalarData);
-                //SQWARN("pos = %, %df", cd.curFloatSampleOffset, cd.curIntegerSampleOffset);
-            }
-            assert(scalarData <= acceptable);
-            assert(scalarData >= -acceptable);
-#endif
-            scalarData *= cd.gain;
-            ret[channel] = scalarData;
+        // Now we are called with no data sometimes. Not sure why,
+        // but it certainly seems reasonable to handle it.
+        const float* window = cd.data ? cd.getWindow(x[channel], streamTaps[channel]) : nullptr;
+        if (window) {
+            taps[channel] = float_4::load(window);
+            scale[channel] = cd.vol * cd.gain;
+            playing[channel] = 1;
+            cd.advancePointer(fm[channel]);
         } else {
-            // now we called in this state sometimes. Not sure why,
-            // but it certainly seems reasonable to handle it.
-            ret[channel] = 0;
+            taps[channel] = 0;
         }
     }
-    return ret;
+    _MM_TRANSPOSE4_PS(taps[0].v, taps[1].v, taps[2].v, taps[3].v);
+
+    const float_4 ret = CubicInterpolator<float_4>::interpolateFrac(x, taps[0], taps[1], taps[2], taps[3]) * scale;
+    return SimdBlocks::ifelse(playing > 0, ret, float_4(0));
 }
 
-float Streamer::stepTranspose(ChannelData& cd, float lfm) {
-    assert(cd.curFloatSampleOffset >= 0);
-#ifdef _LOG
-    //SQINFO("in stepTranspose offset=%f cd=%p", cd.curFloatSampleOffset, &cd);
-#endif
-    if (cd.loopActive && (cd.curFloatSampleOffset >= (cd.loopData.loop_end - 2))) {
-        const int dataBufferOffset = 3 - cd.loopData.loop_end;
+bool Streamer::ChannelData::canStepInPlace(int numFrames, float lfm) const {
+    if (!data) {
+        return false;
+    }
+    const double delta = double(transposeMultiplier) + lfm;
+    if (delta < 0) {
+        return false;
+    }
+
+    // Leave a sample of slop at the end, in case float and double round differently.
+    double limit = double(residentFrames) - 3;
+    if (loopActive) {
+        limit = std::min(limit, double(loopData.loop_end) - 3);
+    }
+    const double last = curFloatSampleOffset + delta * numFrames;
+    return (curFloatSampleOffset >= 1) && (last < limit);
+}
+
+/**
+ * returns the four taps around "offset" in buffer, and the fractional part of offset in x.
+ */
+static inline const float* interpolationWindow(const float* buffer, float offset, float& x) {
+    const unsigned int index = CubicInterpolator<float>::getIntegerPart(offset);
+    assert(index >= 1);
+    x = offset - float(index);
+    return buffer + index - 1;
+}
+
+const float* Streamer::ChannelData::getWindow(float& x, float* streamTaps) {
+    assert(curFloatSampleOffset >= 0);
 #ifdef _LOG
-        {
-            int x = CubicInterpolator<float>::getIntegerPart(dataBufferOffset + float(cd.curFloatSampleOffset));
-            //SQINFO("loop, loope end x=%d to %d shift=%d", x - 1, x + 2, dataBufferOffset);
-        }
+    //SQINFO("in getWindow offset=%f cd=%p", curFloatSampleOffset, this);
 #endif
-        float ret = CubicInterpolator<float>::interpolate(cd.loopEndBuffer, float(dataBufferOffset + cd.curFloatSampleOffset));
-        cd.advancePointer(lfm);
-        return ret * cd.vol;
-    } else if (CubicInterpolator<float>::canInterpolate(float(cd.curFloatSampleOffset), cd.frames)) {
+    if (loopActive && (curFloatSampleOffset >= (loopData.loop_end - 2))) {
+        const int dataBufferOffset = 3 - loopData.loop_end;
+        return interpolationWindow(loopEndBuffer, float(dataBufferOffset + curFloatSampleOffset), x);
+    } else if (CubicInterpolator<float>::canInterpolate(float(curFloatSampleOffset), residentFrames)) {
         // common case - interp in place
-#ifdef _LOG
-        {
-            int x = CubicInterpolator<float>::getIntegerPart(float(cd.curFloatSampleOffset));
-            //SQINFO("straight interp, case 1 linear x=%d to %d", x - 1, x + 2);
-        }
-#endif
-        float ret = CubicInterpolator<float>::interpolate(cd.data, float(cd.curFloatSampleOffset));
-        cd.advancePointer(lfm);
-        return ret * cd.vol;
-    } else if (cd.curFloatSampleOffset > (cd.frames - 1)) {
+        return interpolationWindow(data, float(curFloatSampleOffset), x);
+    } else if (curFloatSampleOffset > (frames - 1)) {
         // if not more data, something is wrong - we ran past end.
         // this can happen with transpose is high..
 #ifdef _LOG
-        //SQINFO("ran past end offset=%f frames=%d", cd.curFloatSampleOffset, cd.frames);
+        //SQINFO("ran past end offset=%f frames=%d", curFloatSampleOffset, frames);
 #endif
-        return 0;
-    } else if (cd.curFloatSampleOffset < 1) {
+        return nullptr;
+    } else if (curFloatSampleOffset < 1) {
         // If we are right at the start, we need to use the offset buffer
         // This won't be correct if we are looping
-#ifdef _LOG
-        {
-            int x = CubicInterpolator<float>::getIntegerPart(float(1 + cd.curFloatSampleOffset));
-            //SQINFO("start: offset buffer interp,  x=%d to %d", x - 1, x + 2);
-        }
-#endif
-        float ret = CubicInterpolator<float>::interpolate(cd.offsetBuffer, float(1 + cd.curFloatSampleOffset));
-        cd.advancePointer(lfm);
-        return ret * cd.vol;
-    } else if (cd.loopActive) {
+        return interpolationWindow(offsetBuffer, float(1 + curFloatSampleOffset), x);
+    } else if (loopActive) {
         assert(false);
-    } else if (cd.curFloatSampleOffset >= (cd.frames - 2)) {
-        const float subIndex = float(cd.curFloatSampleOffset - (cd.frames - 3));
+    } else if (stream) {
+        // Past the resident head, so get the samples from the disk stream.
+        // If the data isn't there yet we will get zeros.
+        const unsigned int index = CubicInterpolator<float>::getIntegerPart(float(curFloatSampleOffset));
+        stream->au_setReadFrame(index - 1);
+        stream->au_getFrames(index - 1, frames, streamTaps);
+        x = float(curFloatSampleOffset) - float(index);
+        return streamTaps;
+    } else if (curFloatSampleOffset >= (frames - 2)) {
+        const float subIndex = float(curFloatSampleOffset - (frames - 3));
         assert(subIndex >= 1);
-
-#ifdef _LOG
-        {
-            // int x = CubicInterpolator<float>::getIntegerPart(float(1 + cd.curFloatSampleOffset));
-            int x = CubicInterpolator<float>::getIntegerPart(subIndex);
-            //SQINFO("end buffer interp,  x=%d to %d", x - 1, x + 2);
-        }
-#endif
-        float ret = CubicInterpolator<float>::interpolate(cd.endBuffer, subIndex);
-        cd.advancePointer(lfm);
-        return ret * cd.vol;
+        return interpolationWindow(endBuffer, subIndex, x);
     }
 
-    if (cd.loopActive) {
-        if (cd.loopData.loop_end && cd.curFloatSampleOffset > (cd.loopData.loop_end + 2)) {
-            assert(false);
-            // const unsigned int loop_length = cd.loopData.loop_end - cd.loopData.loop_start;
-            //cd.curFloatSampleOffset -= loop_length;
-            //SQINFO("loop wrap, set offset to %f", cd.curFloatSampleOffset);
-        }
-    }
-    //SQINFO("Stream defaul case offset=%f, total=%d", cd.curFloatSampleOffset, cd.frames);
-    return 0;
+    //SQINFO("Stream defaul case offset=%f, total=%d", curFloatSampleOffset, frames);
+    return nullptr;
 }
 
 void Streamer::ChannelData::advancePointer(float lfm) {
@@ -205,6 +228,12 @@ void Streamer::setGain(int channel, float gain) {
 void Streamer::setSample(int whichChannel, const float* data, int totalFrames) {
     assert(whichChannel < 4);
     ChannelData& cd = channels[whichChannel];
+    if (cd.stream) {
+        cd.stream->au_stop();
+        cd.stream = nullptr;
+        cd.streamWave = nullptr;
+    }
+    cd.residentFrames = std::max(totalFrames, 0);
     if (totalFrames < 4) {
         if (!data) {
             cd.data = data;
@@ -224,6 +253,17 @@ void Streamer::setSample(int whichChannel, const float* data, int totalFrames) {
     assert(cd.frames >= 4);
 }
 
+void Streamer::setStreamedSample(int whichChannel, WaveInfoInterface* wave, const float* data, int residentFrames, int totalFrames, StreamBuffer* stream) {
+    assert(residentFrames >= 4);
+    assert(residentFrames < totalFrames);
+    setSample(whichChannel, data, totalFrames);
+
+    ChannelData& cd = channels[whichChannel];
+    cd.residentFrames = residentFrames;
+    cd.stream = stream;
+    cd.streamWave = wave;
+}
+
 void Streamer::clearSamples() {
     //SQINFO("Streamer::clearSamples()");
     for (int channel = 0; channel < 4; ++channel) {
@@ -235,6 +275,10 @@ void Streamer::clearSamples(int channel) {
     setSample(channel, nullptr, 0);
 }
 
+bool Streamer::isPlaying(int channel) const {
+    return channels[channel].canPlay();
+}
+
 void Streamer::setTranspose(float_4 amount) {
     //SQINFO("Streamer::setTranspose %s", toStr(amount).c_str());
 
@@ -335,6 +379,13 @@ void Streamer::setLoopData(int chan, const CompiledRegion::LoopData& inData) {
     if (outData.end > 1) {
         channels[chan].frames = std::min(outData.end + 1, channels[chan].frames);
     }
+    cd.residentFrames = std::min(cd.residentFrames, cd.frames);
+    if (cd.stream && cd.residentFrames >= cd.frames) {
+        // if "end" cuts it off inside the head we don't need to stream at all
+        cd.stream->au_stop();
+        cd.stream = nullptr;
+        cd.streamWave = nullptr;
+    }
     //channels[chan].loopActive = (data.offset != 0);
     bool valid = false;
     if (outData.loop_start || outData.loop_end) {
@@ -349,6 +400,10 @@ void Streamer::setLoopData(int chan, const CompiledRegion::LoopData& inData) {
     if ((outData.loop_end > 0) && (outData.loop_end <= outData.loop_start)) {
         valid = false;
     }
+    if (cd.stream && (outData.loop_end + 1 >= cd.residentFrames)) {
+        // we can only loop over data that is in memory
+        valid = false;
+    }
     channels[chan].loopActive = valid && sqLooped;
 
     // if offset crazy, ignore it
@@ -364,7 +419,15 @@ void Streamer::setLoopData(int chan, const CompiledRegion::LoopData& inData) {
     cd.endBuffer[3] = 0;
     for (int i = 0; i < 3; ++i) {
         cd.offsetBuffer[i + 1] = cd.data[i];
-        cd.endBuffer[i] = cd.data[i + cd.frames - 3];
+        // when streaming the end comes from the stream buffer, and isn't in memory.
+        cd.endBuffer[i] = cd.stream ? 0 : cd.data[i + cd.frames - 3];
+    }
+
+    if (cd.stream) {
+        // Start the stream a little before the end of the head, so the
+        // interpolator can look back a few samples when it crosses over.
+        const unsigned int firstFrame = std::max(cd.loopData.offset, cd.residentFrames) - 4;
+        cd.stream->au_start(cd.streamWave, firstFrame);
     }
 
     if (cd.loopActive) {
@@ -5,6 +5,9 @@
 #include "CompiledRegion.h"
 #include "SqLog.h"
 
+class StreamBuffer;
+class WaveInfoInterface;
+
 /**
  * This is a four channel streamer.
  * Streamer is the thing that plays out a block of samples, possibly at an
@@ -15,6 +18,12 @@ public:
     Streamer() = default;
     Streamer(const Streamer&) = delete;
     void setSample(int chan, const float* data, int frames);
+
+    /**
+     * Like setSample, but only the first residentFrames of data are in memory.
+     * Frames past that will be pulled from "stream" once setLoopData starts it.
+     */
+    void setStreamedSample(int chan, WaveInfoInterface* wave, const float* data, int residentFrames, int totalFrames, StreamBuffer* stream);
     void setLoopData(int chan, const CompiledRegion::LoopData& data);
 
 
@@ -25,12 +34,20 @@ public:
     void setTranspose(float_4 amount);
     void clearSamples();
     void clearSamples(int channel);
+    bool isPlaying(int channel) const;
     void setGain(int chan, float gain);
 
     /** here "fm" is the linear fm modulation,
      * not the pitch modulation
      */
     float_4 step(float_4 fm, bool fmEnabled);
+
+    /**
+     * Same as calling step "frames" times, with fm held constant.
+     * Cheaper, since the boundary checks are done once per block for
+     * channels that are playing from the middle of their sample.
+     */
+    void stepBlock(float_4* output, int frames, float_4 fm, bool fmEnabled);
     void _assertValid();
 
     bool _isTransposed(int channel) const;
@@ -56,6 +73,18 @@ public:
         const float* data = nullptr;
         unsigned int frames = 0;
 
+        /**
+         * how many frames of data are in memory. Same as frames
+         * unless we are streaming.
+         */
+        unsigned int residentFrames = 0;
+
+        /**
+         * If not null, everything past residentFrames comes from here.
+         */
+        StreamBuffer* stream = nullptr;
+        WaveInfoInterface* streamWave = nullptr;
+
         float vol = 1;  // this will go away when we have envelopes
 
         unsigned int curIntegerSampleOffset = 0;
@@ -79,13 +108,28 @@ public:
         bool loopActive = false;
 
         void _dump() const;
+
+        /**
+         * Finds the four samples around the play position, and puts the fractional
+         * part of the position in x.
+         * @param streamTaps is somewhere to put the samples if they come from the disk stream.
+         * returns nullptr if there is nothing to play, in which case
+         * the caller should not advance the pointer.
+         */
+        const float* getWindow(float& x, float* streamTaps);
+
+        /**
+         * true if the next numFrames can all be interpolated in place
+         * without crossing any loop or end points.
+         */
+        bool canStepInPlace(int numFrames, float lfm) const;
         void advancePointer(float lfm);
         bool canPlay() const;
     };
     ChannelData channels[4];
 
     float stepNoTranspose(ChannelData&);
-    float stepTranspose(ChannelData&, const float lfm);
+    float_4 stepFrame(float_4 fm, const bool* inPlace);
 
     const ChannelData& _cd(int channel) const;
 };
@@ -1,10 +1,17 @@
 
 #include "WaveLoader.h"
+#include "DiskStreamer.h"
+#include "SampleCache.h"
+#include "SampleDiskCache.h"
 #include "SqLog.h"
 
 #include <assert.h>
 #include <algorithm>
 
+WaveLoader::~WaveLoader() {
+    stopWorkers();
+}
+
 void WaveLoader::clear() {
     finalInfo.clear();
 }
@@ -17,42 +24,157 @@ WaveLoader::WaveInfoPtr WaveLoader::getInfo(int index) const {
     return finalInfo[index - 1];
 }
 
-void WaveLoader::addNextSample(const FilePath& fileName) {
+void WaveLoader::addNextSample(const FilePath& fileName, bool mustBeResident) {
     assert(!didLoad);
     filesToLoad.push_back(fileName);
+    filesMustBeResident.push_back(mustBeResident);
     curLoadIndex = 0;
 }
 
+void WaveLoader::setStreaming(bool enable, unsigned int headFrames) {
+    assert(curLoadIndex <= 0);
+    streamHeadFrames = enable ? headFrames : 0;
+}
+
+void WaveLoader::setUseDiskCache(bool enable) {
+    assert(workers.empty());
+    useDiskCache = enable;
+}
+
+void WaveLoader::setNumThreads(unsigned int n) {
+    assert(workers.empty());
+    numThreads = n;
+}
+
 float WaveLoader::getProgressPercent() const {
-    float done = float(curLoadIndex);
+    float done = float(std::max(0, curLoadIndex.load()));
     float total = float(filesToLoad.size());
     return 100 * done / total;
 }
 
 WaveLoader::LoaderState WaveLoader::loadNextFile() {
     assert(curLoadIndex >= 0);
-    if (curLoadIndex >= int(filesToLoad.size())) {
+    if (didLoad) {
         return LoaderState::Done;
     }
+    if (workers.empty()) {
+        if (errorIndex >= 0) {
+            return LoaderState::Error;
+        }
+        startWorkers();
+    }
 
-    FilePath& file = filesToLoad[curLoadIndex];
-    WaveInfoPtr fileLoader = loaderFactory(file);
-    std::string err;
+    {
+        std::unique_lock<std::mutex> lock(loadMutex);
+        const int total = int(filesToLoad.size());
+        loadCondition.wait(lock, [this, total]() {
+            return (runningWorkers == 0) || ((curLoadIndex > reportedLoadIndex) && (curLoadIndex < total));
+        });
+        if (runningWorkers > 0) {
+            reportedLoadIndex = curLoadIndex;
+            return LoaderState::Progress;
+        }
+    }
 
-    const bool b = fileLoader->load(err);
-    if (!b) {
+    // all the workers have exited, so we don't need the lock any more
+    stopWorkers();
+    if (errorIndex >= 0) {
         // bail on first error
-        assert(!err.empty());
-        lastError = err;
+        assert(!loadError.empty());
+        lastError = loadError;
         return LoaderState::Error;
     }
-    
-    finalInfo.push_back(fileLoader);
-    curLoadIndex++;
-    auto ret = curLoadIndex >= int(filesToLoad.size()) ? LoaderState::Done : LoaderState::Progress;
-    if (ret == LoaderState::Done) {
-        didLoad = true;
+
+    assert(curLoadIndex == int(filesToLoad.size()));
+    finalInfo = std::move(loadedInfo);
+    loadedInfo.clear();
+    didLoad = true;
+    startStreamingIfNeeded();
+    return LoaderState::Done;
+}
+
+void WaveLoader::startWorkers() {
+    assert(workers.empty());
+    unsigned int threads = numThreads ? numThreads : std::thread::hardware_concurrency();
+    threads = std::max(1u, std::min(threads, unsigned(filesToLoad.size())));
+
+    loadedInfo.resize(filesToLoad.size());
+    nextJobIndex = 0;
+    runningWorkers = int(threads);
+    for (unsigned int i = 0; i < threads; ++i) {
+        workers.push_back(std::thread([this]() {
+            this->workerFunction();
+        }));
     }
+}
+
+void WaveLoader::stopWorkers() {
+    stopRequested = true;
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+}
+
+void WaveLoader::workerFunction() {
+    const int total = int(filesToLoad.size());
+    for (;;) {
+        if (stopRequested) {
+            break;
+        }
+
+        // Jobs are handed out in order, and a job that is handed out always gets loaded.
+        // So when a file fails, every file before it will still be loaded, and we
+        // report the same error a serial load would.
+        const int index = nextJobIndex++;
+        if (index >= total) {
+            break;
+        }
+
+        const unsigned int headFrames = filesMustBeResident[index] ? 0 : streamHeadFrames;
+        WaveInfoPtr fileLoader = loaderFactory(filesToLoad[index], headFrames, useDiskCache);
+        std::string err;
+        bool b = true;
+        if (!fileLoader->isValid()) {
+            // not from any cache, so we have to decode it
+            b = fileLoader->load(err);
+            if (b && useDiskCache && (headFrames == 0)) {
+                SampleDiskCache::get().store(filesToLoad[index], *fileLoader);
+            }
+        }
+        if (b) {
+            // share it with the other instances. Does nothing if it came from there.
+            fileLoader = SampleCache::get().add(filesToLoad[index], headFrames, fileLoader);
+        }
 
-    return ret;
+        std::lock_guard<std::mutex> lock(loadMutex);
+        if (b) {
+            loadedInfo[index] = fileLoader;
+            curLoadIndex++;
+        } else {
+            // no point loading any more. Keep the error from the earliest file.
+            assert(!err.empty());
+            stopRequested = true;
+            if (errorIndex < 0 || index < errorIndex) {
+                errorIndex = index;
+                loadError = err;
+            }
+        }
+        loadCondition.notify_all();
+    }
+
+    std::lock_guard<std::mutex> lock(loadMutex);
+    --runningWorkers;
+    loadCondition.notify_all();
+}
+
+void WaveLoader::startStreamingIfNeeded() {
+    bool anyStreamed = false;
+    for (auto info : finalInfo) {
+        anyStreamed |= info->isStreamed();
+    }
+    if (anyStreamed) {
+        diskStreamer = std::make_shared<DiskStreamer>();
+        diskStreamer->start();
+    }
 }
@@ -1,12 +1,36 @@
 #pragma once
 
 #include <assert.h>
+#include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 #include "FilePath.h"
 #include <cstdint>
 
+class DiskStreamer;
+
+/**
+ * Sequential reader for one audio file, with seek.
+ * Used by the disk streamer to pull in the parts of a sample
+ * that are not resident. Frames come out already converted to mono.
+ */
+class WaveStreamSource {
+public:
+    virtual ~WaveStreamSource() = default;
+    virtual bool seek(uint64_t frame) = 0;
+
+    /**
+     * returns number of frames read.
+     */
+    virtual unsigned read(float* dest, unsigned frames) = 0;
+};
+
+using WaveStreamSourcePtr = std::unique_ptr<WaveStreamSource>;
+
 // Abstract interface for audio files
 class WaveInfoInterface {
 public:
@@ -17,6 +41,20 @@ public:
     virtual const float* getData() = 0;
     virtual bool load(std::string& errorMsg) = 0;
     virtual std::string getFileName() = 0;
+
+    /**
+     * How many frames at the start of getData() are in memory.
+     * Same as getTotalFrameCount() unless the wave is streamed from disk.
+     */
+    virtual uint64_t getResidentFrameCount() { return getTotalFrameCount(); }
+    bool isStreamed() { return getResidentFrameCount() < getTotalFrameCount(); }
+
+    /**
+     * Opens a new reader on the underlying file.
+     * Only streamed waves need to implement this.
+     * Called from the disk streamer thread.
+     */
+    virtual WaveStreamSourcePtr openStream() { return nullptr; }
 };
 
 class WaveLoader {
@@ -30,10 +68,51 @@ public:
     };
     using WaveInfoPtr = std::shared_ptr<WaveInfoInterface>;
 
+    WaveLoader() = default;
+    ~WaveLoader();
+    WaveLoader(const WaveLoader&) = delete;
+    const WaveLoader& operator=(const WaveLoader&) = delete;
+
     /** Sample files are added one at a time until "all"
      * are loaded.
+     * @param mustBeResident if true the sample will be completely loaded, even in streaming mode.
+     *          Looping needs random access to the whole sample.
+     */
+    void addNextSample(const FilePath& fileName, bool mustBeResident = false);
+
+    /**
+     * In streaming mode only the first headFrames of each sample are loaded.
+     * The rest is read from disk while a voice plays it, so memory use depends
+     * on the number of voices rather than the size of the sample set.
+     * Must be called before loading starts.
+     */
+    void setStreaming(bool enable, unsigned int headFrames = defaultStreamHeadFrames);
+    bool isStreaming() const { return streamHeadFrames > 0; }
+
+    /**
+     * 16k frames is a bit over 1/3 second at 44.1. That gives the disk
+     * streamer plenty of time to open the file and start filling.
+     */
+    static const unsigned int defaultStreamHeadFrames = 16 * 1024;
+
+    /**
+     * Files are decoded in parallel by a pool of this many worker threads.
+     * Zero (the default) means one thread per core.
+     * Must be called before loading starts.
+     */
+    void setNumThreads(unsigned int n);
+
+    /**
+     * If enabled, decoded samples are kept in the SampleDiskCache and
+     * mapped from there next time. Does nothing unless the SampleDiskCache
+     * has a folder. Must be called before loading starts.
      */
-    void addNextSample(const FilePath& fileName);
+    void setUseDiskCache(bool enable);
+
+    /**
+     * will be null unless some of the waves are streamed.
+     */
+    DiskStreamer* getDiskStreamer() const { return diskStreamer.get(); }
 
     /**
      * load() is called one - after all the samples have been added.
@@ -47,9 +126,19 @@ public:
         Progress
     };
 
-    // load up all the registered files
-    
+    /**
+     * The first call starts the worker threads, which load all the registered files.
+     * Each call blocks until at least one more file is done, or until loading
+     * is finished. Returns Progress until then, so the caller can report progress.
+     *
+     * If any files fail, the error returned is the one from the file added first,
+     * same as if they were loaded one at a time.
+     */
     LoaderState loadNextFile();
+
+    /**
+     * May be called from any thread.
+     */
     float getProgressPercent() const;
 
     /**
@@ -65,12 +154,51 @@ private:
    // Tests _testMode = Tests::None;
 
     std::vector<FilePath> filesToLoad;
+    std::vector<bool> filesMustBeResident;
     std::vector<WaveInfoPtr> finalInfo;
-    static WaveInfoPtr loaderFactory(const FilePath& file);
+
+    /**
+     * declared after finalInfo so it gets destroyed first. Its thread
+     * must be stopped before the waves it reads from go away.
+     */
+    std::shared_ptr<DiskStreamer> diskStreamer;
+    unsigned int streamHeadFrames = 0;
+    bool useDiskCache = false;
+
+    /**
+     * Will return an already loaded wave if it's in the SampleCache,
+     * or in the SampleDiskCache if useDiskCache is set.
+     * @param headFrames is the number of frames to load. Zero means load the whole thing.
+     */
+    static WaveInfoPtr loaderFactory(const FilePath& file, unsigned int headFrames, bool useDiskCache);
     void clear();
+    void startStreamingIfNeeded();
     bool didLoad = false;
     void validate();
-    int curLoadIndex = -1;
+
+    /**
+     * Number of files loaded so far, or -1 if none have been added.
+     */
+    std::atomic<int> curLoadIndex = {-1};
+
+    // worker pool state.
+    unsigned int numThreads = 0;
+    std::vector<std::thread> workers;
+    std::atomic<int> nextJobIndex = {0};
+    std::atomic<bool> stopRequested = {false};
+
+    // everything below is guarded by loadMutex
+    std::mutex loadMutex;
+    std::condition_variable loadCondition;
+    std::vector<WaveInfoPtr> loadedInfo;
+    int runningWorkers = 0;
+    int reportedLoadIndex = 0;
+    int errorIndex = -1;
+    std::string loadError;
+
+    void startWorkers();
+    void stopWorkers();
+    void workerFunction();
 };
 
 using WaveLoaderPtr = std::shared_ptr<WaveLoader>;
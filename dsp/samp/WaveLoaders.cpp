@@ -1,5 +1,10 @@
 
+#include <algorithm>
+#include <vector>
+
 #include "FlacReader.h"
+#include "SampleCache.h"
+#include "SampleDiskCache.h"
 #include "SqLog.h"
 #include "WaveLoader.h"
 #include "share/windows_unicode_filenames.h"
@@ -9,9 +14,10 @@
 
 class LoaderBase : public WaveInfoInterface {
 public:
-    LoaderBase(const FilePath& _fp) : fp(_fp) {}
+    LoaderBase(const FilePath& _fp, unsigned int _headFrames = 0) : fp(_fp), headFrames(_headFrames) {}
     unsigned int getSampleRate() override { return sampleRate; }
     uint64_t getTotalFrameCount() override { return totalFrameCount; }
+    uint64_t getResidentFrameCount() override { return streamed ? residentFrameCount : totalFrameCount; }
     const float* getData() override { return data; }
     bool isValid() const override { return valid; }
     std::string getFileName() override { return fp.toString(); }
@@ -20,6 +26,14 @@ protected:
     unsigned int sampleRate = 0;
     uint64_t totalFrameCount = 0;
 
+    /**
+     * If headFrames is not zero, we only load that much
+     * and stream the rest.
+     */
+    const unsigned int headFrames = 0;
+    bool streamed = false;
+    uint64_t residentFrameCount = 0;
+
     // Who owns this data? I think I should own it, and delete it myself. I do,
     // but should I transfer ownership to outer object?
     // Or maybe I should keep it and outer caller gets it to play?
@@ -31,12 +45,36 @@ protected:
 //---------------------------------------------------------------
 class WaveFileLoader : public LoaderBase {
 public:
-    WaveFileLoader(const FilePath& fp) : LoaderBase(fp) {}
+    WaveFileLoader(const FilePath& fp, unsigned int headFrames) : LoaderBase(fp, headFrames) {}
     bool load(std::string& errorMsg) override;
+    WaveStreamSourcePtr openStream() override;
 
 private:
     void convertToMono();
     float* loadData(unsigned& numChannels);  // no format conversion or checking
+    float* loadHead(unsigned& numChannels);  // same, but only the first headFrames
+};
+
+/**
+ * Streams mono frames out of a wave file
+ */
+class WaveFileStreamSource : public WaveStreamSource {
+public:
+    ~WaveFileStreamSource() {
+        if (isOpen) {
+            drwav_uninit(&wav);
+        }
+    }
+    bool open(const FilePath& fp);
+    bool seek(uint64_t frame) override {
+        return drwav_seek_to_pcm_frame(&wav, frame);
+    }
+    unsigned read(float* dest, unsigned frames) override;
+
+private:
+    drwav wav;
+    bool isOpen = false;
+    std::vector<float> interleaved;
 };
 
 #ifdef ARCH_WIN
@@ -50,16 +88,75 @@ float* WaveFileLoader::loadData(unsigned& numChannels) {
     free(widePath);
     return ret;
 }
+
+static bool initWav(drwav& wav, const FilePath& fp) {
+    wchar_t* widePath = wchar_from_utf8(fp.toString().c_str());
+    bool ret = drwav_init_file_w(&wav, widePath, nullptr);
+    free(widePath);
+    return ret;
+}
 #else
 float* WaveFileLoader::loadData(unsigned& numChannels) {
     return drwav_open_file_and_read_pcm_frames_f32(fp.toString().c_str(), &numChannels, &sampleRate, &totalFrameCount, nullptr);
 }
+
+static bool initWav(drwav& wav, const FilePath& fp) {
+    return drwav_init_file(&wav, fp.toString().c_str(), nullptr);
+}
 #endif
 
+float* WaveFileLoader::loadHead(unsigned& numChannels) {
+    drwav wav;
+    if (!initWav(wav, fp)) {
+        return nullptr;
+    }
+    numChannels = wav.channels;
+    sampleRate = wav.sampleRate;
+    totalFrameCount = wav.totalPCMFrameCount;
+    residentFrameCount = std::min(uint64_t(headFrames), totalFrameCount);
+    streamed = residentFrameCount < totalFrameCount;
+
+    float* ret = reinterpret_cast<float*>(DRWAV_MALLOC(residentFrameCount * numChannels * sizeof(float)));
+    const uint64_t framesRead = drwav_read_pcm_frames_f32(&wav, residentFrameCount, ret);
+    drwav_uninit(&wav);
+    if (framesRead != residentFrameCount) {
+        DRWAV_FREE(ret);
+        ret = nullptr;
+    }
+    return ret;
+}
+
+WaveStreamSourcePtr WaveFileLoader::openStream() {
+    WaveFileStreamSource* source = new WaveFileStreamSource();
+    WaveStreamSourcePtr ret(source);
+    if (!source->open(fp)) {
+        ret.reset();
+    }
+    return ret;
+}
+
+bool WaveFileStreamSource::open(const FilePath& fp) {
+    isOpen = initWav(wav, fp);
+    return isOpen && (wav.channels == 1 || wav.channels == 2);
+}
+
+unsigned WaveFileStreamSource::read(float* dest, unsigned frames) {
+    if (wav.channels == 1) {
+        return unsigned(drwav_read_pcm_frames_f32(&wav, frames, dest));
+    }
+
+    interleaved.resize(frames * 2);
+    const unsigned framesRead = unsigned(drwav_read_pcm_frames_f32(&wav, frames, interleaved.data()));
+    for (unsigned i = 0; i < framesRead; ++i) {
+        dest[i] = .5f * (interleaved[i * 2] + interleaved[i * 2 + 1]);
+    }
+    return framesRead;
+}
+
 bool WaveFileLoader::load(std::string& errorMessage) {
     unsigned int numChannels = 0;
 
-    float* pSampleData = loadData(numChannels);
+    float* pSampleData = headFrames ? loadHead(numChannels) : loadData(numChannels);
     if (pSampleData == NULL) {
         // Error opening and reading WAV file.
         errorMessage += "can't open ";
@@ -83,11 +180,12 @@ bool WaveFileLoader::load(std::string& errorMessage) {
 }
 
 void WaveFileLoader::convertToMono() {
-    uint64_t newBufferSize = 1 + totalFrameCount;
+    const uint64_t framesToConvert = getResidentFrameCount();
+    uint64_t newBufferSize = 1 + framesToConvert;
     void* x = DRWAV_MALLOC(newBufferSize * sizeof(float));
     float* dest = reinterpret_cast<float*>(x);
 
-    for (uint64_t outputIndex = 0; outputIndex < totalFrameCount; ++outputIndex) {
+    for (uint64_t outputIndex = 0; outputIndex < framesToConvert; ++outputIndex) {
         float monoSampleValue = 0;
         for (int channelIndex = 0; channelIndex < 2; ++channelIndex) {
             uint64_t inputIndex = outputIndex * 2 + channelIndex;
@@ -104,11 +202,39 @@ void WaveFileLoader::convertToMono() {
 }
 
 //----------------------------------------------------------------
+class FlacFileStreamSource : public WaveStreamSource {
+public:
+    bool open(const FilePath& fp) {
+        return reader.open(fp);
+    }
+    bool seek(uint64_t frame) override {
+        return reader.seek(frame);
+    }
+    unsigned read(float* dest, unsigned frames) override {
+        return reader.read(dest, frames);
+    }
+
+private:
+    FlacStreamReader reader;
+};
+
 class FlacFileLoader : public LoaderBase {
 public:
-    FlacFileLoader(const FilePath& fp) : LoaderBase(fp) {}
+    FlacFileLoader(const FilePath& fp, unsigned int headFrames) : LoaderBase(fp, headFrames) {}
+
+    WaveStreamSourcePtr openStream() override {
+        FlacFileStreamSource* source = new FlacFileStreamSource();
+        WaveStreamSourcePtr ret(source);
+        if (!source->open(fp)) {
+            ret.reset();
+        }
+        return ret;
+    }
 
     bool load(std::string& errorMsg) override {
+        if (headFrames) {
+            return loadHead(errorMsg);
+        }
         reader.read(fp);
         if (reader.ok()) {
             valid = true;
@@ -124,6 +250,24 @@ public:
 
 private:
     FlacReader reader;
+
+    bool loadHead(std::string& errorMsg) {
+        FlacStreamReader headReader;
+        if (headReader.open(fp)) {
+            sampleRate = headReader.getSampleRate();
+            totalFrameCount = headReader.getTotalFrameCount();
+            residentFrameCount = std::min(uint64_t(headFrames), totalFrameCount);
+            streamed = residentFrameCount < totalFrameCount;
+
+            data = reinterpret_cast<float*>(malloc(residentFrameCount * sizeof(float)));
+            if (headReader.read(data, unsigned(residentFrameCount)) == residentFrameCount) {
+                valid = true;
+                return true;
+            }
+        }
+        errorMsg = "can't open " + fp.getFilenamePart();
+        return false;
+    }
 };
 
 //-------------------------------------------
@@ -196,16 +340,28 @@ public:
     }
 };
 
-WaveLoader::WaveInfoPtr WaveLoader::loaderFactory(const FilePath& file) {
-    WaveLoader::WaveInfoPtr loader;
+WaveLoader::WaveInfoPtr WaveLoader::loaderFactory(const FilePath& file, unsigned int headFrames, bool useDiskCache) {
+    // if another Samp already has this file loaded, share it.
+    WaveLoader::WaveInfoPtr loader = SampleCache::get().find(file, headFrames);
+    if (loader) {
+        return loader;
+    }
+
+    // if we decoded it before, map that
+    if (useDiskCache && (headFrames == 0)) {
+        loader = SampleDiskCache::get().find(file);
+        if (loader) {
+            return loader;
+        }
+    }
 
     const std::string extension = file.getExtensionLC();
     assert(extension.find('\n') == extension.npos);
     assert(extension.find('\r') == extension.npos);
     if (extension == "wav") {
-        loader = std::make_shared<WaveFileLoader>(file);
+        loader = std::make_shared<WaveFileLoader>(file, headFrames);
     } else if (extension == "flac") {
-        loader = std::make_shared<FlacFileLoader>(file);
+        loader = std::make_shared<FlacFileLoader>(file, headFrames);
     } else {
         loader = std::make_shared<NullFileLoader>(file);
     }
@@ -87,6 +87,7 @@ private:
 
     int ratioIndex[4] = {0};
     Ratios ratio[4] = {Ratios::HardLimit, Ratios::HardLimit, Ratios::HardLimit, Ratios::HardLimit};
+    float_4 isHardLimit = float_4::mask();      // ratio[i] == HardLimit, as a simd mask
     int maxChannel = 3;
 
     bool cvIsPoly = false;
@@ -114,6 +115,7 @@ private:
 
     float_4 stepPolyMultiMono(float_4, float_4);
     float_4 stepPolyLinked(float_4, float_4);
+    float_4 lookupGainPoly(float_4 envelope) const;
     void setThresholdPolySub(float_4 th);
 };
 
@@ -157,6 +159,8 @@ inline void Cmprsr::setCurve(Ratios r) {
     ratioIndex[1] = int(r);
     ratioIndex[2] = int(r);
     ratioIndex[3] = int(r);
+
+    isHardLimit = (r == Ratios::HardLimit) ? float_4::mask() : float_4::zero();
 }
 
 inline void Cmprsr::setCurvePoly(const Ratios* r) {
@@ -172,6 +176,9 @@ inline void Cmprsr::setCurvePoly(const Ratios* r) {
     ratioIndex[1] = int(r[1]);
     ratioIndex[2] = int(r[2]);
     ratioIndex[3] = int(r[3]);
+
+    const float_4 index = float_4(float(ratioIndex[0]), float(ratioIndex[1]), float(ratioIndex[2]), float(ratioIndex[3]));
+    isHardLimit = (index == float(int(Ratios::HardLimit)));
 }
 
 inline float_4 Cmprsr::step(float_4 input) {
@@ -282,24 +289,20 @@ inline float_4 Cmprsr::stepGeneric(float_4 input) {
         gain_ = SimdBlocks::ifelse(envelope > threshold, reductionGain, 1);
         return gain_ * input;
     } else {
+        const float_4 level = envelope * invThreshold;
 #ifdef _USESPLINE
-        CompCurves::CompCurveLookupPtr table = ratioCurves2[ratioIndex[0]];
+        // all four at once. The unused channels get a gain, too, but no one looks at it.
+        gain_ = ratioCurves2[ratioIndex[0]]->lookup(level);
 #else
         CompCurves::LookupPtr table = ratioCurves[ratioIndex[0]];
-#endif
-        const float_4 level = envelope * invThreshold;
-
         float_4 t = gain_;
         for (int i = 0; i < 4; ++i) {
             if (i <= maxChannel) {
-#ifdef _USESPLINE
-                t[i] = table->lookup(level[i]);
-#else
                 t[i] = CompCurves::lookup(table, level[i]);
-#endif
             }
         }
         gain_ = t;
+#endif
         return gain_ * input;
     }
 }
@@ -373,32 +376,28 @@ inline float_4 Cmprsr::stepPolyLinked(float_4 input, float_4 detectorInput) {
         envelope = rack::simd::sqrt(envelope);
     }
 
+#ifdef _FASTLOOK
+    // each pair uses the settings of its left channel
+    const float_4 gain = lookupGainPoly(envelope);
+    gain_ = float_4(gain[0], gain[0], gain[2], gain[2]);
+#else
     if (ratio[0] == Ratios::HardLimit) {
         gain_[0] = (envelope[0] > threshold[0]) ? threshold[0] / envelope[0] : 1.f;
     } else {
         const float level = envelope[0] * invThreshold[0];
-#ifdef _FASTLOOK
-        CompCurves::CompCurveLookupPtr table = ratioCurves2[ratioIndex[0]];
-        gain_[0] = table->lookup(level);
-#else
         CompCurves::LookupPtr table = ratioCurves[ratioIndex[0]];
         gain_[0] = CompCurves::lookup(table, level);
-#endif
     }
     gain_[1] = gain_[0];
     if (ratio[2] == Ratios::HardLimit) {
         gain_[2] = (envelope[2] > threshold[2]) ? threshold[2] / envelope[2] : 1.f;
     } else {
         const float level = envelope[2] * invThreshold[2];
-#ifdef _FASTLOOK
-        CompCurves::CompCurveLookupPtr table = ratioCurves2[ratioIndex[2]];
-        gain_[2] = table->lookup(level);
-#else
         CompCurves::LookupPtr table = ratioCurves[ratioIndex[2]];
         gain_[2] = CompCurves::lookup(table, level);
-#endif
     }
     gain_[3] = gain_[2];
+#endif
     return gain_ * input;
 }
 
@@ -414,26 +413,40 @@ inline float_4 Cmprsr::stepPolyMultiMono(float_4 input, float_4 detectorInput) {
         envelope = rack::simd::sqrt(envelope);
     }
 
-    // have to do the rest non-simd - in case the curves are all different.
-    // TODO: optimized case for all curves the same
+#ifdef _FASTLOOK
+    gain_ = lookupGainPoly(envelope);
+#else
     for (int iChan = 0; iChan < 4; ++iChan) {
         if (ratio[iChan] == Ratios::HardLimit) {
-            // const float reductionGain = threshold[iChan] / envelope[iChan];
             gain_[iChan] = (envelope[iChan] > threshold[iChan]) ? threshold[iChan] / envelope[iChan] : 1.f;
         } else {
             const float level = envelope[iChan] * invThreshold[iChan];
-#ifdef _FASTLOOK
-            CompCurves::CompCurveLookupPtr table = ratioCurves2[ratioIndex[iChan]];
-            gain_[iChan] = table->lookup(level);
-#else
             CompCurves::LookupPtr table = ratioCurves[ratioIndex[iChan]];
             gain_[iChan] = CompCurves::lookup(table, level);
-#endif
         }
     }
+#endif
     return gain_ * input;
 }
 
+#ifdef _FASTLOOK
+/**
+ * The gain computer for four channels at once. The curves may all be different.
+ * Hard limit channels still do a curve lookup, and then throw it away.
+ */
+inline float_4 Cmprsr::lookupGainPoly(float_4 envelope) const {
+    const CompCurves::CompCurveLookup* const curves[4] = {
+        ratioCurves2[ratioIndex[0]].get(),
+        ratioCurves2[ratioIndex[1]].get(),
+        ratioCurves2[ratioIndex[2]].get(),
+        ratioCurves2[ratioIndex[3]].get()};
+
+    const float_4 curveGain = CompCurves::CompCurveLookup::lookup(curves, envelope * invThreshold);
+    const float_4 limitGain = SimdBlocks::ifelse(envelope > threshold, threshold / envelope, 1);
+    return SimdBlocks::ifelse(isHardLimit, limitGain, curveGain);
+}
+#endif
+
 inline void Cmprsr::setTimesPoly(float_4 attackMs, float_4 releaseMs, float sampleTime) {
     assert(polySet);
     assert(cvIsPoly);
@@ -1,5 +1,6 @@
 #include "SplineRenderer.h"
 #include "CompCurves.h"
+#include "SimdBlocks.h"
 
 #include <functional>
 
@@ -178,6 +179,24 @@ float CompCurves::CompCurveLookup::lookup(float x) const {
     return LookupTable<T>::lookup(highRange, x, true);
 }
 
+float_4 CompCurves::CompCurveLookup::lookup(float_4 x) const {
+    const CompCurveLookup* const curves[4] = {this, this, this, this};
+    return lookup(curves, x);
+}
+
+float_4 CompCurves::CompCurveLookup::lookup(const CompCurveLookup* const curves[4], float_4 x) {
+    // pick the low or high table for each lane, then do one lookup for all of them.
+    const LookupTableParams<T>* tables[4];
+    for (int i = 0; i < 4; ++i) {
+        const CompCurveLookup* curve = curves[i];
+        tables[i] = (x[i] < curve->dividingLine) ? &curve->lowRange : &curve->highRange;
+    }
+    const float_4 bottomOfKnee(curves[0]->bottomOfKneeVin, curves[1]->bottomOfKneeVin,
+                               curves[2]->bottomOfKneeVin, curves[3]->bottomOfKneeVin);
+    const float_4 gain = LookupTable<T>::lookup(tables, x);
+    return SimdBlocks::ifelse(x <= bottomOfKnee, 1, gain);
+}
+
 std::function<float(float)> CompCurves::getLambda(const Recipe& r, Type t) {
     std::function<float(float)> ret;
 
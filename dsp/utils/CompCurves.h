@@ -47,6 +47,17 @@ public:
     public:
         friend class CompCurves;
         float lookup(float) const;
+
+        /**
+         * Four lookups into this curve.
+         */
+        float_4 lookup(float_4) const;
+
+        /**
+         * Four lookups, where each lane may use a different curve.
+         * Same results as the scalar lookup, but with no branches.
+         */
+        static float_4 lookup(const CompCurveLookup* const curves[4], float_4 x);
         void _dump() const;
     private:
         LookupTableParams<T> lowRange;
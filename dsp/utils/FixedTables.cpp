@@ -0,0 +1,1142 @@
+
+#include "FixedTables.h"
+#include "ObjectCache.h"
+
+#include <assert.h>
+#include <stdio.h>
+
+#include <atomic>
+#include <iomanip>
+#include <locale>
+#include <sstream>
+
+/**
+ * Everything we need to know about one generated table.
+ */
+struct FixedTableData
+{
+    const float* entries;
+    int numBins;
+    float a;
+    float b;
+    float xMin;
+    float xMax;
+};
+
+extern const FixedTableData fixedTableData[int(FixedTables::Table::NUM_TABLES)];
+
+static std::atomic<bool> fixedTablesEnabled = {true};
+
+bool FixedTables::init(LookupTableParams<float>& params, Table table)
+{
+    if (!fixedTablesEnabled) {
+        return false;
+    }
+    const FixedTableData& data = fixedTableData[int(table)];
+    params.initFixed(data.entries, data.numBins, data.a, data.b, data.xMin, data.xMax);
+    assert(params.isValid());
+    return true;
+}
+
+void FixedTables::_setEnabled(bool enabled)
+{
+    fixedTablesEnabled = enabled;
+}
+
+const char* FixedTables::getName(Table table)
+{
+    switch (table) {
+        case Table::AudioTaper:
+            return "audioTaper";
+        case Table::AudioTaper18:
+            return "audioTaper18";
+        case Table::BipolarAudioTaper:
+            return "bipolarAudioTaper";
+        case Table::BipolarAudioTaper30:
+            return "bipolarAudioTaper30";
+        case Table::BipolarAudioTaper42:
+            return "bipolarAudioTaper42";
+        case Table::Sin:
+            return "sin";
+        case Table::MixerPanL:
+            return "mixerPanL";
+        case Table::MixerPanR:
+            return "mixerPanR";
+        case Table::Exp2:
+            return "exp2";
+        case Table::Exp2ExLow:
+            return "exp2ExLow";
+        case Table::Exp2ExHigh:
+            return "exp2ExHigh";
+        case Table::Db2Gain:
+            return "db2Gain";
+        case Table::Tanh5:
+            return "tanh5";
+        case Table::NUM_TABLES:
+            break;
+    }
+    assert(false);
+    return "";
+}
+
+static std::shared_ptr<LookupTableParams<float>> getFromCache(FixedTables::Table table)
+{
+    using Table = FixedTables::Table;
+    switch (table) {
+        case Table::AudioTaper:
+            return ObjectCache<float>::getAudioTaper();
+        case Table::AudioTaper18:
+            return ObjectCache<float>::getAudioTaper18();
+        case Table::BipolarAudioTaper:
+            return ObjectCache<float>::getBipolarAudioTaper();
+        case Table::BipolarAudioTaper30:
+            return ObjectCache<float>::getBipolarAudioTaper30();
+        case Table::BipolarAudioTaper42:
+            return ObjectCache<float>::getBipolarAudioTaper42();
+        case Table::Sin:
+            return ObjectCache<float>::getSinLookup();
+        case Table::MixerPanL:
+            return ObjectCache<float>::getMixerPanL();
+        case Table::MixerPanR:
+            return ObjectCache<float>::getMixerPanR();
+        case Table::Exp2:
+            return ObjectCache<float>::getExp2();
+        case Table::Exp2ExLow:
+            return ObjectCache<float>::getExp2ExtendedLow();
+        case Table::Exp2ExHigh:
+            return ObjectCache<float>::getExp2ExtendedHigh();
+        case Table::Db2Gain:
+            return ObjectCache<float>::getDb2Gain();
+        case Table::Tanh5:
+            return ObjectCache<float>::getTanh5();
+        case Table::NUM_TABLES:
+            break;
+    }
+    assert(false);
+    return nullptr;
+}
+
+/**
+ * Empties the cache before and after, so the table we get is built now,
+ * and no one else gets it.
+ */
+std::shared_ptr<LookupTableParams<float>> FixedTables::makeAtRunTime(Table table)
+{
+    const bool wasEnabled = fixedTablesEnabled;
+    _setEnabled(false);
+    ObjectCache<float>::_reset();
+    auto ret = getFromCache(table);
+    ObjectCache<float>::_reset();
+    _setEnabled(wasEnabled);
+    assert(ret->ownsEntries);
+    return ret;
+}
+
+/**
+ * Nine digits is enough to get back exactly the same float.
+ * The stream is always in the "C" locale: the test program sets one that
+ * uses ',' for the decimal point.
+ */
+static std::string toString(float x)
+{
+    std::ostringstream s;
+    s.imbue(std::locale::classic());
+    s << std::scientific << std::setprecision(9) << x << "f";
+    return s.str();
+}
+
+void FixedTables::gen()
+{
+    const int numTables = int(Table::NUM_TABLES);
+    std::shared_ptr<LookupTableParams<float>> tables[numTables];
+
+    printf("// generated by FixedTables::gen()\n\n");
+    for (int i = 0; i < numTables; ++i) {
+        const Table table = Table(i);
+        tables[i] = makeAtRunTime(table);
+        const LookupTableParams<float>& params = *tables[i];
+        const int numEntries = 2 * (params.numBins_i + 1);
+
+        printf("static const float %sEntries[%d] = {\n", getName(table), numEntries);
+        for (int j = 0; j < numEntries; ++j) {
+            printf("%s%s", toString(params.entries[j]).c_str(), (j == numEntries - 1) ? "\n" : ",");
+            if ((j % 8) == 7 && j != numEntries - 1) {
+                printf("\n");
+            }
+        }
+        printf("};\n\n");
+    }
+
+    printf("const FixedTableData fixedTableData[%d] = {\n", numTables);
+    for (int i = 0; i < numTables; ++i) {
+        const LookupTableParams<float>& params = *tables[i];
+        printf("    {%sEntries, %d, %s, %s, %s, %s},\n",
+               getName(Table(i)),
+               params.numBins_i,
+               toString(params.a).c_str(),
+               toString(params.b).c_str(),
+               toString(params.xMin).c_str(),
+               toString(params.xMax).c_str());
+    }
+    printf("};\n");
+    fflush(stdout);
+}
+
+
+// generated by FixedTables::gen()
+
+static const float audioTaperEntries[66] = {
+0.000000000e+00f,7.886966690e-03f,7.886966690e-03f,7.886966690e-03f,1.577393338e-02f,7.886966690e-03f,2.366090007e-02f,7.886966690e-03f,
+3.154786676e-02f,7.886966690e-03f,3.943483531e-02f,7.886966690e-03f,4.732180014e-02f,7.886966690e-03f,5.520876870e-02f,7.886966690e-03f,
+6.309573352e-02f,7.698844187e-03f,7.079457492e-02f,8.638245054e-03f,7.943282276e-02f,9.692270309e-03f,8.912509680e-02f,1.087490655e-02f,
+1.000000015e-01f,1.220184565e-02f,1.122018471e-01f,1.369069610e-02f,1.258925349e-01f,1.536121313e-02f,1.412537545e-01f,1.723556407e-02f,
+1.584893167e-01f,1.933862083e-02f,1.778279394e-01f,2.169829048e-02f,1.995262355e-01f,2.434588224e-02f,2.238721102e-01f,2.731652930e-02f,
+2.511886358e-01f,3.064965084e-02f,2.818382978e-01f,3.438947350e-02f,3.162277639e-01f,3.858562186e-02f,3.548133969e-01f,4.329378158e-02f,
+3.981071711e-01f,4.857642204e-02f,4.466835856e-01f,5.450364202e-02f,5.011872053e-01f,6.115408987e-02f,5.623413324e-01f,6.861601770e-02f,
+6.309573650e-01f,7.698843628e-02f,7.079457641e-01f,8.638244867e-02f,7.943282127e-01f,9.692270309e-02f,8.912509084e-01f,1.087490618e-01f,
+1.000000000e+00f,1.220184565e-01f
+};
+
+static const float audioTaper18Entries[66] = {
+0.000000000e+00f,1.573656686e-02f,1.573656686e-02f,1.573656686e-02f,3.147313371e-02f,1.573656686e-02f,4.720970243e-02f,1.573656686e-02f,
+6.294626743e-02f,1.573656686e-02f,7.868283987e-02f,1.573656686e-02f,9.441940486e-02f,1.573656686e-02f,1.101559699e-01f,1.573656686e-02f,
+1.258925349e-01f,1.135355514e-02f,1.372461021e-01f,1.237746980e-02f,1.496235728e-01f,1.349372510e-02f,1.631172895e-01f,1.471064985e-02f,
+1.778279394e-01f,1.603732258e-02f,1.938652694e-01f,1.748364046e-02f,2.113489062e-01f,1.906039380e-02f,2.304092944e-01f,2.077934518e-02f,
+2.511886358e-01f,2.265332080e-02f,2.738419771e-01f,2.469629794e-02f,2.985382676e-01f,2.692352235e-02f,3.254617751e-01f,2.935160510e-02f,
+3.548133969e-01f,3.199866414e-02f,3.868120611e-01f,3.488444909e-02f,4.216965139e-01f,3.803048655e-02f,4.597269893e-01f,4.146024585e-02f,
+5.011872053e-01f,4.519931599e-02f,5.463865399e-01f,4.927559197e-02f,5.956621170e-01f,5.371948704e-02f,6.493816376e-01f,5.856415257e-02f,
+7.079457641e-01f,6.384573132e-02f,7.717915177e-01f,6.960362941e-02f,8.413951397e-01f,7.588079572e-02f,9.172759056e-01f,8.272406459e-02f,
+1.000000000e+00f,9.018449485e-02f
+};
+
+static const float bipolarAudioTaperEntries[66] = {
+-1.000000000e+00f,2.056717724e-01f,-7.943282127e-01f,1.633708924e-01f,-6.309573650e-01f,1.297701150e-01f,-5.011872053e-01f,1.030800641e-01f,
+-3.981071711e-01f,8.187940717e-02f,-3.162277639e-01f,6.503912061e-02f,-2.511886358e-01f,5.166241154e-02f,-1.995262355e-01f,4.103691131e-02f,
+-1.584893167e-01f,3.259677812e-02f,-1.258925349e-01f,2.589254081e-02f,-1.000000015e-01f,2.056717686e-02f,-7.943282276e-02f,1.633708924e-02f,
+-6.309573352e-02f,1.577393338e-02f,-4.732180014e-02f,1.577393338e-02f,-3.154786676e-02f,1.577393338e-02f,-1.577393338e-02f,1.577393338e-02f,
+0.000000000e+00f,1.577393338e-02f,1.577393338e-02f,1.577393338e-02f,3.154786676e-02f,1.577393338e-02f,4.732180014e-02f,1.577393338e-02f,
+6.309573352e-02f,1.633708924e-02f,7.943282276e-02f,2.056717686e-02f,1.000000015e-01f,2.589254081e-02f,1.258925349e-01f,3.259677812e-02f,
+1.584893167e-01f,4.103691131e-02f,1.995262355e-01f,5.166241154e-02f,2.511886358e-01f,6.503912061e-02f,3.162277639e-01f,8.187940717e-02f,
+3.981071711e-01f,1.030800641e-01f,5.011872053e-01f,1.297701150e-01f,6.309573650e-01f,1.633708924e-01f,7.943282127e-01f,2.056717724e-01f,
+1.000000000e+00f,2.589254081e-01f
+};
+
+static const float bipolarAudioTaper30Entries[66] = {
+-1.000000000e+00f,2.501057982e-01f,-7.498942018e-01f,1.875528842e-01f,-5.623413324e-01f,1.406448185e-01f,-4.216965139e-01f,1.054687351e-01f,
+-3.162277639e-01f,7.909039408e-02f,-2.371373773e-01f,5.930943042e-02f,-1.778279394e-01f,4.447579756e-02f,-1.333521456e-01f,3.335214406e-02f,
+-1.000000015e-01f,2.501057833e-02f,-7.498942316e-02f,1.875528879e-02f,-5.623413250e-02f,1.406448241e-02f,-4.216964915e-02f,1.054687332e-02f,
+-3.162277490e-02f,7.905693725e-03f,-2.371708304e-02f,7.905693725e-03f,-1.581138745e-02f,7.905693725e-03f,-7.905693725e-03f,7.905693725e-03f,
+0.000000000e+00f,7.905693725e-03f,7.905693725e-03f,7.905693725e-03f,1.581138745e-02f,7.905693725e-03f,2.371708304e-02f,7.905693725e-03f,
+3.162277490e-02f,1.054687332e-02f,4.216964915e-02f,1.406448241e-02f,5.623413250e-02f,1.875528879e-02f,7.498942316e-02f,2.501057833e-02f,
+1.000000015e-01f,3.335214406e-02f,1.333521456e-01f,4.447579756e-02f,1.778279394e-01f,5.930943042e-02f,2.371373773e-01f,7.909039408e-02f,
+3.162277639e-01f,1.054687351e-01f,4.216965139e-01f,1.406448185e-01f,5.623413324e-01f,1.875528842e-01f,7.498942018e-01f,2.501057982e-01f,
+1.000000000e+00f,3.335214257e-01f
+};
+
+static const float bipolarAudioTaper42Entries[66] = {
+-1.000000000e+00f,3.316560686e-01f,-6.683439016e-01f,2.216603309e-01f,-4.466835856e-01f,1.481453329e-01f,-2.985382676e-01f,9.901203215e-02f,
+-1.995262355e-01f,6.617408991e-02f,-1.333521456e-01f,4.422704875e-02f,-8.912509680e-02f,2.955888025e-02f,-5.956621468e-02f,1.975549757e-02f,
+-3.981071711e-02f,1.320346631e-02f,-2.660725079e-02f,8.824456483e-03f,-1.778279431e-02f,5.897772033e-03f,-1.188502181e-02f,3.941739909e-03f,
+-7.943281904e-03f,1.985820476e-03f,-5.957461894e-03f,1.985820476e-03f,-3.971640952e-03f,1.985820476e-03f,-1.985820476e-03f,1.985820476e-03f,
+0.000000000e+00f,1.985820476e-03f,1.985820476e-03f,1.985820476e-03f,3.971640952e-03f,1.985820476e-03f,5.957461894e-03f,1.985820476e-03f,
+7.943281904e-03f,3.941739909e-03f,1.188502181e-02f,5.897772033e-03f,1.778279431e-02f,8.824456483e-03f,2.660725079e-02f,1.320346631e-02f,
+3.981071711e-02f,1.975549757e-02f,5.956621468e-02f,2.955888025e-02f,8.912509680e-02f,4.422704875e-02f,1.333521456e-01f,6.617408991e-02f,
+1.995262355e-01f,9.901203215e-02f,2.985382676e-01f,1.481453329e-01f,4.466835856e-01f,2.216603309e-01f,6.683439016e-01f,3.316560686e-01f,
+1.000000000e+00f,4.962356687e-01f
+};
+
+static const float sinEntries[4098] = {
+0.000000000e+00f,3.067956772e-03f,3.067956772e-03f,3.067927901e-03f,6.135884672e-03f,3.067870159e-03f,9.203754365e-03f,3.067783546e-03f,
+1.227153838e-02f,3.067668062e-03f,1.533920597e-02f,3.067523707e-03f,1.840673015e-02f,3.067350481e-03f,2.147408016e-02f,3.067148151e-03f,
+2.454122901e-02f,3.066917183e-03f,2.760814503e-02f,3.066657344e-03f,3.067480400e-02f,3.066368634e-03f,3.374117240e-02f,3.066051053e-03f,
+3.680722415e-02f,3.065704601e-03f,3.987292573e-02f,3.065329278e-03f,4.293825850e-02f,3.064925084e-03f,4.600318149e-02f,3.064492252e-03f,
+4.906767607e-02f,3.064030316e-03f,5.213170499e-02f,3.063539742e-03f,5.519524589e-02f,3.063020064e-03f,5.825826526e-02f,3.062471747e-03f,
+6.132073700e-02f,3.061894560e-03f,6.438262761e-02f,3.061288735e-03f,6.744392216e-02f,3.060653806e-03f,7.050457597e-02f,3.059990238e-03f,
+7.356456667e-02f,3.059297800e-03f,7.662386447e-02f,3.058576491e-03f,7.968243957e-02f,3.057826543e-03f,8.274026215e-02f,3.057047725e-03f,
+8.579730988e-02f,3.056240268e-03f,8.885355294e-02f,3.055403940e-03f,9.190895408e-02f,3.054538742e-03f,9.496349841e-02f,3.053644905e-03f,
+9.801714122e-02f,3.052722430e-03f,1.010698602e-01f,3.051771084e-03f,1.041216329e-01f,3.050791100e-03f,1.071724221e-01f,3.049782244e-03f,
+1.102222055e-01f,3.048744984e-03f,1.132709533e-01f,3.047678620e-03f,1.163186282e-01f,3.046583850e-03f,1.193652153e-01f,3.045460442e-03f,
+1.224106774e-01f,3.044308163e-03f,1.254549772e-01f,3.043127479e-03f,1.284981072e-01f,3.041917924e-03f,1.315400302e-01f,3.040679730e-03f,
+1.345807016e-01f,3.039413132e-03f,1.376201212e-01f,3.038117662e-03f,1.406582445e-01f,3.036793787e-03f,1.436950266e-01f,3.035441274e-03f,
+1.467304677e-01f,3.034060122e-03f,1.497645378e-01f,3.032650566e-03f,1.527971923e-01f,3.031212371e-03f,1.558284014e-01f,3.029745771e-03f,
+1.588581502e-01f,3.028250532e-03f,1.618863940e-01f,3.026726656e-03f,1.649131179e-01f,3.025174374e-03f,1.679382920e-01f,3.023593687e-03f,
+1.709618866e-01f,3.021984594e-03f,1.739838719e-01f,3.020347096e-03f,1.770042181e-01f,3.018680960e-03f,1.800228953e-01f,3.016986651e-03f,
+1.830398887e-01f,3.015263705e-03f,1.860551536e-01f,3.013512585e-03f,1.890686601e-01f,3.011732828e-03f,1.920803934e-01f,3.009924898e-03f,
+1.950903237e-01f,3.008088795e-03f,1.980984062e-01f,3.006224055e-03f,2.011046410e-01f,3.004331142e-03f,2.041089684e-01f,3.002410056e-03f,
+2.071113735e-01f,3.000460798e-03f,2.101118416e-01f,2.998483134e-03f,2.131103128e-01f,2.996477066e-03f,2.161068022e-01f,2.994443057e-03f,
+2.191012353e-01f,2.992380876e-03f,2.220936269e-01f,2.990290290e-03f,2.250839174e-01f,2.988171764e-03f,2.280720770e-01f,2.986025065e-03f,
+2.310581058e-01f,2.983850194e-03f,2.340419590e-01f,2.981647383e-03f,2.370236069e-01f,2.979416400e-03f,2.400030196e-01f,2.977157477e-03f,
+2.429801822e-01f,2.974870382e-03f,2.459550500e-01f,2.972555347e-03f,2.489276081e-01f,2.970212372e-03f,2.518978119e-01f,2.967841458e-03f,
+2.548656464e-01f,2.965442603e-03f,2.578310966e-01f,2.963015810e-03f,2.607941031e-01f,2.960561076e-03f,2.637546659e-01f,2.958078403e-03f,
+2.667127550e-01f,2.955568023e-03f,2.696683109e-01f,2.953029936e-03f,2.726213634e-01f,2.950463910e-03f,2.755718231e-01f,2.947870176e-03f,
+2.785196900e-01f,2.945248503e-03f,2.814649343e-01f,2.942599356e-03f,2.844075263e-01f,2.939922269e-03f,2.873474658e-01f,2.937217709e-03f,
+2.902846634e-01f,2.934485441e-03f,2.932191491e-01f,2.931725467e-03f,2.961508930e-01f,2.928938018e-03f,2.990798354e-01f,2.926123096e-03f,
+3.020059466e-01f,2.923280466e-03f,3.049292266e-01f,2.920410363e-03f,3.078496456e-01f,2.917512786e-03f,3.107671440e-01f,2.914587734e-03f,
+3.136817515e-01f,2.911635209e-03f,3.165933788e-01f,2.908655209e-03f,3.195020258e-01f,2.905647969e-03f,3.224076927e-01f,2.902613254e-03f,
+3.253102899e-01f,2.899551531e-03f,3.282098472e-01f,2.896462101e-03f,3.311063051e-01f,2.893345663e-03f,3.339996636e-01f,2.890201984e-03f,
+3.368898630e-01f,2.887031063e-03f,3.397768736e-01f,2.883832902e-03f,3.426607251e-01f,2.880607732e-03f,3.455413282e-01f,2.877355320e-03f,
+3.484186828e-01f,2.874075901e-03f,3.512927592e-01f,2.870769240e-03f,3.541635275e-01f,2.867435804e-03f,3.570309579e-01f,2.864075359e-03f,
+3.598950505e-01f,2.860687906e-03f,3.627557158e-01f,2.857273445e-03f,3.656129837e-01f,2.853832208e-03f,3.684668243e-01f,2.850363962e-03f,
+3.713172078e-01f,2.846868942e-03f,3.741640747e-01f,2.843347145e-03f,3.770074248e-01f,2.839798806e-03f,3.798471987e-01f,2.836223459e-03f,
+3.826834261e-01f,2.832621569e-03f,3.855160475e-01f,2.828992903e-03f,3.883450329e-01f,2.825337695e-03f,3.911703825e-01f,2.821655711e-03f,
+3.939920366e-01f,2.817947417e-03f,3.968099952e-01f,2.814212348e-03f,3.996241987e-01f,2.810450969e-03f,4.024346471e-01f,2.806663048e-03f,
+4.052413106e-01f,2.802848816e-03f,4.080441594e-01f,2.799008274e-03f,4.108431637e-01f,2.795141190e-03f,4.136383235e-01f,2.791247796e-03f,
+4.164295495e-01f,2.787328325e-03f,4.192169011e-01f,2.783382544e-03f,4.220002592e-01f,2.779410454e-03f,4.247796834e-01f,2.775412286e-03f,
+4.275550842e-01f,2.771387808e-03f,4.303264916e-01f,2.767337486e-03f,4.330938160e-01f,2.763261087e-03f,4.358570874e-01f,2.759158611e-03f,
+4.386162460e-01f,2.755030291e-03f,4.413712621e-01f,2.750875894e-03f,4.441221356e-01f,2.746695653e-03f,4.468688369e-01f,2.742489567e-03f,
+4.496113360e-01f,2.738257637e-03f,4.523495734e-01f,2.733999863e-03f,4.550835788e-01f,2.729716478e-03f,4.578132927e-01f,2.725407248e-03f,
+4.605387151e-01f,2.721072640e-03f,4.632597864e-01f,2.716712188e-03f,4.659765065e-01f,2.712326357e-03f,4.686888158e-01f,2.707914682e-03f,
+4.713967443e-01f,2.703477861e-03f,4.741002023e-01f,2.699015429e-03f,4.767992198e-01f,2.694527619e-03f,4.794937670e-01f,2.690014429e-03f,
+4.821837842e-01f,2.685475862e-03f,4.848692417e-01f,2.680912148e-03f,4.875501692e-01f,2.676323056e-03f,4.902264774e-01f,2.671709051e-03f,
+4.928981960e-01f,2.667069668e-03f,4.955652654e-01f,2.662405139e-03f,4.982276559e-01f,2.657715697e-03f,5.008853674e-01f,2.653001109e-03f,
+5.035383701e-01f,2.648261609e-03f,5.061866641e-01f,2.643497195e-03f,5.088301301e-01f,2.638707869e-03f,5.114688277e-01f,2.633893862e-03f,
+5.141027570e-01f,2.629054710e-03f,5.167317986e-01f,2.624191111e-03f,5.193560123e-01f,2.619302832e-03f,5.219752789e-01f,2.614389639e-03f,
+5.245896578e-01f,2.609452000e-03f,5.271991491e-01f,2.604489913e-03f,5.298036337e-01f,2.599503146e-03f,5.324031115e-01f,2.594491933e-03f,
+5.349976420e-01f,2.589456504e-03f,5.375870466e-01f,2.584396396e-03f,5.401714444e-01f,2.579312073e-03f,5.427507758e-01f,2.574203536e-03f,
+5.453249812e-01f,2.569070784e-03f,5.478940606e-01f,2.563913818e-03f,5.504579544e-01f,2.558732638e-03f,5.530167222e-01f,2.553527476e-03f,
+5.555702448e-01f,2.548298100e-03f,5.581185222e-01f,2.543044975e-03f,5.606615543e-01f,2.537767868e-03f,5.631993413e-01f,2.532466780e-03f,
+5.657318234e-01f,2.527141944e-03f,5.682589412e-01f,2.521793125e-03f,5.707807541e-01f,2.516420791e-03f,5.732971430e-01f,2.511024708e-03f,
+5.758081675e-01f,2.505605109e-03f,5.783137679e-01f,2.500161761e-03f,5.808139443e-01f,2.494694898e-03f,5.833086371e-01f,2.489204518e-03f,
+5.857978463e-01f,2.483690856e-03f,5.882815719e-01f,2.478153678e-03f,5.907596946e-01f,2.472593216e-03f,5.932322741e-01f,2.467009472e-03f,
+5.956993103e-01f,2.461402444e-03f,5.981606841e-01f,2.455772366e-03f,6.006164551e-01f,2.450119238e-03f,6.030666232e-01f,2.444442827e-03f,
+6.055110693e-01f,2.438743599e-03f,6.079497933e-01f,2.433021320e-03f,6.103827953e-01f,2.427276224e-03f,6.128100753e-01f,2.421508078e-03f,
+6.152315736e-01f,2.415717347e-03f,6.176472902e-01f,2.409903798e-03f,6.200572252e-01f,2.404067665e-03f,6.224612594e-01f,2.398208715e-03f,
+6.248595119e-01f,2.392327413e-03f,6.272518039e-01f,2.386423526e-03f,6.296382546e-01f,2.380497055e-03f,6.320187449e-01f,2.374548232e-03f,
+6.343932748e-01f,2.368577057e-03f,6.367618442e-01f,2.362583531e-03f,6.391244531e-01f,2.356567886e-03f,6.414810419e-01f,2.350530121e-03f,
+6.438315511e-01f,2.344470005e-03f,6.461760402e-01f,2.338388003e-03f,6.485143900e-01f,2.332283882e-03f,6.508466601e-01f,2.326157875e-03f,
+6.531728506e-01f,2.320009982e-03f,6.554928422e-01f,2.313840203e-03f,6.578066945e-01f,2.307648771e-03f,6.601143479e-01f,2.301435452e-03f,
+6.624158025e-01f,2.295200713e-03f,6.647109985e-01f,2.288944088e-03f,6.669999361e-01f,2.282666042e-03f,6.692826152e-01f,2.276366577e-03f,
+6.715589762e-01f,2.270045457e-03f,6.738290191e-01f,2.263703151e-03f,6.760926843e-01f,2.257339656e-03f,6.783500314e-01f,2.250954742e-03f,
+6.806010008e-01f,2.244548639e-03f,6.828455329e-01f,2.238121349e-03f,6.850836873e-01f,2.231673105e-03f,6.873153448e-01f,2.225203905e-03f,
+6.895405650e-01f,2.218713518e-03f,6.917592287e-01f,2.212202409e-03f,6.939714551e-01f,2.205670578e-03f,6.961771250e-01f,2.199118026e-03f,
+6.983762383e-01f,2.192544518e-03f,7.005687952e-01f,2.185950521e-03f,7.027547359e-01f,2.179335803e-03f,7.049340606e-01f,2.172700828e-03f,
+7.071067691e-01f,2.166045364e-03f,7.092728019e-01f,2.159369411e-03f,7.114322186e-01f,2.152672969e-03f,7.135848403e-01f,2.145956503e-03f,
+7.157308459e-01f,2.139219781e-03f,7.178700566e-01f,2.132462803e-03f,7.200025320e-01f,2.125686035e-03f,7.221282125e-01f,2.118889010e-03f,
+7.242470980e-01f,2.112072194e-03f,7.263591290e-01f,2.105235355e-03f,7.284643650e-01f,2.098378725e-03f,7.305627465e-01f,2.091502538e-03f,
+7.326542735e-01f,2.084606327e-03f,7.347388864e-01f,2.077690791e-03f,7.368165851e-01f,2.070755698e-03f,7.388873100e-01f,2.063800814e-03f,
+7.409511209e-01f,2.056826837e-03f,7.430079579e-01f,2.049833303e-03f,7.450577617e-01f,2.042820444e-03f,7.471005917e-01f,2.035788493e-03f,
+7.491363883e-01f,2.028737450e-03f,7.511651516e-01f,2.021667082e-03f,7.531868219e-01f,2.014577854e-03f,7.552013993e-01f,2.007469535e-03f,
+7.572088242e-01f,2.000342356e-03f,7.592092156e-01f,1.993196551e-03f,7.612023950e-01f,1.986031886e-03f,7.631884217e-01f,1.978848362e-03f,
+7.651672363e-01f,1.971646212e-03f,7.671388984e-01f,1.964425668e-03f,7.691033483e-01f,1.957186731e-03f,7.710605264e-01f,1.949929050e-03f,
+7.730104327e-01f,1.942653209e-03f,7.749531269e-01f,1.935359091e-03f,7.768884897e-01f,1.928046695e-03f,7.788165212e-01f,1.920716139e-03f,
+7.807372212e-01f,1.913367538e-03f,7.826505899e-01f,1.906001009e-03f,7.845565677e-01f,1.898616436e-03f,7.864552140e-01f,1.891214051e-03f,
+7.883464098e-01f,1.883793855e-03f,7.902302146e-01f,1.876355847e-03f,7.921065688e-01f,1.868900261e-03f,7.939754725e-01f,1.861427096e-03f,
+7.958369255e-01f,1.853936352e-03f,7.976908684e-01f,1.846428146e-03f,7.995372415e-01f,1.838902594e-03f,8.013761640e-01f,1.831359812e-03f,
+8.032075167e-01f,1.823799685e-03f,8.050313592e-01f,1.816222444e-03f,8.068475723e-01f,1.808628091e-03f,8.086561561e-01f,1.801016624e-03f,
+8.104571700e-01f,1.793388277e-03f,8.122506142e-01f,1.785743167e-03f,8.140363097e-01f,1.778081059e-03f,8.158144355e-01f,1.770402305e-03f,
+8.175848126e-01f,1.762706903e-03f,8.193475008e-01f,1.754994970e-03f,8.211025000e-01f,1.747266389e-03f,8.228498101e-01f,1.739521394e-03f,
+8.245893121e-01f,1.731760101e-03f,8.263210654e-01f,1.723982394e-03f,8.280450702e-01f,1.716188504e-03f,8.297612071e-01f,1.708378550e-03f,
+8.314695954e-01f,1.700552413e-03f,8.331701756e-01f,1.692710328e-03f,8.348628879e-01f,1.684852294e-03f,8.365477324e-01f,1.676978311e-03f,
+8.382247090e-01f,1.669088611e-03f,8.398938179e-01f,1.661183196e-03f,8.415549994e-01f,1.653262181e-03f,8.432082534e-01f,1.645325567e-03f,
+8.448535800e-01f,1.637373469e-03f,8.464909196e-01f,1.629406004e-03f,8.481203318e-01f,1.621423173e-03f,8.497417569e-01f,1.613425091e-03f,
+8.513551950e-01f,1.605411875e-03f,8.529605865e-01f,1.597383409e-03f,8.545579910e-01f,1.589340041e-03f,8.561473489e-01f,1.581281656e-03f,
+8.577286005e-01f,1.573208370e-03f,8.593018055e-01f,1.565120299e-03f,8.608669639e-01f,1.557017444e-03f,8.624239564e-01f,1.548900036e-03f,
+8.639728427e-01f,1.540767960e-03f,8.655136228e-01f,1.532621449e-03f,8.670462370e-01f,1.524460502e-03f,8.685706854e-01f,1.516285120e-03f,
+8.700869679e-01f,1.508095535e-03f,8.715950847e-01f,1.499891747e-03f,8.730949759e-01f,1.491673873e-03f,8.745866418e-01f,1.483441913e-03f,
+8.760700822e-01f,1.475195982e-03f,8.775452971e-01f,1.466936199e-03f,8.790122271e-01f,1.458662678e-03f,8.804708719e-01f,1.450375305e-03f,
+8.819212914e-01f,1.442074310e-03f,8.833633661e-01f,1.433759811e-03f,8.847970963e-01f,1.425431692e-03f,8.862225413e-01f,1.417090301e-03f,
+8.876396418e-01f,1.408735407e-03f,8.890483379e-01f,1.400367357e-03f,8.904487491e-01f,1.391986152e-03f,8.918406963e-01f,1.383591793e-03f,
+8.932242990e-01f,1.375184394e-03f,8.945994973e-01f,1.366764074e-03f,8.959662318e-01f,1.358330948e-03f,8.973245621e-01f,1.349885017e-03f,
+8.986744881e-01f,1.341426279e-03f,9.000158906e-01f,1.332955086e-03f,9.013488293e-01f,1.324471203e-03f,9.026733041e-01f,1.315974863e-03f,
+9.039893150e-01f,1.307466184e-03f,9.052967429e-01f,1.298945164e-03f,9.065957069e-01f,1.290411921e-03f,9.078860879e-01f,1.281866571e-03f,
+9.091680050e-01f,1.273309113e-03f,9.104412794e-01f,1.264739782e-03f,9.117060304e-01f,1.256158459e-03f,9.129621983e-01f,1.247565262e-03f,
+9.142097831e-01f,1.238960424e-03f,9.154487252e-01f,1.230343827e-03f,9.166790843e-01f,1.221715705e-03f,9.179008007e-01f,1.213076059e-03f,
+9.191138744e-01f,1.204425003e-03f,9.203183055e-01f,1.195762656e-03f,9.215140343e-01f,1.187089016e-03f,9.227011204e-01f,1.178404200e-03f,
+9.238795042e-01f,1.169708325e-03f,9.250492454e-01f,1.161001390e-03f,9.262102246e-01f,1.152283512e-03f,9.273625016e-01f,1.143554808e-03f,
+9.285060763e-01f,1.134815393e-03f,9.296408892e-01f,1.126065268e-03f,9.307669401e-01f,1.117304550e-03f,9.318842888e-01f,1.108533237e-03f,
+9.329928160e-01f,1.099751564e-03f,9.340925217e-01f,1.090959529e-03f,9.351835251e-01f,1.082157250e-03f,9.362656474e-01f,1.073344727e-03f,
+9.373390079e-01f,1.064522192e-03f,9.384035468e-01f,1.055689529e-03f,9.394592047e-01f,1.046846970e-03f,9.405060410e-01f,1.037994632e-03f,
+9.415440559e-01f,1.029132400e-03f,9.425731897e-01f,1.020260504e-03f,9.435934424e-01f,1.011379063e-03f,9.446048141e-01f,1.002488076e-03f,
+9.456073046e-01f,9.935876587e-04f,9.466009140e-01f,9.846779285e-04f,9.475855827e-01f,9.757588850e-04f,9.485613704e-01f,9.668307030e-04f,
+9.495281577e-01f,9.578933823e-04f,9.504860640e-01f,9.489470394e-04f,9.514350295e-01f,9.399917326e-04f,9.523749948e-01f,9.310276364e-04f,
+9.533060193e-01f,9.220547508e-04f,9.542281032e-01f,9.130731924e-04f,9.551411867e-01f,9.040830191e-04f,9.560452700e-01f,8.950844058e-04f,
+9.569403529e-01f,8.860772941e-04f,9.578264356e-01f,8.770618588e-04f,9.587034583e-01f,8.680381579e-04f,9.595715404e-01f,8.590063080e-04f,
+9.604305029e-01f,8.499663672e-04f,9.612804651e-01f,8.409184520e-04f,9.621214271e-01f,8.318626205e-04f,9.629532695e-01f,8.227989310e-04f,
+9.637760520e-01f,8.137274999e-04f,9.645897746e-01f,8.046483854e-04f,9.653944373e-01f,7.955617621e-04f,9.661899805e-01f,7.864675717e-04f,
+9.669764638e-01f,7.773660473e-04f,9.677538276e-01f,7.682571886e-04f,9.685220718e-01f,7.591410540e-04f,9.692812562e-01f,7.500178181e-04f,
+9.700312614e-01f,7.408875390e-04f,9.707721472e-01f,7.317502750e-04f,9.715039134e-01f,7.226060843e-04f,9.722265005e-01f,7.134551415e-04f,
+9.729399681e-01f,7.042974466e-04f,9.736442566e-01f,6.951331161e-04f,9.743393660e-01f,6.859622663e-04f,9.750253558e-01f,6.767849554e-04f,
+9.757021070e-01f,6.676012999e-04f,9.763697386e-01f,6.584112998e-04f,9.770281315e-01f,6.492151879e-04f,9.776773453e-01f,6.400129059e-04f,
+9.783173800e-01f,6.308045704e-04f,9.789481759e-01f,6.215903559e-04f,9.795697927e-01f,6.123702624e-04f,9.801821113e-01f,6.031444063e-04f,
+9.807852507e-01f,5.939129042e-04f,9.813792109e-01f,5.846758140e-04f,9.819638729e-01f,5.754331942e-04f,9.825392962e-01f,5.661851610e-04f,
+9.831054807e-01f,5.569317727e-04f,9.836624265e-01f,5.476732040e-04f,9.842100739e-01f,5.384093965e-04f,9.847484827e-01f,5.291405832e-04f,
+9.852776527e-01f,5.198667641e-04f,9.857975245e-01f,5.105880555e-04f,9.863080978e-01f,5.013045738e-04f,9.868093729e-01f,4.920163192e-04f,
+9.873014092e-01f,4.827234952e-04f,9.877841473e-01f,4.734260729e-04f,9.882575870e-01f,4.641242267e-04f,9.887216687e-01f,4.548180150e-04f,
+9.891765118e-01f,4.455074959e-04f,9.896219969e-01f,4.361927859e-04f,9.900581837e-01f,4.268740013e-04f,9.904850721e-01f,4.175511713e-04f,
+9.909026623e-01f,4.082244122e-04f,9.913108349e-01f,3.988938115e-04f,9.917097688e-01f,3.895594855e-04f,9.920992851e-01f,3.802214633e-04f,
+9.924795628e-01f,3.708798613e-04f,9.928504229e-01f,3.615347669e-04f,9.932119250e-01f,3.521862964e-04f,9.935641289e-01f,3.428344789e-04f,
+9.939069748e-01f,3.334794601e-04f,9.942404628e-01f,3.241212689e-04f,9.945645928e-01f,3.147600510e-04f,9.948793054e-01f,3.053958644e-04f,
+9.951847196e-01f,2.960288257e-04f,9.954807758e-01f,2.866589639e-04f,9.957674146e-01f,2.772864245e-04f,9.960446954e-01f,2.679112949e-04f,
+9.963126183e-01f,2.585336042e-04f,9.965711236e-01f,2.491534979e-04f,9.968202710e-01f,2.397710487e-04f,9.970600605e-01f,2.303863439e-04f,
+9.972904325e-01f,2.209994564e-04f,9.975114465e-01f,2.116105024e-04f,9.977230430e-01f,2.022195549e-04f,9.979252815e-01f,1.928267011e-04f,
+9.981181026e-01f,1.834320283e-04f,9.983015656e-01f,1.740356383e-04f,9.984755516e-01f,1.646376040e-04f,9.986402392e-01f,1.552380272e-04f,
+9.987954497e-01f,1.458369807e-04f,9.989413023e-01f,1.364345662e-04f,9.990777373e-01f,1.270308712e-04f,9.992047548e-01f,1.176259684e-04f,
+9.993223548e-01f,1.082199669e-04f,9.994305968e-01f,9.881294682e-05f,9.995294213e-01f,8.940499538e-05f,9.996188283e-01f,7.999619993e-05f,
+9.996988177e-01f,7.058665506e-05f,9.997693896e-01f,6.117644807e-05f,9.998306036e-01f,5.176565901e-05f,9.998823404e-01f,4.235438610e-05f,
+9.999247193e-01f,3.294271301e-05f,9.999576211e-01f,2.353073069e-05f,9.999811649e-01f,1.411852736e-05f,9.999952912e-01f,4.706190339e-06f,
+1.000000000e+00f,-4.706190339e-06f,9.999952912e-01f,-1.411852736e-05f,9.999811649e-01f,-2.353073069e-05f,9.999576211e-01f,-3.294271301e-05f,
+9.999247193e-01f,-4.235438610e-05f,9.998823404e-01f,-5.176565901e-05f,9.998306036e-01f,-6.117644807e-05f,9.997693896e-01f,-7.058665506e-05f,
+9.996988177e-01f,-7.999619993e-05f,9.996188283e-01f,-8.940499538e-05f,9.995294213e-01f,-9.881294682e-05f,9.994305968e-01f,-1.082199669e-04f,
+9.993223548e-01f,-1.176259684e-04f,9.992047548e-01f,-1.270308712e-04f,9.990777373e-01f,-1.364345662e-04f,9.989413023e-01f,-1.458369807e-04f,
+9.987954497e-01f,-1.552380272e-04f,9.986402392e-01f,-1.646376040e-04f,9.984755516e-01f,-1.740356383e-04f,9.983015656e-01f,-1.834320283e-04f,
+9.981181026e-01f,-1.928267011e-04f,9.979252815e-01f,-2.022195549e-04f,9.977230430e-01f,-2.116105024e-04f,9.975114465e-01f,-2.209994564e-04f,
+9.972904325e-01f,-2.303863439e-04f,9.970600605e-01f,-2.397710487e-04f,9.968202710e-01f,-2.491534979e-04f,9.965711236e-01f,-2.585336042e-04f,
+9.963126183e-01f,-2.679112949e-04f,9.960446954e-01f,-2.772864245e-04f,9.957674146e-01f,-2.866589639e-04f,9.954807758e-01f,-2.960288257e-04f,
+9.951847196e-01f,-3.053958644e-04f,9.948793054e-01f,-3.147600510e-04f,9.945645928e-01f,-3.241212689e-04f,9.942404628e-01f,-3.334794601e-04f,
+9.939069748e-01f,-3.428344789e-04f,9.935641289e-01f,-3.521862964e-04f,9.932119250e-01f,-3.615347669e-04f,9.928504229e-01f,-3.708798613e-04f,
+9.924795628e-01f,-3.802214633e-04f,9.920992851e-01f,-3.895594855e-04f,9.917097688e-01f,-3.988938115e-04f,9.913108349e-01f,-4.082244122e-04f,
+9.909026623e-01f,-4.175511713e-04f,9.904850721e-01f,-4.268740013e-04f,9.900581837e-01f,-4.361927859e-04f,9.896219969e-01f,-4.455074959e-04f,
+9.891765118e-01f,-4.548180150e-04f,9.887216687e-01f,-4.641242267e-04f,9.882575870e-01f,-4.734260729e-04f,9.877841473e-01f,-4.827234952e-04f,
+9.873014092e-01f,-4.920163192e-04f,9.868093729e-01f,-5.013045738e-04f,9.863080978e-01f,-5.105880555e-04f,9.857975245e-01f,-5.198667641e-04f,
+9.852776527e-01f,-5.291405832e-04f,9.847484827e-01f,-5.384093965e-04f,9.842100739e-01f,-5.476732040e-04f,9.836624265e-01f,-5.569317727e-04f,
+9.831054807e-01f,-5.661851610e-04f,9.825392962e-01f,-5.754331942e-04f,9.819638729e-01f,-5.846758140e-04f,9.813792109e-01f,-5.939129042e-04f,
+9.807852507e-01f,-6.031444063e-04f,9.801821113e-01f,-6.123702624e-04f,9.795697927e-01f,-6.215903559e-04f,9.789481759e-01f,-6.308045704e-04f,
+9.783173800e-01f,-6.400129059e-04f,9.776773453e-01f,-6.492151879e-04f,9.770281315e-01f,-6.584112998e-04f,9.763697386e-01f,-6.676012999e-04f,
+9.757021070e-01f,-6.767849554e-04f,9.750253558e-01f,-6.859622663e-04f,9.743393660e-01f,-6.951331161e-04f,9.736442566e-01f,-7.042974466e-04f,
+9.729399681e-01f,-7.134551415e-04f,9.722265005e-01f,-7.226060843e-04f,9.715039134e-01f,-7.317502750e-04f,9.707721472e-01f,-7.408875390e-04f,
+9.700312614e-01f,-7.500178181e-04f,9.692812562e-01f,-7.591410540e-04f,9.685220718e-01f,-7.682571886e-04f,9.677538276e-01f,-7.773660473e-04f,
+9.669764638e-01f,-7.864675717e-04f,9.661899805e-01f,-7.955617621e-04f,9.653944373e-01f,-8.046483854e-04f,9.645897746e-01f,-8.137274999e-04f,
+9.637760520e-01f,-8.227989310e-04f,9.629532695e-01f,-8.318626205e-04f,9.621214271e-01f,-8.409184520e-04f,9.612804651e-01f,-8.499663672e-04f,
+9.604305029e-01f,-8.590063080e-04f,9.595715404e-01f,-8.680381579e-04f,9.587034583e-01f,-8.770618588e-04f,9.578264356e-01f,-8.860772941e-04f,
+9.569403529e-01f,-8.950844058e-04f,9.560452700e-01f,-9.040830191e-04f,9.551411867e-01f,-9.130731924e-04f,9.542281032e-01f,-9.220547508e-04f,
+9.533060193e-01f,-9.310276364e-04f,9.523749948e-01f,-9.399917326e-04f,9.514350295e-01f,-9.489470394e-04f,9.504860640e-01f,-9.578933823e-04f,
+9.495281577e-01f,-9.668307030e-04f,9.485613704e-01f,-9.757588850e-04f,9.475855827e-01f,-9.846779285e-04f,9.466009140e-01f,-9.935876587e-04f,
+9.456073046e-01f,-1.002488076e-03f,9.446048141e-01f,-1.011379063e-03f,9.435934424e-01f,-1.020260504e-03f,9.425731897e-01f,-1.029132400e-03f,
+9.415440559e-01f,-1.037994632e-03f,9.405060410e-01f,-1.046846970e-03f,9.394592047e-01f,-1.055689529e-03f,9.384035468e-01f,-1.064522192e-03f,
+9.373390079e-01f,-1.073344727e-03f,9.362656474e-01f,-1.082157250e-03f,9.351835251e-01f,-1.090959529e-03f,9.340925217e-01f,-1.099751564e-03f,
+9.329928160e-01f,-1.108533237e-03f,9.318842888e-01f,-1.117304550e-03f,9.307669401e-01f,-1.126065268e-03f,9.296408892e-01f,-1.134815393e-03f,
+9.285060763e-01f,-1.143554808e-03f,9.273625016e-01f,-1.152283512e-03f,9.262102246e-01f,-1.161001390e-03f,9.250492454e-01f,-1.169708325e-03f,
+9.238795042e-01f,-1.178404200e-03f,9.227011204e-01f,-1.187089016e-03f,9.215140343e-01f,-1.195762656e-03f,9.203183055e-01f,-1.204425003e-03f,
+9.191138744e-01f,-1.213076059e-03f,9.179008007e-01f,-1.221715705e-03f,9.166790843e-01f,-1.230343827e-03f,9.154487252e-01f,-1.238960424e-03f,
+9.142097831e-01f,-1.247565262e-03f,9.129621983e-01f,-1.256158459e-03f,9.117060304e-01f,-1.264739782e-03f,9.104412794e-01f,-1.273309113e-03f,
+9.091680050e-01f,-1.281866571e-03f,9.078860879e-01f,-1.290411921e-03f,9.065957069e-01f,-1.298945164e-03f,9.052967429e-01f,-1.307466184e-03f,
+9.039893150e-01f,-1.315974863e-03f,9.026733041e-01f,-1.324471203e-03f,9.013488293e-01f,-1.332955086e-03f,9.000158906e-01f,-1.341426279e-03f,
+8.986744881e-01f,-1.349885017e-03f,8.973245621e-01f,-1.358330948e-03f,8.959662318e-01f,-1.366764074e-03f,8.945994973e-01f,-1.375184394e-03f,
+8.932242990e-01f,-1.383591793e-03f,8.918406963e-01f,-1.391986152e-03f,8.904487491e-01f,-1.400367357e-03f,8.890483379e-01f,-1.408735407e-03f,
+8.876396418e-01f,-1.417090301e-03f,8.862225413e-01f,-1.425431692e-03f,8.847970963e-01f,-1.433759811e-03f,8.833633661e-01f,-1.442074310e-03f,
+8.819212914e-01f,-1.450375305e-03f,8.804708719e-01f,-1.458662678e-03f,8.790122271e-01f,-1.466936199e-03f,8.775452971e-01f,-1.475195982e-03f,
+8.760700822e-01f,-1.483441913e-03f,8.745866418e-01f,-1.491673873e-03f,8.730949759e-01f,-1.499891747e-03f,8.715950847e-01f,-1.508095535e-03f,
+8.700869679e-01f,-1.516285120e-03f,8.685706854e-01f,-1.524460502e-03f,8.670462370e-01f,-1.532621449e-03f,8.655136228e-01f,-1.540767960e-03f,
+8.639728427e-01f,-1.548900036e-03f,8.624239564e-01f,-1.557017444e-03f,8.608669639e-01f,-1.565120299e-03f,8.593018055e-01f,-1.573208370e-03f,
+8.577286005e-01f,-1.581281656e-03f,8.561473489e-01f,-1.589340041e-03f,8.545579910e-01f,-1.597383409e-03f,8.529605865e-01f,-1.605411875e-03f,
+8.513551950e-01f,-1.613425091e-03f,8.497417569e-01f,-1.621423173e-03f,8.481203318e-01f,-1.629406004e-03f,8.464909196e-01f,-1.637373469e-03f,
+8.448535800e-01f,-1.645325567e-03f,8.432082534e-01f,-1.653262181e-03f,8.415549994e-01f,-1.661183196e-03f,8.398938179e-01f,-1.669088611e-03f,
+8.382247090e-01f,-1.676978311e-03f,8.365477324e-01f,-1.684852294e-03f,8.348628879e-01f,-1.692710328e-03f,8.331701756e-01f,-1.700552413e-03f,
+8.314695954e-01f,-1.708378550e-03f,8.297612071e-01f,-1.716188504e-03f,8.280450702e-01f,-1.723982394e-03f,8.263210654e-01f,-1.731760101e-03f,
+8.245893121e-01f,-1.739521394e-03f,8.228498101e-01f,-1.747266389e-03f,8.211025000e-01f,-1.754994970e-03f,8.193475008e-01f,-1.762706903e-03f,
+8.175848126e-01f,-1.770402305e-03f,8.158144355e-01f,-1.778081059e-03f,8.140363097e-01f,-1.785743167e-03f,8.122506142e-01f,-1.793388277e-03f,
+8.104571700e-01f,-1.801016624e-03f,8.086561561e-01f,-1.808628091e-03f,8.068475723e-01f,-1.816222444e-03f,8.050313592e-01f,-1.823799685e-03f,
+8.032075167e-01f,-1.831359812e-03f,8.013761640e-01f,-1.838902594e-03f,7.995372415e-01f,-1.846428146e-03f,7.976908684e-01f,-1.853936352e-03f,
+7.958369255e-01f,-1.861427096e-03f,7.939754725e-01f,-1.868900261e-03f,7.921065688e-01f,-1.876355847e-03f,7.902302146e-01f,-1.883793855e-03f,
+7.883464098e-01f,-1.891214051e-03f,7.864552140e-01f,-1.898616436e-03f,7.845565677e-01f,-1.906001009e-03f,7.826505899e-01f,-1.913367538e-03f,
+7.807372212e-01f,-1.920716139e-03f,7.788165212e-01f,-1.928046695e-03f,7.768884897e-01f,-1.935359091e-03f,7.749531269e-01f,-1.942653209e-03f,
+7.730104327e-01f,-1.949929050e-03f,7.710605264e-01f,-1.957186731e-03f,7.691033483e-01f,-1.964425668e-03f,7.671388984e-01f,-1.971646212e-03f,
+7.651672363e-01f,-1.978848362e-03f,7.631884217e-01f,-1.986031886e-03f,7.612023950e-01f,-1.993196551e-03f,7.592092156e-01f,-2.000342356e-03f,
+7.572088242e-01f,-2.007469535e-03f,7.552013993e-01f,-2.014577854e-03f,7.531868219e-01f,-2.021667082e-03f,7.511651516e-01f,-2.028737450e-03f,
+7.491363883e-01f,-2.035788493e-03f,7.471005917e-01f,-2.042820444e-03f,7.450577617e-01f,-2.049833303e-03f,7.430079579e-01f,-2.056826837e-03f,
+7.409511209e-01f,-2.063800814e-03f,7.388873100e-01f,-2.070755698e-03f,7.368165851e-01f,-2.077690791e-03f,7.347388864e-01f,-2.084606327e-03f,
+7.326542735e-01f,-2.091502538e-03f,7.305627465e-01f,-2.098378725e-03f,7.284643650e-01f,-2.105235355e-03f,7.263591290e-01f,-2.112072194e-03f,
+7.242470980e-01f,-2.118889010e-03f,7.221282125e-01f,-2.125686035e-03f,7.200025320e-01f,-2.132462803e-03f,7.178700566e-01f,-2.139219781e-03f,
+7.157308459e-01f,-2.145956503e-03f,7.135848403e-01f,-2.152672969e-03f,7.114322186e-01f,-2.159369411e-03f,7.092728019e-01f,-2.166045364e-03f,
+7.071067691e-01f,-2.172700828e-03f,7.049340606e-01f,-2.179335803e-03f,7.027547359e-01f,-2.185950521e-03f,7.005687952e-01f,-2.192544518e-03f,
+6.983762383e-01f,-2.199118026e-03f,6.961771250e-01f,-2.205670578e-03f,6.939714551e-01f,-2.212202409e-03f,6.917592287e-01f,-2.218713518e-03f,
+6.895405650e-01f,-2.225203905e-03f,6.873153448e-01f,-2.231673105e-03f,6.850836873e-01f,-2.238121349e-03f,6.828455329e-01f,-2.244548639e-03f,
+6.806010008e-01f,-2.250954742e-03f,6.783500314e-01f,-2.257339656e-03f,6.760926843e-01f,-2.263703151e-03f,6.738290191e-01f,-2.270045457e-03f,
+6.715589762e-01f,-2.276366577e-03f,6.692826152e-01f,-2.282666042e-03f,6.669999361e-01f,-2.288944088e-03f,6.647109985e-01f,-2.295200713e-03f,
+6.624158025e-01f,-2.301435452e-03f,6.601143479e-01f,-2.307648771e-03f,6.578066945e-01f,-2.313840203e-03f,6.554928422e-01f,-2.320009982e-03f,
+6.531728506e-01f,-2.326157875e-03f,6.508466601e-01f,-2.332283882e-03f,6.485143900e-01f,-2.338388003e-03f,6.461760402e-01f,-2.344470005e-03f,
+6.438315511e-01f,-2.350530121e-03f,6.414810419e-01f,-2.356567886e-03f,6.391244531e-01f,-2.362583531e-03f,6.367618442e-01f,-2.368577057e-03f,
+6.343932748e-01f,-2.374548232e-03f,6.320187449e-01f,-2.380497055e-03f,6.296382546e-01f,-2.386423526e-03f,6.272518039e-01f,-2.392327413e-03f,
+6.248595119e-01f,-2.398208715e-03f,6.224612594e-01f,-2.404067665e-03f,6.200572252e-01f,-2.409903798e-03f,6.176472902e-01f,-2.415717347e-03f,
+6.152315736e-01f,-2.421508078e-03f,6.128100753e-01f,-2.427276224e-03f,6.103827953e-01f,-2.433021320e-03f,6.079497933e-01f,-2.438743599e-03f,
+6.055110693e-01f,-2.444442827e-03f,6.030666232e-01f,-2.450119238e-03f,6.006164551e-01f,-2.455772366e-03f,5.981606841e-01f,-2.461402444e-03f,
+5.956993103e-01f,-2.467009472e-03f,5.932322741e-01f,-2.472593216e-03f,5.907596946e-01f,-2.478153678e-03f,5.882815719e-01f,-2.483690856e-03f,
+5.857978463e-01f,-2.489204518e-03f,5.833086371e-01f,-2.494694898e-03f,5.808139443e-01f,-2.500161761e-03f,5.783137679e-01f,-2.505605109e-03f,
+5.758081675e-01f,-2.511024708e-03f,5.732971430e-01f,-2.516420791e-03f,5.707807541e-01f,-2.521793125e-03f,5.682589412e-01f,-2.527141944e-03f,
+5.657318234e-01f,-2.532466780e-03f,5.631993413e-01f,-2.537767868e-03f,5.606615543e-01f,-2.543044975e-03f,5.581185222e-01f,-2.548298100e-03f,
+5.555702448e-01f,-2.553527476e-03f,5.530167222e-01f,-2.558732638e-03f,5.504579544e-01f,-2.563913818e-03f,5.478940606e-01f,-2.569070784e-03f,
+5.453249812e-01f,-2.574203536e-03f,5.427507758e-01f,-2.579312073e-03f,5.401714444e-01f,-2.584396396e-03f,5.375870466e-01f,-2.589456504e-03f,
+5.349976420e-01f,-2.594491933e-03f,5.324031115e-01f,-2.599503146e-03f,5.298036337e-01f,-2.604489913e-03f,5.271991491e-01f,-2.609452000e-03f,
+5.245896578e-01f,-2.614389639e-03f,5.219752789e-01f,-2.619302832e-03f,5.193560123e-01f,-2.624191111e-03f,5.167317986e-01f,-2.629054710e-03f,
+5.141027570e-01f,-2.633893862e-03f,5.114688277e-01f,-2.638707869e-03f,5.088301301e-01f,-2.643497195e-03f,5.061866641e-01f,-2.648261609e-03f,
+5.035383701e-01f,-2.653001109e-03f,5.008853674e-01f,-2.657715697e-03f,4.982276559e-01f,-2.662405139e-03f,4.955652654e-01f,-2.667069668e-03f,
+4.928981960e-01f,-2.671709051e-03f,4.902264774e-01f,-2.676323056e-03f,4.875501692e-01f,-2.680912148e-03f,4.848692417e-01f,-2.685475862e-03f,
+4.821837842e-01f,-2.690014429e-03f,4.794937670e-01f,-2.694527619e-03f,4.767992198e-01f,-2.699015429e-03f,4.741002023e-01f,-2.703477861e-03f,
+4.713967443e-01f,-2.707914682e-03f,4.686888158e-01f,-2.712326357e-03f,4.659765065e-01f,-2.716712188e-03f,4.632597864e-01f,-2.721072640e-03f,
+4.605387151e-01f,-2.725407248e-03f,4.578132927e-01f,-2.729716478e-03f,4.550835788e-01f,-2.733999863e-03f,4.523495734e-01f,-2.738257637e-03f,
+4.496113360e-01f,-2.742489567e-03f,4.468688369e-01f,-2.746695653e-03f,4.441221356e-01f,-2.750875894e-03f,4.413712621e-01f,-2.755030291e-03f,
+4.386162460e-01f,-2.759158611e-03f,4.358570874e-01f,-2.763261087e-03f,4.330938160e-01f,-2.767337486e-03f,4.303264916e-01f,-2.771387808e-03f,
+4.275550842e-01f,-2.775412286e-03f,4.247796834e-01f,-2.779410454e-03f,4.220002592e-01f,-2.783382544e-03f,4.192169011e-01f,-2.787328325e-03f,
+4.164295495e-01f,-2.791247796e-03f,4.136383235e-01f,-2.795141190e-03f,4.108431637e-01f,-2.799008274e-03f,4.080441594e-01f,-2.802848816e-03f,
+4.052413106e-01f,-2.806663048e-03f,4.024346471e-01f,-2.810450969e-03f,3.996241987e-01f,-2.814212348e-03f,3.968099952e-01f,-2.817947417e-03f,
+3.939920366e-01f,-2.821655711e-03f,3.911703825e-01f,-2.825337695e-03f,3.883450329e-01f,-2.828992903e-03f,3.855160475e-01f,-2.832621569e-03f,
+3.826834261e-01f,-2.836223459e-03f,3.798471987e-01f,-2.839798806e-03f,3.770074248e-01f,-2.843347145e-03f,3.741640747e-01f,-2.846868942e-03f,
+3.713172078e-01f,-2.850363962e-03f,3.684668243e-01f,-2.853832208e-03f,3.656129837e-01f,-2.857273445e-03f,3.627557158e-01f,-2.860687906e-03f,
+3.598950505e-01f,-2.864075359e-03f,3.570309579e-01f,-2.867435804e-03f,3.541635275e-01f,-2.870769240e-03f,3.512927592e-01f,-2.874075901e-03f,
+3.484186828e-01f,-2.877355320e-03f,3.455413282e-01f,-2.880607732e-03f,3.426607251e-01f,-2.883832902e-03f,3.397768736e-01f,-2.887031063e-03f,
+3.368898630e-01f,-2.890201984e-03f,3.339996636e-01f,-2.893345663e-03f,3.311063051e-01f,-2.896462101e-03f,3.282098472e-01f,-2.899551531e-03f,
+3.253102899e-01f,-2.902613254e-03f,3.224076927e-01f,-2.905647969e-03f,3.195020258e-01f,-2.908655209e-03f,3.165933788e-01f,-2.911635209e-03f,
+3.136817515e-01f,-2.914587734e-03f,3.107671440e-01f,-2.917512786e-03f,3.078496456e-01f,-2.920410363e-03f,3.049292266e-01f,-2.923280466e-03f,
+3.020059466e-01f,-2.926123096e-03f,2.990798354e-01f,-2.928938018e-03f,2.961508930e-01f,-2.931725467e-03f,2.932191491e-01f,-2.934485441e-03f,
+2.902846634e-01f,-2.937217709e-03f,2.873474658e-01f,-2.939922269e-03f,2.844075263e-01f,-2.942599356e-03f,2.814649343e-01f,-2.945248503e-03f,
+2.785196900e-01f,-2.947870176e-03f,2.755718231e-01f,-2.950463910e-03f,2.726213634e-01f,-2.953029936e-03f,2.696683109e-01f,-2.955568023e-03f,
+2.667127550e-01f,-2.958078403e-03f,2.637546659e-01f,-2.960561076e-03f,2.607941031e-01f,-2.963015810e-03f,2.578310966e-01f,-2.965442603e-03f,
+2.548656464e-01f,-2.967841458e-03f,2.518978119e-01f,-2.970212372e-03f,2.489276081e-01f,-2.972555347e-03f,2.459550500e-01f,-2.974870382e-03f,
+2.429801822e-01f,-2.977157477e-03f,2.400030196e-01f,-2.979416400e-03f,2.370236069e-01f,-2.981647383e-03f,2.340419590e-01f,-2.983850194e-03f,
+2.310581058e-01f,-2.986025065e-03f,2.280720770e-01f,-2.988171764e-03f,2.250839174e-01f,-2.990290290e-03f,2.220936269e-01f,-2.992380876e-03f,
+2.191012353e-01f,-2.994443057e-03f,2.161068022e-01f,-2.996477066e-03f,2.131103128e-01f,-2.998483134e-03f,2.101118416e-01f,-3.000460798e-03f,
+2.071113735e-01f,-3.002410056e-03f,2.041089684e-01f,-3.004331142e-03f,2.011046410e-01f,-3.006224055e-03f,1.980984062e-01f,-3.008088795e-03f,
+1.950903237e-01f,-3.009924898e-03f,1.920803934e-01f,-3.011732828e-03f,1.890686601e-01f,-3.013512585e-03f,1.860551536e-01f,-3.015263705e-03f,
+1.830398887e-01f,-3.016986651e-03f,1.800228953e-01f,-3.018680960e-03f,1.770042181e-01f,-3.020347096e-03f,1.739838719e-01f,-3.021984594e-03f,
+1.709618866e-01f,-3.023593687e-03f,1.679382920e-01f,-3.025174374e-03f,1.649131179e-01f,-3.026726656e-03f,1.618863940e-01f,-3.028250532e-03f,
+1.588581502e-01f,-3.029745771e-03f,1.558284014e-01f,-3.031212371e-03f,1.527971923e-01f,-3.032650566e-03f,1.497645378e-01f,-3.034060122e-03f,
+1.467304677e-01f,-3.035441274e-03f,1.436950266e-01f,-3.036793787e-03f,1.406582445e-01f,-3.038117662e-03f,1.376201212e-01f,-3.039413132e-03f,
+1.345807016e-01f,-3.040679730e-03f,1.315400302e-01f,-3.041917924e-03f,1.284981072e-01f,-3.043127479e-03f,1.254549772e-01f,-3.044308163e-03f,
+1.224106774e-01f,-3.045460442e-03f,1.193652153e-01f,-3.046583850e-03f,1.163186282e-01f,-3.047678620e-03f,1.132709533e-01f,-3.048744984e-03f,
+1.102222055e-01f,-3.049782244e-03f,1.071724221e-01f,-3.050791100e-03f,1.041216329e-01f,-3.051771084e-03f,1.010698602e-01f,-3.052722430e-03f,
+9.801714122e-02f,-3.053644905e-03f,9.496349841e-02f,-3.054538742e-03f,9.190895408e-02f,-3.055403940e-03f,8.885355294e-02f,-3.056240268e-03f,
+8.579730988e-02f,-3.057047725e-03f,8.274026215e-02f,-3.057826543e-03f,7.968243957e-02f,-3.058576491e-03f,7.662386447e-02f,-3.059297800e-03f,
+7.356456667e-02f,-3.059990238e-03f,7.050457597e-02f,-3.060653806e-03f,6.744392216e-02f,-3.061288735e-03f,6.438262761e-02f,-3.061894560e-03f,
+6.132073700e-02f,-3.062471747e-03f,5.825826526e-02f,-3.063020064e-03f,5.519524589e-02f,-3.063539742e-03f,5.213170499e-02f,-3.064030316e-03f,
+4.906767607e-02f,-3.064492252e-03f,4.600318149e-02f,-3.064925084e-03f,4.293825850e-02f,-3.065329278e-03f,3.987292573e-02f,-3.065704601e-03f,
+3.680722415e-02f,-3.066051053e-03f,3.374117240e-02f,-3.066368634e-03f,3.067480400e-02f,-3.066657344e-03f,2.760814503e-02f,-3.066917183e-03f,
+2.454122901e-02f,-3.067148151e-03f,2.147408016e-02f,-3.067350481e-03f,1.840673015e-02f,-3.067523707e-03f,1.533920597e-02f,-3.067668062e-03f,
+1.227153838e-02f,-3.067783546e-03f,9.203754365e-03f,-3.067870159e-03f,6.135884672e-03f,-3.067927901e-03f,3.067956772e-03f,-3.067956772e-03f,
+1.224646853e-16f,-3.067956772e-03f,-3.067956772e-03f,-3.067927901e-03f,-6.135884672e-03f,-3.067870159e-03f,-9.203754365e-03f,-3.067783546e-03f,
+-1.227153838e-02f,-3.067668062e-03f,-1.533920597e-02f,-3.067523707e-03f,-1.840673015e-02f,-3.067350481e-03f,-2.147408016e-02f,-3.067148151e-03f,
+-2.454122901e-02f,-3.066917183e-03f,-2.760814503e-02f,-3.066657344e-03f,-3.067480400e-02f,-3.066368634e-03f,-3.374117240e-02f,-3.066051053e-03f,
+-3.680722415e-02f,-3.065704601e-03f,-3.987292573e-02f,-3.065329278e-03f,-4.293825850e-02f,-3.064925084e-03f,-4.600318149e-02f,-3.064492252e-03f,
+-4.906767607e-02f,-3.064030316e-03f,-5.213170499e-02f,-3.063539742e-03f,-5.519524589e-02f,-3.063020064e-03f,-5.825826526e-02f,-3.062471747e-03f,
+-6.132073700e-02f,-3.061894560e-03f,-6.438262761e-02f,-3.061288735e-03f,-6.744392216e-02f,-3.060653806e-03f,-7.050457597e-02f,-3.059990238e-03f,
+-7.356456667e-02f,-3.059297800e-03f,-7.662386447e-02f,-3.058576491e-03f,-7.968243957e-02f,-3.057826543e-03f,-8.274026215e-02f,-3.057047725e-03f,
+-8.579730988e-02f,-3.056240268e-03f,-8.885355294e-02f,-3.055403940e-03f,-9.190895408e-02f,-3.054538742e-03f,-9.496349841e-02f,-3.053644905e-03f,
+-9.801714122e-02f,-3.052722430e-03f,-1.010698602e-01f,-3.051771084e-03f,-1.041216329e-01f,-3.050791100e-03f,-1.071724221e-01f,-3.049782244e-03f,
+-1.102222055e-01f,-3.048744984e-03f,-1.132709533e-01f,-3.047678620e-03f,-1.163186282e-01f,-3.046583850e-03f,-1.193652153e-01f,-3.045460442e-03f,
+-1.224106774e-01f,-3.044308163e-03f,-1.254549772e-01f,-3.043127479e-03f,-1.284981072e-01f,-3.041917924e-03f,-1.315400302e-01f,-3.040679730e-03f,
+-1.345807016e-01f,-3.039413132e-03f,-1.376201212e-01f,-3.038117662e-03f,-1.406582445e-01f,-3.036793787e-03f,-1.436950266e-01f,-3.035441274e-03f,
+-1.467304677e-01f,-3.034060122e-03f,-1.497645378e-01f,-3.032650566e-03f,-1.527971923e-01f,-3.031212371e-03f,-1.558284014e-01f,-3.029745771e-03f,
+-1.588581502e-01f,-3.028250532e-03f,-1.618863940e-01f,-3.026726656e-03f,-1.649131179e-01f,-3.025174374e-03f,-1.679382920e-01f,-3.023593687e-03f,
+-1.709618866e-01f,-3.021984594e-03f,-1.739838719e-01f,-3.020347096e-03f,-1.770042181e-01f,-3.018680960e-03f,-1.800228953e-01f,-3.016986651e-03f,
+-1.830398887e-01f,-3.015263705e-03f,-1.860551536e-01f,-3.013512585e-03f,-1.890686601e-01f,-3.011732828e-03f,-1.920803934e-01f,-3.009924898e-03f,
+-1.950903237e-01f,-3.008088795e-03f,-1.980984062e-01f,-3.006224055e-03f,-2.011046410e-01f,-3.004331142e-03f,-2.041089684e-01f,-3.002410056e-03f,
+-2.071113735e-01f,-3.000460798e-03f,-2.101118416e-01f,-2.998483134e-03f,-2.131103128e-01f,-2.996477066e-03f,-2.161068022e-01f,-2.994443057e-03f,
+-2.191012353e-01f,-2.992380876e-03f,-2.220936269e-01f,-2.990290290e-03f,-2.250839174e-01f,-2.988171764e-03f,-2.280720770e-01f,-2.986025065e-03f,
+-2.310581058e-01f,-2.983850194e-03f,-2.340419590e-01f,-2.981647383e-03f,-2.370236069e-01f,-2.979416400e-03f,-2.400030196e-01f,-2.977157477e-03f,
+-2.429801822e-01f,-2.974870382e-03f,-2.459550500e-01f,-2.972555347e-03f,-2.489276081e-01f,-2.970212372e-03f,-2.518978119e-01f,-2.967841458e-03f,
+-2.548656464e-01f,-2.965442603e-03f,-2.578310966e-01f,-2.963015810e-03f,-2.607941031e-01f,-2.960561076e-03f,-2.637546659e-01f,-2.958078403e-03f,
+-2.667127550e-01f,-2.955568023e-03f,-2.696683109e-01f,-2.953029936e-03f,-2.726213634e-01f,-2.950463910e-03f,-2.755718231e-01f,-2.947870176e-03f,
+-2.785196900e-01f,-2.945248503e-03f,-2.814649343e-01f,-2.942599356e-03f,-2.844075263e-01f,-2.939922269e-03f,-2.873474658e-01f,-2.937217709e-03f,
+-2.902846634e-01f,-2.934485441e-03f,-2.932191491e-01f,-2.931725467e-03f,-2.961508930e-01f,-2.928938018e-03f,-2.990798354e-01f,-2.926123096e-03f,
+-3.020059466e-01f,-2.923280466e-03f,-3.049292266e-01f,-2.920410363e-03f,-3.078496456e-01f,-2.917512786e-03f,-3.107671440e-01f,-2.914587734e-03f,
+-3.136817515e-01f,-2.911635209e-03f,-3.165933788e-01f,-2.908655209e-03f,-3.195020258e-01f,-2.905647969e-03f,-3.224076927e-01f,-2.902613254e-03f,
+-3.253102899e-01f,-2.899551531e-03f,-3.282098472e-01f,-2.896462101e-03f,-3.311063051e-01f,-2.893345663e-03f,-3.339996636e-01f,-2.890201984e-03f,
+-3.368898630e-01f,-2.887031063e-03f,-3.397768736e-01f,-2.883832902e-03f,-3.426607251e-01f,-2.880607732e-03f,-3.455413282e-01f,-2.877355320e-03f,
+-3.484186828e-01f,-2.874075901e-03f,-3.512927592e-01f,-2.870769240e-03f,-3.541635275e-01f,-2.867435804e-03f,-3.570309579e-01f,-2.864075359e-03f,
+-3.598950505e-01f,-2.860687906e-03f,-3.627557158e-01f,-2.857273445e-03f,-3.656129837e-01f,-2.853832208e-03f,-3.684668243e-01f,-2.850363962e-03f,
+-3.713172078e-01f,-2.846868942e-03f,-3.741640747e-01f,-2.843347145e-03f,-3.770074248e-01f,-2.839798806e-03f,-3.798471987e-01f,-2.836223459e-03f,
+-3.826834261e-01f,-2.832621569e-03f,-3.855160475e-01f,-2.828992903e-03f,-3.883450329e-01f,-2.825337695e-03f,-3.911703825e-01f,-2.821655711e-03f,
+-3.939920366e-01f,-2.817947417e-03f,-3.968099952e-01f,-2.814212348e-03f,-3.996241987e-01f,-2.810450969e-03f,-4.024346471e-01f,-2.806663048e-03f,
+-4.052413106e-01f,-2.802848816e-03f,-4.080441594e-01f,-2.799008274e-03f,-4.108431637e-01f,-2.795141190e-03f,-4.136383235e-01f,-2.791247796e-03f,
+-4.164295495e-01f,-2.787328325e-03f,-4.192169011e-01f,-2.783382544e-03f,-4.220002592e-01f,-2.779410454e-03f,-4.247796834e-01f,-2.775412286e-03f,
+-4.275550842e-01f,-2.771387808e-03f,-4.303264916e-01f,-2.767337486e-03f,-4.330938160e-01f,-2.763261087e-03f,-4.358570874e-01f,-2.759158611e-03f,
+-4.386162460e-01f,-2.755030291e-03f,-4.413712621e-01f,-2.750875894e-03f,-4.441221356e-01f,-2.746695653e-03f,-4.468688369e-01f,-2.742489567e-03f,
+-4.496113360e-01f,-2.738257637e-03f,-4.523495734e-01f,-2.733999863e-03f,-4.550835788e-01f,-2.729716478e-03f,-4.578132927e-01f,-2.725407248e-03f,
+-4.605387151e-01f,-2.721072640e-03f,-4.632597864e-01f,-2.716712188e-03f,-4.659765065e-01f,-2.712326357e-03f,-4.686888158e-01f,-2.707914682e-03f,
+-4.713967443e-01f,-2.703477861e-03f,-4.741002023e-01f,-2.699015429e-03f,-4.767992198e-01f,-2.694527619e-03f,-4.794937670e-01f,-2.690014429e-03f,
+-4.821837842e-01f,-2.685475862e-03f,-4.848692417e-01f,-2.680912148e-03f,-4.875501692e-01f,-2.676323056e-03f,-4.902264774e-01f,-2.671709051e-03f,
+-4.928981960e-01f,-2.667069668e-03f,-4.955652654e-01f,-2.662405139e-03f,-4.982276559e-01f,-2.657715697e-03f,-5.008853674e-01f,-2.653001109e-03f,
+-5.035383701e-01f,-2.648261609e-03f,-5.061866641e-01f,-2.643497195e-03f,-5.088301301e-01f,-2.638707869e-03f,-5.114688277e-01f,-2.633893862e-03f,
+-5.141027570e-01f,-2.629054710e-03f,-5.167317986e-01f,-2.624191111e-03f,-5.193560123e-01f,-2.619302832e-03f,-5.219752789e-01f,-2.614389639e-03f,
+-5.245896578e-01f,-2.609452000e-03f,-5.271991491e-01f,-2.604489913e-03f,-5.298036337e-01f,-2.599503146e-03f,-5.324031115e-01f,-2.594491933e-03f,
+-5.349976420e-01f,-2.589456504e-03f,-5.375870466e-01f,-2.584396396e-03f,-5.401714444e-01f,-2.579312073e-03f,-5.427507758e-01f,-2.574203536e-03f,
+-5.453249812e-01f,-2.569070784e-03f,-5.478940606e-01f,-2.563913818e-03f,-5.504579544e-01f,-2.558732638e-03f,-5.530167222e-01f,-2.553527476e-03f,
+-5.555702448e-01f,-2.548298100e-03f,-5.581185222e-01f,-2.543044975e-03f,-5.606615543e-01f,-2.537767868e-03f,-5.631993413e-01f,-2.532466780e-03f,
+-5.657318234e-01f,-2.527141944e-03f,-5.682589412e-01f,-2.521793125e-03f,-5.707807541e-01f,-2.516420791e-03f,-5.732971430e-01f,-2.511024708e-03f,
+-5.758081675e-01f,-2.505605109e-03f,-5.783137679e-01f,-2.500161761e-03f,-5.808139443e-01f,-2.494694898e-03f,-5.833086371e-01f,-2.489204518e-03f,
+-5.857978463e-01f,-2.483690856e-03f,-5.882815719e-01f,-2.478153678e-03f,-5.907596946e-01f,-2.472593216e-03f,-5.932322741e-01f,-2.467009472e-03f,
+-5.956993103e-01f,-2.461402444e-03f,-5.981606841e-01f,-2.455772366e-03f,-6.006164551e-01f,-2.450119238e-03f,-6.030666232e-01f,-2.444442827e-03f,
+-6.055110693e-01f,-2.438743599e-03f,-6.079497933e-01f,-2.433021320e-03f,-6.103827953e-01f,-2.427276224e-03f,-6.128100753e-01f,-2.421508078e-03f,
+-6.152315736e-01f,-2.415717347e-03f,-6.176472902e-01f,-2.409903798e-03f,-6.200572252e-01f,-2.404067665e-03f,-6.224612594e-01f,-2.398208715e-03f,
+-6.248595119e-01f,-2.392327413e-03f,-6.272518039e-01f,-2.386423526e-03f,-6.296382546e-01f,-2.380497055e-03f,-6.320187449e-01f,-2.374548232e-03f,
+-6.343932748e-01f,-2.368577057e-03f,-6.367618442e-01f,-2.362583531e-03f,-6.391244531e-01f,-2.356567886e-03f,-6.414810419e-01f,-2.350530121e-03f,
+-6.438315511e-01f,-2.344470005e-03f,-6.461760402e-01f,-2.338388003e-03f,-6.485143900e-01f,-2.332283882e-03f,-6.508466601e-01f,-2.326157875e-03f,
+-6.531728506e-01f,-2.320009982e-03f,-6.554928422e-01f,-2.313840203e-03f,-6.578066945e-01f,-2.307648771e-03f,-6.601143479e-01f,-2.301435452e-03f,
+-6.624158025e-01f,-2.295200713e-03f,-6.647109985e-01f,-2.288944088e-03f,-6.669999361e-01f,-2.282666042e-03f,-6.692826152e-01f,-2.276366577e-03f,
+-6.715589762e-01f,-2.270045457e-03f,-6.738290191e-01f,-2.263703151e-03f,-6.760926843e-01f,-2.257339656e-03f,-6.783500314e-01f,-2.250954742e-03f,
+-6.806010008e-01f,-2.244548639e-03f,-6.828455329e-01f,-2.238121349e-03f,-6.850836873e-01f,-2.231673105e-03f,-6.873153448e-01f,-2.225203905e-03f,
+-6.895405650e-01f,-2.218713518e-03f,-6.917592287e-01f,-2.212202409e-03f,-6.939714551e-01f,-2.205670578e-03f,-6.961771250e-01f,-2.199118026e-03f,
+-6.983762383e-01f,-2.192544518e-03f,-7.005687952e-01f,-2.185950521e-03f,-7.027547359e-01f,-2.179335803e-03f,-7.049340606e-01f,-2.172700828e-03f,
+-7.071067691e-01f,-2.166045364e-03f,-7.092728019e-01f,-2.159369411e-03f,-7.114322186e-01f,-2.152672969e-03f,-7.135848403e-01f,-2.145956503e-03f,
+-7.157308459e-01f,-2.139219781e-03f,-7.178700566e-01f,-2.132462803e-03f,-7.200025320e-01f,-2.125686035e-03f,-7.221282125e-01f,-2.118889010e-03f,
+-7.242470980e-01f,-2.112072194e-03f,-7.263591290e-01f,-2.105235355e-03f,-7.284643650e-01f,-2.098378725e-03f,-7.305627465e-01f,-2.091502538e-03f,
+-7.326542735e-01f,-2.084606327e-03f,-7.347388864e-01f,-2.077690791e-03f,-7.368165851e-01f,-2.070755698e-03f,-7.388873100e-01f,-2.063800814e-03f,
+-7.409511209e-01f,-2.056826837e-03f,-7.430079579e-01f,-2.049833303e-03f,-7.450577617e-01f,-2.042820444e-03f,-7.471005917e-01f,-2.035788493e-03f,
+-7.491363883e-01f,-2.028737450e-03f,-7.511651516e-01f,-2.021667082e-03f,-7.531868219e-01f,-2.014577854e-03f,-7.552013993e-01f,-2.007469535e-03f,
+-7.572088242e-01f,-2.000342356e-03f,-7.592092156e-01f,-1.993196551e-03f,-7.612023950e-01f,-1.986031886e-03f,-7.631884217e-01f,-1.978848362e-03f,
+-7.651672363e-01f,-1.971646212e-03f,-7.671388984e-01f,-1.964425668e-03f,-7.691033483e-01f,-1.957186731e-03f,-7.710605264e-01f,-1.949929050e-03f,
+-7.730104327e-01f,-1.942653209e-03f,-7.749531269e-01f,-1.935359091e-03f,-7.768884897e-01f,-1.928046695e-03f,-7.788165212e-01f,-1.920716139e-03f,
+-7.807372212e-01f,-1.913367538e-03f,-7.826505899e-01f,-1.906001009e-03f,-7.845565677e-01f,-1.898616436e-03f,-7.864552140e-01f,-1.891214051e-03f,
+-7.883464098e-01f,-1.883793855e-03f,-7.902302146e-01f,-1.876355847e-03f,-7.921065688e-01f,-1.868900261e-03f,-7.939754725e-01f,-1.861427096e-03f,
+-7.958369255e-01f,-1.853936352e-03f,-7.976908684e-01f,-1.846428146e-03f,-7.995372415e-01f,-1.838902594e-03f,-8.013761640e-01f,-1.831359812e-03f,
+-8.032075167e-01f,-1.823799685e-03f,-8.050313592e-01f,-1.816222444e-03f,-8.068475723e-01f,-1.808628091e-03f,-8.086561561e-01f,-1.801016624e-03f,
+-8.104571700e-01f,-1.793388277e-03f,-8.122506142e-01f,-1.785743167e-03f,-8.140363097e-01f,-1.778081059e-03f,-8.158144355e-01f,-1.770402305e-03f,
+-8.175848126e-01f,-1.762706903e-03f,-8.193475008e-01f,-1.754994970e-03f,-8.211025000e-01f,-1.747266389e-03f,-8.228498101e-01f,-1.739521394e-03f,
+-8.245893121e-01f,-1.731760101e-03f,-8.263210654e-01f,-1.723982394e-03f,-8.280450702e-01f,-1.716188504e-03f,-8.297612071e-01f,-1.708378550e-03f,
+-8.314695954e-01f,-1.700552413e-03f,-8.331701756e-01f,-1.692710328e-03f,-8.348628879e-01f,-1.684852294e-03f,-8.365477324e-01f,-1.676978311e-03f,
+-8.382247090e-01f,-1.669088611e-03f,-8.398938179e-01f,-1.661183196e-03f,-8.415549994e-01f,-1.653262181e-03f,-8.432082534e-01f,-1.645325567e-03f,
+-8.448535800e-01f,-1.637373469e-03f,-8.464909196e-01f,-1.629406004e-03f,-8.481203318e-01f,-1.621423173e-03f,-8.497417569e-01f,-1.613425091e-03f,
+-8.513551950e-01f,-1.605411875e-03f,-8.529605865e-01f,-1.597383409e-03f,-8.545579910e-01f,-1.589340041e-03f,-8.561473489e-01f,-1.581281656e-03f,
+-8.577286005e-01f,-1.573208370e-03f,-8.593018055e-01f,-1.565120299e-03f,-8.608669639e-01f,-1.557017444e-03f,-8.624239564e-01f,-1.548900036e-03f,
+-8.639728427e-01f,-1.540767960e-03f,-8.655136228e-01f,-1.532621449e-03f,-8.670462370e-01f,-1.524460502e-03f,-8.685706854e-01f,-1.516285120e-03f,
+-8.700869679e-01f,-1.508095535e-03f,-8.715950847e-01f,-1.499891747e-03f,-8.730949759e-01f,-1.491673873e-03f,-8.745866418e-01f,-1.483441913e-03f,
+-8.760700822e-01f,-1.475195982e-03f,-8.775452971e-01f,-1.466936199e-03f,-8.790122271e-01f,-1.458662678e-03f,-8.804708719e-01f,-1.450375305e-03f,
+-8.819212914e-01f,-1.442074310e-03f,-8.833633661e-01f,-1.433759811e-03f,-8.847970963e-01f,-1.425431692e-03f,-8.862225413e-01f,-1.417090301e-03f,
+-8.876396418e-01f,-1.408735407e-03f,-8.890483379e-01f,-1.400367357e-03f,-8.904487491e-01f,-1.391986152e-03f,-8.918406963e-01f,-1.383591793e-03f,
+-8.932242990e-01f,-1.375184394e-03f,-8.945994973e-01f,-1.366764074e-03f,-8.959662318e-01f,-1.358330948e-03f,-8.973245621e-01f,-1.349885017e-03f,
+-8.986744881e-01f,-1.341426279e-03f,-9.000158906e-01f,-1.332955086e-03f,-9.013488293e-01f,-1.324471203e-03f,-9.026733041e-01f,-1.315974863e-03f,
+-9.039893150e-01f,-1.307466184e-03f,-9.052967429e-01f,-1.298945164e-03f,-9.065957069e-01f,-1.290411921e-03f,-9.078860879e-01f,-1.281866571e-03f,
+-9.091680050e-01f,-1.273309113e-03f,-9.104412794e-01f,-1.264739782e-03f,-9.117060304e-01f,-1.256158459e-03f,-9.129621983e-01f,-1.247565262e-03f,
+-9.142097831e-01f,-1.238960424e-03f,-9.154487252e-01f,-1.230343827e-03f,-9.166790843e-01f,-1.221715705e-03f,-9.179008007e-01f,-1.213076059e-03f,
+-9.191138744e-01f,-1.204425003e-03f,-9.203183055e-01f,-1.195762656e-03f,-9.215140343e-01f,-1.187089016e-03f,-9.227011204e-01f,-1.178404200e-03f,
+-9.238795042e-01f,-1.169708325e-03f,-9.250492454e-01f,-1.161001390e-03f,-9.262102246e-01f,-1.152283512e-03f,-9.273625016e-01f,-1.143554808e-03f,
+-9.285060763e-01f,-1.134815393e-03f,-9.296408892e-01f,-1.126065268e-03f,-9.307669401e-01f,-1.117304550e-03f,-9.318842888e-01f,-1.108533237e-03f,
+-9.329928160e-01f,-1.099751564e-03f,-9.340925217e-01f,-1.090959529e-03f,-9.351835251e-01f,-1.082157250e-03f,-9.362656474e-01f,-1.073344727e-03f,
+-9.373390079e-01f,-1.064522192e-03f,-9.384035468e-01f,-1.055689529e-03f,-9.394592047e-01f,-1.046846970e-03f,-9.405060410e-01f,-1.037994632e-03f,
+-9.415440559e-01f,-1.029132400e-03f,-9.425731897e-01f,-1.020260504e-03f,-9.435934424e-01f,-1.011379063e-03f,-9.446048141e-01f,-1.002488076e-03f,
+-9.456073046e-01f,-9.935876587e-04f,-9.466009140e-01f,-9.846779285e-04f,-9.475855827e-01f,-9.757588850e-04f,-9.485613704e-01f,-9.668307030e-04f,
+-9.495281577e-01f,-9.578933823e-04f,-9.504860640e-01f,-9.489470394e-04f,-9.514350295e-01f,-9.399917326e-04f,-9.523749948e-01f,-9.310276364e-04f,
+-9.533060193e-01f,-9.220547508e-04f,-9.542281032e-01f,-9.130731924e-04f,-9.551411867e-01f,-9.040830191e-04f,-9.560452700e-01f,-8.950844058e-04f,
+-9.569403529e-01f,-8.860772941e-04f,-9.578264356e-01f,-8.770618588e-04f,-9.587034583e-01f,-8.680381579e-04f,-9.595715404e-01f,-8.590063080e-04f,
+-9.604305029e-01f,-8.499663672e-04f,-9.612804651e-01f,-8.409184520e-04f,-9.621214271e-01f,-8.318626205e-04f,-9.629532695e-01f,-8.227989310e-04f,
+-9.637760520e-01f,-8.137274999e-04f,-9.645897746e-01f,-8.046483854e-04f,-9.653944373e-01f,-7.955617621e-04f,-9.661899805e-01f,-7.864675717e-04f,
+-9.669764638e-01f,-7.773660473e-04f,-9.677538276e-01f,-7.682571886e-04f,-9.685220718e-01f,-7.591410540e-04f,-9.692812562e-01f,-7.500178181e-04f,
+-9.700312614e-01f,-7.408875390e-04f,-9.707721472e-01f,-7.317502750e-04f,-9.715039134e-01f,-7.226060843e-04f,-9.722265005e-01f,-7.134551415e-04f,
+-9.729399681e-01f,-7.042974466e-04f,-9.736442566e-01f,-6.951331161e-04f,-9.743393660e-01f,-6.859622663e-04f,-9.750253558e-01f,-6.767849554e-04f,
+-9.757021070e-01f,-6.676012999e-04f,-9.763697386e-01f,-6.584112998e-04f,-9.770281315e-01f,-6.492151879e-04f,-9.776773453e-01f,-6.400129059e-04f,
+-9.783173800e-01f,-6.308045704e-04f,-9.789481759e-01f,-6.215903559e-04f,-9.795697927e-01f,-6.123702624e-04f,-9.801821113e-01f,-6.031444063e-04f,
+-9.807852507e-01f,-5.939129042e-04f,-9.813792109e-01f,-5.846758140e-04f,-9.819638729e-01f,-5.754331942e-04f,-9.825392962e-01f,-5.661851610e-04f,
+-9.831054807e-01f,-5.569317727e-04f,-9.836624265e-01f,-5.476732040e-04f,-9.842100739e-01f,-5.384093965e-04f,-9.847484827e-01f,-5.291405832e-04f,
+-9.852776527e-01f,-5.198667641e-04f,-9.857975245e-01f,-5.105880555e-04f,-9.863080978e-01f,-5.013045738e-04f,-9.868093729e-01f,-4.920163192e-04f,
+-9.873014092e-01f,-4.827234952e-04f,-9.877841473e-01f,-4.734260729e-04f,-9.882575870e-01f,-4.641242267e-04f,-9.887216687e-01f,-4.548180150e-04f,
+-9.891765118e-01f,-4.455074959e-04f,-9.896219969e-01f,-4.361927859e-04f,-9.900581837e-01f,-4.268740013e-04f,-9.904850721e-01f,-4.175511713e-04f,
+-9.909026623e-01f,-4.082244122e-04f,-9.913108349e-01f,-3.988938115e-04f,-9.917097688e-01f,-3.895594855e-04f,-9.920992851e-01f,-3.802214633e-04f,
+-9.924795628e-01f,-3.708798613e-04f,-9.928504229e-01f,-3.615347669e-04f,-9.932119250e-01f,-3.521862964e-04f,-9.935641289e-01f,-3.428344789e-04f,
+-9.939069748e-01f,-3.334794601e-04f,-9.942404628e-01f,-3.241212689e-04f,-9.945645928e-01f,-3.147600510e-04f,-9.948793054e-01f,-3.053958644e-04f,
+-9.951847196e-01f,-2.960288257e-04f,-9.954807758e-01f,-2.866589639e-04f,-9.957674146e-01f,-2.772864245e-04f,-9.960446954e-01f,-2.679112949e-04f,
+-9.963126183e-01f,-2.585336042e-04f,-9.965711236e-01f,-2.491534979e-04f,-9.968202710e-01f,-2.397710487e-04f,-9.970600605e-01f,-2.303863439e-04f,
+-9.972904325e-01f,-2.209994564e-04f,-9.975114465e-01f,-2.116105024e-04f,-9.977230430e-01f,-2.022195549e-04f,-9.979252815e-01f,-1.928267011e-04f,
+-9.981181026e-01f,-1.834320283e-04f,-9.983015656e-01f,-1.740356383e-04f,-9.984755516e-01f,-1.646376040e-04f,-9.986402392e-01f,-1.552380272e-04f,
+-9.987954497e-01f,-1.458369807e-04f,-9.989413023e-01f,-1.364345662e-04f,-9.990777373e-01f,-1.270308712e-04f,-9.992047548e-01f,-1.176259684e-04f,
+-9.993223548e-01f,-1.082199669e-04f,-9.994305968e-01f,-9.881294682e-05f,-9.995294213e-01f,-8.940499538e-05f,-9.996188283e-01f,-7.999619993e-05f,
+-9.996988177e-01f,-7.058665506e-05f,-9.997693896e-01f,-6.117644807e-05f,-9.998306036e-01f,-5.176565901e-05f,-9.998823404e-01f,-4.235438610e-05f,
+-9.999247193e-01f,-3.294271301e-05f,-9.999576211e-01f,-2.353073069e-05f,-9.999811649e-01f,-1.411852736e-05f,-9.999952912e-01f,-4.706190339e-06f,
+-1.000000000e+00f,4.706190339e-06f,-9.999952912e-01f,1.411852736e-05f,-9.999811649e-01f,2.353073069e-05f,-9.999576211e-01f,3.294271301e-05f,
+-9.999247193e-01f,4.235438610e-05f,-9.998823404e-01f,5.176565901e-05f,-9.998306036e-01f,6.117644807e-05f,-9.997693896e-01f,7.058665506e-05f,
+-9.996988177e-01f,7.999619993e-05f,-9.996188283e-01f,8.940499538e-05f,-9.995294213e-01f,9.881294682e-05f,-9.994305968e-01f,1.082199669e-04f,
+-9.993223548e-01f,1.176259684e-04f,-9.992047548e-01f,1.270308712e-04f,-9.990777373e-01f,1.364345662e-04f,-9.989413023e-01f,1.458369807e-04f,
+-9.987954497e-01f,1.552380272e-04f,-9.986402392e-01f,1.646376040e-04f,-9.984755516e-01f,1.740356383e-04f,-9.983015656e-01f,1.834320283e-04f,
+-9.981181026e-01f,1.928267011e-04f,-9.979252815e-01f,2.022195549e-04f,-9.977230430e-01f,2.116105024e-04f,-9.975114465e-01f,2.209994564e-04f,
+-9.972904325e-01f,2.303863439e-04f,-9.970600605e-01f,2.397710487e-04f,-9.968202710e-01f,2.491534979e-04f,-9.965711236e-01f,2.585336042e-04f,
+-9.963126183e-01f,2.679112949e-04f,-9.960446954e-01f,2.772864245e-04f,-9.957674146e-01f,2.866589639e-04f,-9.954807758e-01f,2.960288257e-04f,
+-9.951847196e-01f,3.053958644e-04f,-9.948793054e-01f,3.147600510e-04f,-9.945645928e-01f,3.241212689e-04f,-9.942404628e-01f,3.334794601e-04f,
+-9.939069748e-01f,3.428344789e-04f,-9.935641289e-01f,3.521862964e-04f,-9.932119250e-01f,3.615347669e-04f,-9.928504229e-01f,3.708798613e-04f,
+-9.924795628e-01f,3.802214633e-04f,-9.920992851e-01f,3.895594855e-04f,-9.917097688e-01f,3.988938115e-04f,-9.913108349e-01f,4.082244122e-04f,
+-9.909026623e-01f,4.175511713e-04f,-9.904850721e-01f,4.268740013e-04f,-9.900581837e-01f,4.361927859e-04f,-9.896219969e-01f,4.455074959e-04f,
+-9.891765118e-01f,4.548180150e-04f,-9.887216687e-01f,4.641242267e-04f,-9.882575870e-01f,4.734260729e-04f,-9.877841473e-01f,4.827234952e-04f,
+-9.873014092e-01f,4.920163192e-04f,-9.868093729e-01f,5.013045738e-04f,-9.863080978e-01f,5.105880555e-04f,-9.857975245e-01f,5.198667641e-04f,
+-9.852776527e-01f,5.291405832e-04f,-9.847484827e-01f,5.384093965e-04f,-9.842100739e-01f,5.476732040e-04f,-9.836624265e-01f,5.569317727e-04f,
+-9.831054807e-01f,5.661851610e-04f,-9.825392962e-01f,5.754331942e-04f,-9.819638729e-01f,5.846758140e-04f,-9.813792109e-01f,5.939129042e-04f,
+-9.807852507e-01f,6.031444063e-04f,-9.801821113e-01f,6.123702624e-04f,-9.795697927e-01f,6.215903559e-04f,-9.789481759e-01f,6.308045704e-04f,
+-9.783173800e-01f,6.400129059e-04f,-9.776773453e-01f,6.492151879e-04f,-9.770281315e-01f,6.584112998e-04f,-9.763697386e-01f,6.676012999e-04f,
+-9.757021070e-01f,6.767849554e-04f,-9.750253558e-01f,6.859622663e-04f,-9.743393660e-01f,6.951331161e-04f,-9.736442566e-01f,7.042974466e-04f,
+-9.729399681e-01f,7.134551415e-04f,-9.722265005e-01f,7.226060843e-04f,-9.715039134e-01f,7.317502750e-04f,-9.707721472e-01f,7.408875390e-04f,
+-9.700312614e-01f,7.500178181e-04f,-9.692812562e-01f,7.591410540e-04f,-9.685220718e-01f,7.682571886e-04f,-9.677538276e-01f,7.773660473e-04f,
+-9.669764638e-01f,7.864675717e-04f,-9.661899805e-01f,7.955617621e-04f,-9.653944373e-01f,8.046483854e-04f,-9.645897746e-01f,8.137274999e-04f,
+-9.637760520e-01f,8.227989310e-04f,-9.629532695e-01f,8.318626205e-04f,-9.621214271e-01f,8.409184520e-04f,-9.612804651e-01f,8.499663672e-04f,
+-9.604305029e-01f,8.590063080e-04f,-9.595715404e-01f,8.680381579e-04f,-9.587034583e-01f,8.770618588e-04f,-9.578264356e-01f,8.860772941e-04f,
+-9.569403529e-01f,8.950844058e-04f,-9.560452700e-01f,9.040830191e-04f,-9.551411867e-01f,9.130731924e-04f,-9.542281032e-01f,9.220547508e-04f,
+-9.533060193e-01f,9.310276364e-04f,-9.523749948e-01f,9.399917326e-04f,-9.514350295e-01f,9.489470394e-04f,-9.504860640e-01f,9.578933823e-04f,
+-9.495281577e-01f,9.668307030e-04f,-9.485613704e-01f,9.757588850e-04f,-9.475855827e-01f,9.846779285e-04f,-9.466009140e-01f,9.935876587e-04f,
+-9.456073046e-01f,1.002488076e-03f,-9.446048141e-01f,1.011379063e-03f,-9.435934424e-01f,1.020260504e-03f,-9.425731897e-01f,1.029132400e-03f,
+-9.415440559e-01f,1.037994632e-03f,-9.405060410e-01f,1.046846970e-03f,-9.394592047e-01f,1.055689529e-03f,-9.384035468e-01f,1.064522192e-03f,
+-9.373390079e-01f,1.073344727e-03f,-9.362656474e-01f,1.082157250e-03f,-9.351835251e-01f,1.090959529e-03f,-9.340925217e-01f,1.099751564e-03f,
+-9.329928160e-01f,1.108533237e-03f,-9.318842888e-01f,1.117304550e-03f,-9.307669401e-01f,1.126065268e-03f,-9.296408892e-01f,1.134815393e-03f,
+-9.285060763e-01f,1.143554808e-03f,-9.273625016e-01f,1.152283512e-03f,-9.262102246e-01f,1.161001390e-03f,-9.250492454e-01f,1.169708325e-03f,
+-9.238795042e-01f,1.178404200e-03f,-9.227011204e-01f,1.187089016e-03f,-9.215140343e-01f,1.195762656e-03f,-9.203183055e-01f,1.204425003e-03f,
+-9.191138744e-01f,1.213076059e-03f,-9.179008007e-01f,1.221715705e-03f,-9.166790843e-01f,1.230343827e-03f,-9.154487252e-01f,1.238960424e-03f,
+-9.142097831e-01f,1.247565262e-03f,-9.129621983e-01f,1.256158459e-03f,-9.117060304e-01f,1.264739782e-03f,-9.104412794e-01f,1.273309113e-03f,
+-9.091680050e-01f,1.281866571e-03f,-9.078860879e-01f,1.290411921e-03f,-9.065957069e-01f,1.298945164e-03f,-9.052967429e-01f,1.307466184e-03f,
+-9.039893150e-01f,1.315974863e-03f,-9.026733041e-01f,1.324471203e-03f,-9.013488293e-01f,1.332955086e-03f,-9.000158906e-01f,1.341426279e-03f,
+-8.986744881e-01f,1.349885017e-03f,-8.973245621e-01f,1.358330948e-03f,-8.959662318e-01f,1.366764074e-03f,-8.945994973e-01f,1.375184394e-03f,
+-8.932242990e-01f,1.383591793e-03f,-8.918406963e-01f,1.391986152e-03f,-8.904487491e-01f,1.400367357e-03f,-8.890483379e-01f,1.408735407e-03f,
+-8.876396418e-01f,1.417090301e-03f,-8.862225413e-01f,1.425431692e-03f,-8.847970963e-01f,1.433759811e-03f,-8.833633661e-01f,1.442074310e-03f,
+-8.819212914e-01f,1.450375305e-03f,-8.804708719e-01f,1.458662678e-03f,-8.790122271e-01f,1.466936199e-03f,-8.775452971e-01f,1.475195982e-03f,
+-8.760700822e-01f,1.483441913e-03f,-8.745866418e-01f,1.491673873e-03f,-8.730949759e-01f,1.499891747e-03f,-8.715950847e-01f,1.508095535e-03f,
+-8.700869679e-01f,1.516285120e-03f,-8.685706854e-01f,1.524460502e-03f,-8.670462370e-01f,1.532621449e-03f,-8.655136228e-01f,1.540767960e-03f,
+-8.639728427e-01f,1.548900036e-03f,-8.624239564e-01f,1.557017444e-03f,-8.608669639e-01f,1.565120299e-03f,-8.593018055e-01f,1.573208370e-03f,
+-8.577286005e-01f,1.581281656e-03f,-8.561473489e-01f,1.589340041e-03f,-8.545579910e-01f,1.597383409e-03f,-8.529605865e-01f,1.605411875e-03f,
+-8.513551950e-01f,1.613425091e-03f,-8.497417569e-01f,1.621423173e-03f,-8.481203318e-01f,1.629406004e-03f,-8.464909196e-01f,1.637373469e-03f,
+-8.448535800e-01f,1.645325567e-03f,-8.432082534e-01f,1.653262181e-03f,-8.415549994e-01f,1.661183196e-03f,-8.398938179e-01f,1.669088611e-03f,
+-8.382247090e-01f,1.676978311e-03f,-8.365477324e-01f,1.684852294e-03f,-8.348628879e-01f,1.692710328e-03f,-8.331701756e-01f,1.700552413e-03f,
+-8.314695954e-01f,1.708378550e-03f,-8.297612071e-01f,1.716188504e-03f,-8.280450702e-01f,1.723982394e-03f,-8.263210654e-01f,1.731760101e-03f,
+-8.245893121e-01f,1.739521394e-03f,-8.228498101e-01f,1.747266389e-03f,-8.211025000e-01f,1.754994970e-03f,-8.193475008e-01f,1.762706903e-03f,
+-8.175848126e-01f,1.770402305e-03f,-8.158144355e-01f,1.778081059e-03f,-8.140363097e-01f,1.785743167e-03f,-8.122506142e-01f,1.793388277e-03f,
+-8.104571700e-01f,1.801016624e-03f,-8.086561561e-01f,1.808628091e-03f,-8.068475723e-01f,1.816222444e-03f,-8.050313592e-01f,1.823799685e-03f,
+-8.032075167e-01f,1.831359812e-03f,-8.013761640e-01f,1.838902594e-03f,-7.995372415e-01f,1.846428146e-03f,-7.976908684e-01f,1.853936352e-03f,
+-7.958369255e-01f,1.861427096e-03f,-7.939754725e-01f,1.868900261e-03f,-7.921065688e-01f,1.876355847e-03f,-7.902302146e-01f,1.883793855e-03f,
+-7.883464098e-01f,1.891214051e-03f,-7.864552140e-01f,1.898616436e-03f,-7.845565677e-01f,1.906001009e-03f,-7.826505899e-01f,1.913367538e-03f,
+-7.807372212e-01f,1.920716139e-03f,-7.788165212e-01f,1.928046695e-03f,-7.768884897e-01f,1.935359091e-03f,-7.749531269e-01f,1.942653209e-03f,
+-7.730104327e-01f,1.949929050e-03f,-7.710605264e-01f,1.957186731e-03f,-7.691033483e-01f,1.964425668e-03f,-7.671388984e-01f,1.971646212e-03f,
+-7.651672363e-01f,1.978848362e-03f,-7.631884217e-01f,1.986031886e-03f,-7.612023950e-01f,1.993196551e-03f,-7.592092156e-01f,2.000342356e-03f,
+-7.572088242e-01f,2.007469535e-03f,-7.552013993e-01f,2.014577854e-03f,-7.531868219e-01f,2.021667082e-03f,-7.511651516e-01f,2.028737450e-03f,
+-7.491363883e-01f,2.035788493e-03f,-7.471005917e-01f,2.042820444e-03f,-7.450577617e-01f,2.049833303e-03f,-7.430079579e-01f,2.056826837e-03f,
+-7.409511209e-01f,2.063800814e-03f,-7.388873100e-01f,2.070755698e-03f,-7.368165851e-01f,2.077690791e-03f,-7.347388864e-01f,2.084606327e-03f,
+-7.326542735e-01f,2.091502538e-03f,-7.305627465e-01f,2.098378725e-03f,-7.284643650e-01f,2.105235355e-03f,-7.263591290e-01f,2.112072194e-03f,
+-7.242470980e-01f,2.118889010e-03f,-7.221282125e-01f,2.125686035e-03f,-7.200025320e-01f,2.132462803e-03f,-7.178700566e-01f,2.139219781e-03f,
+-7.157308459e-01f,2.145956503e-03f,-7.135848403e-01f,2.152672969e-03f,-7.114322186e-01f,2.159369411e-03f,-7.092728019e-01f,2.166045364e-03f,
+-7.071067691e-01f,2.172700828e-03f,-7.049340606e-01f,2.179335803e-03f,-7.027547359e-01f,2.185950521e-03f,-7.005687952e-01f,2.192544518e-03f,
+-6.983762383e-01f,2.199118026e-03f,-6.961771250e-01f,2.205670578e-03f,-6.939714551e-01f,2.212202409e-03f,-6.917592287e-01f,2.218713518e-03f,
+-6.895405650e-01f,2.225203905e-03f,-6.873153448e-01f,2.231673105e-03f,-6.850836873e-01f,2.238121349e-03f,-6.828455329e-01f,2.244548639e-03f,
+-6.806010008e-01f,2.250954742e-03f,-6.783500314e-01f,2.257339656e-03f,-6.760926843e-01f,2.263703151e-03f,-6.738290191e-01f,2.270045457e-03f,
+-6.715589762e-01f,2.276366577e-03f,-6.692826152e-01f,2.282666042e-03f,-6.669999361e-01f,2.288944088e-03f,-6.647109985e-01f,2.295200713e-03f,
+-6.624158025e-01f,2.301435452e-03f,-6.601143479e-01f,2.307648771e-03f,-6.578066945e-01f,2.313840203e-03f,-6.554928422e-01f,2.320009982e-03f,
+-6.531728506e-01f,2.326157875e-03f,-6.508466601e-01f,2.332283882e-03f,-6.485143900e-01f,2.338388003e-03f,-6.461760402e-01f,2.344470005e-03f,
+-6.438315511e-01f,2.350530121e-03f,-6.414810419e-01f,2.356567886e-03f,-6.391244531e-01f,2.362583531e-03f,-6.367618442e-01f,2.368577057e-03f,
+-6.343932748e-01f,2.374548232e-03f,-6.320187449e-01f,2.380497055e-03f,-6.296382546e-01f,2.386423526e-03f,-6.272518039e-01f,2.392327413e-03f,
+-6.248595119e-01f,2.398208715e-03f,-6.224612594e-01f,2.404067665e-03f,-6.200572252e-01f,2.409903798e-03f,-6.176472902e-01f,2.415717347e-03f,
+-6.152315736e-01f,2.421508078e-03f,-6.128100753e-01f,2.427276224e-03f,-6.103827953e-01f,2.433021320e-03f,-6.079497933e-01f,2.438743599e-03f,
+-6.055110693e-01f,2.444442827e-03f,-6.030666232e-01f,2.450119238e-03f,-6.006164551e-01f,2.455772366e-03f,-5.981606841e-01f,2.461402444e-03f,
+-5.956993103e-01f,2.467009472e-03f,-5.932322741e-01f,2.472593216e-03f,-5.907596946e-01f,2.478153678e-03f,-5.882815719e-01f,2.483690856e-03f,
+-5.857978463e-01f,2.489204518e-03f,-5.833086371e-01f,2.494694898e-03f,-5.808139443e-01f,2.500161761e-03f,-5.783137679e-01f,2.505605109e-03f,
+-5.758081675e-01f,2.511024708e-03f,-5.732971430e-01f,2.516420791e-03f,-5.707807541e-01f,2.521793125e-03f,-5.682589412e-01f,2.527141944e-03f,
+-5.657318234e-01f,2.532466780e-03f,-5.631993413e-01f,2.537767868e-03f,-5.606615543e-01f,2.543044975e-03f,-5.581185222e-01f,2.548298100e-03f,
+-5.555702448e-01f,2.553527476e-03f,-5.530167222e-01f,2.558732638e-03f,-5.504579544e-01f,2.563913818e-03f,-5.478940606e-01f,2.569070784e-03f,
+-5.453249812e-01f,2.574203536e-03f,-5.427507758e-01f,2.579312073e-03f,-5.401714444e-01f,2.584396396e-03f,-5.375870466e-01f,2.589456504e-03f,
+-5.349976420e-01f,2.594491933e-03f,-5.324031115e-01f,2.599503146e-03f,-5.298036337e-01f,2.604489913e-03f,-5.271991491e-01f,2.609452000e-03f,
+-5.245896578e-01f,2.614389639e-03f,-5.219752789e-01f,2.619302832e-03f,-5.193560123e-01f,2.624191111e-03f,-5.167317986e-01f,2.629054710e-03f,
+-5.141027570e-01f,2.633893862e-03f,-5.114688277e-01f,2.638707869e-03f,-5.088301301e-01f,2.643497195e-03f,-5.061866641e-01f,2.648261609e-03f,
+-5.035383701e-01f,2.653001109e-03f,-5.008853674e-01f,2.657715697e-03f,-4.982276559e-01f,2.662405139e-03f,-4.955652654e-01f,2.667069668e-03f,
+-4.928981960e-01f,2.671709051e-03f,-4.902264774e-01f,2.676323056e-03f,-4.875501692e-01f,2.680912148e-03f,-4.848692417e-01f,2.685475862e-03f,
+-4.821837842e-01f,2.690014429e-03f,-4.794937670e-01f,2.694527619e-03f,-4.767992198e-01f,2.699015429e-03f,-4.741002023e-01f,2.703477861e-03f,
+-4.713967443e-01f,2.707914682e-03f,-4.686888158e-01f,2.712326357e-03f,-4.659765065e-01f,2.716712188e-03f,-4.632597864e-01f,2.721072640e-03f,
+-4.605387151e-01f,2.725407248e-03f,-4.578132927e-01f,2.729716478e-03f,-4.550835788e-01f,2.733999863e-03f,-4.523495734e-01f,2.738257637e-03f,
+-4.496113360e-01f,2.742489567e-03f,-4.468688369e-01f,2.746695653e-03f,-4.441221356e-01f,2.750875894e-03f,-4.413712621e-01f,2.755030291e-03f,
+-4.386162460e-01f,2.759158611e-03f,-4.358570874e-01f,2.763261087e-03f,-4.330938160e-01f,2.767337486e-03f,-4.303264916e-01f,2.771387808e-03f,
+-4.275550842e-01f,2.775412286e-03f,-4.247796834e-01f,2.779410454e-03f,-4.220002592e-01f,2.783382544e-03f,-4.192169011e-01f,2.787328325e-03f,
+-4.164295495e-01f,2.791247796e-03f,-4.136383235e-01f,2.795141190e-03f,-4.108431637e-01f,2.799008274e-03f,-4.080441594e-01f,2.802848816e-03f,
+-4.052413106e-01f,2.806663048e-03f,-4.024346471e-01f,2.810450969e-03f,-3.996241987e-01f,2.814212348e-03f,-3.968099952e-01f,2.817947417e-03f,
+-3.939920366e-01f,2.821655711e-03f,-3.911703825e-01f,2.825337695e-03f,-3.883450329e-01f,2.828992903e-03f,-3.855160475e-01f,2.832621569e-03f,
+-3.826834261e-01f,2.836223459e-03f,-3.798471987e-01f,2.839798806e-03f,-3.770074248e-01f,2.843347145e-03f,-3.741640747e-01f,2.846868942e-03f,
+-3.713172078e-01f,2.850363962e-03f,-3.684668243e-01f,2.853832208e-03f,-3.656129837e-01f,2.857273445e-03f,-3.627557158e-01f,2.860687906e-03f,
+-3.598950505e-01f,2.864075359e-03f,-3.570309579e-01f,2.867435804e-03f,-3.541635275e-01f,2.870769240e-03f,-3.512927592e-01f,2.874075901e-03f,
+-3.484186828e-01f,2.877355320e-03f,-3.455413282e-01f,2.880607732e-03f,-3.426607251e-01f,2.883832902e-03f,-3.397768736e-01f,2.887031063e-03f,
+-3.368898630e-01f,2.890201984e-03f,-3.339996636e-01f,2.893345663e-03f,-3.311063051e-01f,2.896462101e-03f,-3.282098472e-01f,2.899551531e-03f,
+-3.253102899e-01f,2.902613254e-03f,-3.224076927e-01f,2.905647969e-03f,-3.195020258e-01f,2.908655209e-03f,-3.165933788e-01f,2.911635209e-03f,
+-3.136817515e-01f,2.914587734e-03f,-3.107671440e-01f,2.917512786e-03f,-3.078496456e-01f,2.920410363e-03f,-3.049292266e-01f,2.923280466e-03f,
+-3.020059466e-01f,2.926123096e-03f,-2.990798354e-01f,2.928938018e-03f,-2.961508930e-01f,2.931725467e-03f,-2.932191491e-01f,2.934485441e-03f,
+-2.902846634e-01f,2.937217709e-03f,-2.873474658e-01f,2.939922269e-03f,-2.844075263e-01f,2.942599356e-03f,-2.814649343e-01f,2.945248503e-03f,
+-2.785196900e-01f,2.947870176e-03f,-2.755718231e-01f,2.950463910e-03f,-2.726213634e-01f,2.953029936e-03f,-2.696683109e-01f,2.955568023e-03f,
+-2.667127550e-01f,2.958078403e-03f,-2.637546659e-01f,2.960561076e-03f,-2.607941031e-01f,2.963015810e-03f,-2.578310966e-01f,2.965442603e-03f,
+-2.548656464e-01f,2.967841458e-03f,-2.518978119e-01f,2.970212372e-03f,-2.489276081e-01f,2.972555347e-03f,-2.459550500e-01f,2.974870382e-03f,
+-2.429801822e-01f,2.977157477e-03f,-2.400030196e-01f,2.979416400e-03f,-2.370236069e-01f,2.981647383e-03f,-2.340419590e-01f,2.983850194e-03f,
+-2.310581058e-01f,2.986025065e-03f,-2.280720770e-01f,2.988171764e-03f,-2.250839174e-01f,2.990290290e-03f,-2.220936269e-01f,2.992380876e-03f,
+-2.191012353e-01f,2.994443057e-03f,-2.161068022e-01f,2.996477066e-03f,-2.131103128e-01f,2.998483134e-03f,-2.101118416e-01f,3.000460798e-03f,
+-2.071113735e-01f,3.002410056e-03f,-2.041089684e-01f,3.004331142e-03f,-2.011046410e-01f,3.006224055e-03f,-1.980984062e-01f,3.008088795e-03f,
+-1.950903237e-01f,3.009924898e-03f,-1.920803934e-01f,3.011732828e-03f,-1.890686601e-01f,3.013512585e-03f,-1.860551536e-01f,3.015263705e-03f,
+-1.830398887e-01f,3.016986651e-03f,-1.800228953e-01f,3.018680960e-03f,-1.770042181e-01f,3.020347096e-03f,-1.739838719e-01f,3.021984594e-03f,
+-1.709618866e-01f,3.023593687e-03f,-1.679382920e-01f,3.025174374e-03f,-1.649131179e-01f,3.026726656e-03f,-1.618863940e-01f,3.028250532e-03f,
+-1.588581502e-01f,3.029745771e-03f,-1.558284014e-01f,3.031212371e-03f,-1.527971923e-01f,3.032650566e-03f,-1.497645378e-01f,3.034060122e-03f,
+-1.467304677e-01f,3.035441274e-03f,-1.436950266e-01f,3.036793787e-03f,-1.406582445e-01f,3.038117662e-03f,-1.376201212e-01f,3.039413132e-03f,
+-1.345807016e-01f,3.040679730e-03f,-1.315400302e-01f,3.041917924e-03f,-1.284981072e-01f,3.043127479e-03f,-1.254549772e-01f,3.044308163e-03f,
+-1.224106774e-01f,3.045460442e-03f,-1.193652153e-01f,3.046583850e-03f,-1.163186282e-01f,3.047678620e-03f,-1.132709533e-01f,3.048744984e-03f,
+-1.102222055e-01f,3.049782244e-03f,-1.071724221e-01f,3.050791100e-03f,-1.041216329e-01f,3.051771084e-03f,-1.010698602e-01f,3.052722430e-03f,
+-9.801714122e-02f,3.053644905e-03f,-9.496349841e-02f,3.054538742e-03f,-9.190895408e-02f,3.055403940e-03f,-8.885355294e-02f,3.056240268e-03f,
+-8.579730988e-02f,3.057047725e-03f,-8.274026215e-02f,3.057826543e-03f,-7.968243957e-02f,3.058576491e-03f,-7.662386447e-02f,3.059297800e-03f,
+-7.356456667e-02f,3.059990238e-03f,-7.050457597e-02f,3.060653806e-03f,-6.744392216e-02f,3.061288735e-03f,-6.438262761e-02f,3.061894560e-03f,
+-6.132073700e-02f,3.062471747e-03f,-5.825826526e-02f,3.063020064e-03f,-5.519524589e-02f,3.063539742e-03f,-5.213170499e-02f,3.064030316e-03f,
+-4.906767607e-02f,3.064492252e-03f,-4.600318149e-02f,3.064925084e-03f,-4.293825850e-02f,3.065329278e-03f,-3.987292573e-02f,3.065704601e-03f,
+-3.680722415e-02f,3.066051053e-03f,-3.374117240e-02f,3.066368634e-03f,-3.067480400e-02f,3.066657344e-03f,-2.760814503e-02f,3.066917183e-03f,
+-2.454122901e-02f,3.067148151e-03f,-2.147408016e-02f,3.067350481e-03f,-1.840673015e-02f,3.067523707e-03f,-1.533920597e-02f,3.067668062e-03f,
+-1.227153838e-02f,3.067783546e-03f,-9.203754365e-03f,3.067870159e-03f,-6.135884672e-03f,3.067927901e-03f,-3.067956772e-03f,3.067956772e-03f,
+-2.449293705e-16f,3.067956772e-03f
+};
+
+static const float mixerPanLEntries[34] = {
+1.000000000e+00f,-4.815280437e-03f,9.951847196e-01f,-1.439946890e-02f,9.807852507e-01f,-2.384489775e-02f,9.569403529e-01f,-3.306084871e-02f,
+9.238795042e-01f,-4.195821285e-02f,8.819212914e-01f,-5.045169592e-02f,8.314695954e-01f,-5.845910311e-02f,7.730104923e-01f,-6.590372324e-02f,
+7.071067691e-01f,-7.271349430e-02f,6.343932748e-01f,-7.882302999e-02f,5.555702448e-01f,-8.417347074e-02f,4.713967741e-01f,-8.871334791e-02f,
+3.826834261e-01f,-9.239879251e-02f,2.902846336e-01f,-9.519428015e-02f,1.950903535e-01f,-9.707321972e-02f,9.801713377e-02f,-9.801717848e-02f,
+-4.371138829e-08f,0.000000000e+00f
+};
+
+static const float mixerPanREntries[34] = {
+0.000000000e+00f,9.801714122e-02f,9.801714122e-02f,9.707318246e-02f,1.950903237e-01f,9.519433975e-02f,2.902846634e-01f,9.239879251e-02f,
+3.826834559e-01f,8.871325850e-02f,4.713967144e-01f,8.417353034e-02f,5.555702448e-01f,7.882302999e-02f,6.343932748e-01f,7.271349430e-02f,
+7.071067691e-01f,6.590366364e-02f,7.730104327e-01f,5.845916271e-02f,8.314695954e-01f,5.045163631e-02f,8.819212317e-01f,4.195827246e-02f,
+9.238795042e-01f,3.306084871e-02f,9.569403529e-01f,2.384489775e-02f,9.807852507e-01f,1.439946890e-02f,9.951847196e-01f,4.815280437e-03f,
+1.000000000e+00f,0.000000000e+00f
+};
+
+static const float exp2Entries[514] = {
+4.000000000e+00f,1.465317905e-01f,4.146531582e+00f,1.518996954e-01f,4.298431396e+00f,1.574642211e-01f,4.455895901e+00f,1.632318348e-01f,
+4.619127750e+00f,1.692122668e-01f,4.788339615e+00f,1.754110008e-01f,4.963750839e+00f,1.818368286e-01f,5.145587444e+00f,1.884980500e-01f,
+5.334085464e+00f,1.954032928e-01f,5.529489040e+00f,2.025614828e-01f,5.732050419e+00f,2.099819183e-01f,5.942032337e+00f,2.176731527e-01f,
+6.159705639e+00f,2.256481797e-01f,6.385353565e+00f,2.339143306e-01f,6.619267941e+00f,2.424833030e-01f,6.861751556e+00f,2.513661981e-01f,
+7.113117695e+00f,2.605744600e-01f,7.373692036e+00f,2.701200843e-01f,7.643812180e+00f,2.800153792e-01f,7.923827648e+00f,2.902718186e-01f,
+8.214098930e+00f,3.009066880e-01f,8.515006065e+00f,3.119297922e-01f,8.826935768e+00f,3.233566880e-01f,9.150292397e+00f,3.352021873e-01f,
+9.485494614e+00f,3.474816382e-01f,9.832976341e+00f,3.602109253e-01f,1.019318676e+01f,3.734064996e-01f,1.056659412e+01f,3.870854974e-01f,
+1.095367908e+01f,4.012655616e-01f,1.135494518e+01f,4.159651101e-01f,1.177091026e+01f,4.312031567e-01f,1.220211315e+01f,4.469993711e-01f,
+1.264911270e+01f,4.633742869e-01f,1.311248684e+01f,4.803467989e-01f,1.359283352e+01f,4.979455769e-01f,1.409077930e+01f,5.161867738e-01f,
+1.460696602e+01f,5.350962281e-01f,1.514206219e+01f,5.546984076e-01f,1.569676018e+01f,5.750186443e-01f,1.627178001e+01f,5.960832834e-01f,
+1.686786270e+01f,6.179195642e-01f,1.748578262e+01f,6.405557394e-01f,1.812633705e+01f,6.640211940e-01f,1.879035950e+01f,6.883462667e-01f,
+1.947870445e+01f,7.135557532e-01f,2.019226074e+01f,7.397020459e-01f,2.093196297e+01f,7.667995095e-01f,2.169876289e+01f,7.948896885e-01f,
+2.249365234e+01f,8.240088224e-01f,2.331766129e+01f,8.541947007e-01f,2.417185593e+01f,8.854863644e-01f,2.505734253e+01f,9.179243445e-01f,
+2.597526550e+01f,9.515506029e-01f,2.692681694e+01f,9.864087105e-01f,2.791322517e+01f,1.022543788e+00f,2.893577003e+01f,1.060002565e+00f,
+2.999577141e+01f,1.098833561e+00f,3.109460640e+01f,1.139087081e+00f,3.223369217e+01f,1.180815220e+00f,3.341450882e+01f,1.224060535e+00f,
+3.463856888e+01f,1.268912911e+00f,3.590748215e+01f,1.315396905e+00f,3.722287750e+01f,1.363583803e+00f,3.858646393e+01f,1.413535953e+00f,
+3.999999619e+01f,1.465317845e+00f,4.146531677e+01f,1.518996835e+00f,4.298431396e+01f,1.574642181e+00f,4.455895615e+01f,1.632325888e+00f,
+4.619128036e+01f,1.692122817e+00f,4.788340378e+01f,1.754110336e+00f,4.963751221e+01f,1.818368554e+00f,5.145588303e+01f,1.884980679e+00f,
+5.334086227e+01f,1.954033136e+00f,5.529489517e+01f,2.025615215e+00f,5.732051086e+01f,2.099819422e+00f,5.942033005e+01f,2.176721573e+00f,
+6.159705353e+01f,2.256481647e+00f,6.385353470e+01f,2.339143276e+00f,6.619268036e+01f,2.424833059e+00f,6.861750793e+01f,2.513661861e+00f,
+7.113117218e+01f,2.605744600e+00f,7.373691559e+01f,2.701200724e+00f,7.643811798e+01f,2.800153732e+00f,7.923827362e+01f,2.902731657e+00f,
+8.214099884e+01f,3.009067059e+00f,8.515007019e+01f,3.119298220e+00f,8.826937103e+01f,3.233567238e+00f,9.150293732e+01f,3.352022409e+00f,
+9.485495758e+01f,3.474816799e+00f,9.832977295e+01f,3.602109671e+00f,1.019318848e+02f,3.734030485e+00f,1.056659164e+02f,3.870854139e+00f,
+1.095367661e+02f,4.012654781e+00f,1.135494232e+02f,4.159650326e+00f,1.177090759e+02f,4.312030315e+00f,1.220211029e+02f,4.469993114e+00f,
+1.264910965e+02f,4.633741856e+00f,1.311248322e+02f,4.803489685e+00f,1.359283295e+02f,4.979455471e+00f,1.409077911e+02f,5.161867619e+00f,
+1.460696564e+02f,5.350962162e+00f,1.514206085e+02f,5.546983719e+00f,1.569675903e+02f,5.750185966e+00f,1.627177887e+02f,5.960832119e+00f,
+1.686786194e+02f,6.179194927e+00f,1.748578186e+02f,6.405497551e+00f,1.812633057e+02f,6.640209675e+00f,1.879035187e+02f,6.883460045e+00f,
+1.947869720e+02f,7.135621548e+00f,2.019225922e+02f,7.397020340e+00f,2.093196259e+02f,7.667994976e+00f,2.169876099e+02f,7.948896408e+00f,
+2.249365082e+02f,8.240087509e+00f,2.331766052e+02f,8.541946411e+00f,2.417185516e+02f,8.854863167e+00f,2.505734100e+02f,9.179157257e+00f,
+2.597525635e+02f,9.515591621e+00f,2.692681580e+02f,9.863994598e+00f,2.791321411e+02f,1.022552967e+01f,2.893576660e+02f,1.059992599e+01f,
+2.999576111e+02f,1.098843479e+01f,3.109460449e+02f,1.139076424e+01f,3.223367920e+02f,1.180825806e+01f,3.341450500e+02f,1.224060440e+01f,
+3.463856812e+02f,1.268924713e+01f,3.590749207e+02f,1.315384960e+01f,3.722287598e+02f,1.363596535e+01f,3.858647156e+02f,1.413523102e+01f,
+3.999999695e+02f,1.465304089e+01f,4.146530151e+02f,1.519010448e+01f,4.298431091e+02f,1.574627304e+01f,4.455893860e+02f,1.632340622e+01f,
+4.619127808e+02f,1.692107010e+01f,4.788338623e+02f,1.754125977e+01f,4.963751221e+02f,1.818351364e+01f,5.145586548e+02f,1.884997559e+01f,
+5.334086304e+02f,1.954014778e+01f,5.529487305e+02f,2.025633240e+01f,5.732050781e+02f,2.099799538e+01f,5.942030640e+02f,2.176761436e+01f,
+6.159707031e+02f,2.256461143e+01f,6.385353394e+02f,2.339165115e+01f,6.619269409e+02f,2.424810982e+01f,6.861750488e+02f,2.513685226e+01f,
+7.113119507e+02f,2.605720901e+01f,7.373691406e+02f,2.701175308e+01f,7.643808594e+02f,2.800178719e+01f,7.923826904e+02f,2.902704239e+01f,
+8.214097290e+02f,3.009094238e+01f,8.515006714e+02f,3.119268799e+01f,8.826933594e+02f,3.233596420e+01f,9.150292969e+02f,3.351990891e+01f,
+9.485491943e+02f,3.474848175e+01f,9.832976685e+02f,3.602075577e+01f,1.019318481e+03f,3.734099197e+01f,1.056659424e+03f,3.870819092e+01f,
+1.095367676e+03f,4.012692261e+01f,1.135494507e+03f,4.159612656e+01f,1.177090698e+03f,4.312070465e+01f,1.220211426e+03f,4.469952393e+01f,
+1.264910889e+03f,4.633698273e+01f,1.311247925e+03f,4.803532791e+01f,1.359283203e+03f,4.979408646e+01f,1.409077271e+03f,5.161914062e+01f,
+1.460696411e+03f,5.350911713e+01f,1.514205566e+03f,5.547033310e+01f,1.569675903e+03f,5.750131989e+01f,1.627177246e+03f,5.960885620e+01f,
+1.686786133e+03f,6.179137039e+01f,1.748577393e+03f,6.405614471e+01f,1.812633545e+03f,6.640148926e+01f,1.879035034e+03f,6.883524323e+01f,
+1.947870361e+03f,7.135556793e+01f,2.019225952e+03f,7.397089386e+01f,2.093196777e+03f,7.667925262e+01f,2.169875977e+03f,7.948821259e+01f,
+2.249364258e+03f,8.240161896e+01f,2.331765869e+03f,8.541866302e+01f,2.417184570e+03f,8.854942322e+01f,2.505733887e+03f,9.179156494e+01f,
+2.597525635e+03f,9.515590668e+01f,2.692681396e+03f,9.863993835e+01f,2.791321289e+03f,1.022552872e+02f,2.893576660e+03f,1.059992523e+02f,
+2.999575928e+03f,1.098843384e+02f,3.109460205e+03f,1.139076309e+02f,3.223367920e+03f,1.180825729e+02f,3.341450439e+03f,1.224060364e+02f,
+3.463856445e+03f,1.268924637e+02f,3.590749023e+03f,1.315384979e+02f,3.722287354e+03f,1.363570862e+02f,3.858644531e+03f,1.413548584e+02f,
+3.999999512e+03f,1.465304108e+02f,4.146529785e+03f,1.519010315e+02f,4.298430664e+03f,1.574627228e+02f,4.455893555e+03f,1.632340546e+02f,
+4.619127441e+03f,1.692106781e+02f,4.788338379e+03f,1.754125977e+02f,4.963750977e+03f,1.818351288e+02f,5.145585938e+03f,1.884997559e+02f,
+5.334085938e+03f,1.954014587e+02f,5.529487305e+03f,2.025633240e+02f,5.732050781e+03f,2.099799500e+02f,5.942030762e+03f,2.176761322e+02f,
+6.159706543e+03f,2.256461029e+02f,6.385352539e+03f,2.339121094e+02f,6.619265137e+03f,2.424854584e+02f,6.861750488e+03f,2.513638000e+02f,
+7.113114258e+03f,2.605767822e+02f,7.373690918e+03f,2.701175232e+02f,7.643808594e+03f,2.800178528e+02f,7.923826172e+03f,2.902704163e+02f,
+8.214096680e+03f,3.009093933e+02f,8.515005859e+03f,3.119268799e+02f,8.826932617e+03f,3.233596191e+02f,9.150292969e+03f,3.351990662e+02f,
+9.485491211e+03f,3.474847717e+02f,9.832976562e+03f,3.602008057e+02f,1.019317773e+04f,3.734096375e+02f,1.056658691e+04f,3.870816345e+02f,
+1.095366895e+04f,4.012689209e+02f,1.135493750e+04f,4.159609680e+02f,1.177089844e+04f,4.312067566e+02f,1.220210547e+04f,4.469949036e+02f,
+1.264910059e+04f,4.633781738e+02f,1.311247852e+04f,4.803442688e+02f,1.359282227e+04f,4.979405212e+02f,1.409076270e+04f,5.161910400e+02f,
+1.460695410e+04f,5.350908203e+02f,1.514204492e+04f,5.547029419e+02f,1.569674805e+04f,5.750127563e+02f,1.627176074e+04f,5.960881348e+02f,
+1.686784961e+04f,6.179132690e+02f,1.748576172e+04f,6.405610352e+02f,1.812632227e+04f,6.640144653e+02f,1.879033789e+04f,6.883519287e+02f,
+1.947868945e+04f,7.135551758e+02f,2.019224414e+04f,7.397083740e+02f,2.093195312e+04f,7.667919922e+02f,2.169874414e+04f,7.948964844e+02f,
+2.249364062e+04f,8.240007324e+02f,2.331764258e+04f,8.541860352e+02f,2.417182812e+04f,8.854936523e+02f,2.505732227e+04f,9.179149780e+02f,
+2.597523633e+04f,9.515584106e+02f,2.692679492e+04f,9.863986816e+02f,2.791319336e+04f,1.022552185e+03f,2.893574609e+04f,1.059991821e+03f,
+2.999573828e+04f,1.098842651e+03f,3.109458008e+04f,1.139075562e+03f,3.223365625e+04f,1.180824951e+03f,3.341448047e+04f,1.224059570e+03f,
+3.463853906e+04f,1.268923706e+03f,3.590746484e+04f,1.315384033e+03f,3.722284766e+04f,1.363595459e+03f,3.858644531e+04f,1.413521973e+03f,
+3.999996484e+04f,1.465302979e+03f
+};
+
+static const float exp2ExLowEntries[514] = {
+2.000000000e+00f,4.182444140e-02f,2.041824341e+00f,4.269908369e-02f,2.084523439e+00f,4.359201714e-02f,2.128115654e+00f,4.450344294e-02f,
+2.172619104e+00f,4.543428868e-02f,2.218053341e+00f,4.638442025e-02f,2.264437675e+00f,4.735442251e-02f,2.311792135e+00f,4.834470898e-02f,
+2.360136747e+00f,4.935570434e-02f,2.409492493e+00f,5.038784072e-02f,2.459880352e+00f,5.144135654e-02f,2.511321783e+00f,5.251731724e-02f,
+2.563838959e+00f,5.361557007e-02f,2.617454529e+00f,5.473678932e-02f,2.672191381e+00f,5.588145927e-02f,2.728072882e+00f,5.705006421e-02f,
+2.785122871e+00f,5.824310705e-02f,2.843366146e+00f,5.946109816e-02f,2.902827024e+00f,6.070431694e-02f,2.963531494e+00f,6.197402626e-02f,
+3.025505543e+00f,6.327003986e-02f,3.088775396e+00f,6.459315866e-02f,3.153368711e+00f,6.594394147e-02f,3.219312668e+00f,6.732297689e-02f,
+3.286635637e+00f,6.873085350e-02f,3.355366468e+00f,7.016788423e-02f,3.425534248e+00f,7.163552940e-02f,3.497169971e+00f,7.313358784e-02f,
+3.570303440e+00f,7.466297597e-02f,3.644966364e+00f,7.622434199e-02f,3.721190691e+00f,7.781836390e-02f,3.799009085e+00f,7.944571972e-02f,
+3.878454924e+00f,8.110678196e-02f,3.959561586e+00f,8.280356228e-02f,4.042365074e+00f,8.453483880e-02f,4.126900196e+00f,8.630264550e-02f,
+4.213202477e+00f,8.810671419e-02f,4.301309586e+00f,8.994993567e-02f,4.391259193e+00f,9.183098376e-02f,4.483090401e+00f,9.375137836e-02f,
+4.576841831e+00f,9.571192414e-02f,4.672553539e+00f,9.771347791e-02f,4.770267010e+00f,9.975688159e-02f,4.870023727e+00f,1.018430218e-01f,
+4.971867085e+00f,1.039727852e-01f,5.075839996e+00f,1.061470807e-01f,5.181986809e+00f,1.083668545e-01f,5.290353775e+00f,1.106330454e-01f,
+5.400986671e+00f,1.129466295e-01f,5.513933182e+00f,1.153085977e-01f,5.629241943e+00f,1.177199557e-01f,5.746962070e+00f,1.201807708e-01f,
+5.867142677e+00f,1.226949841e-01f,5.989837646e+00f,1.252608150e-01f,6.115098476e+00f,1.278802902e-01f,6.242978573e+00f,1.305545568e-01f,
+6.373533249e+00f,1.332847327e-01f,6.506818295e+00f,1.360720247e-01f,6.642889977e+00f,1.389175802e-01f,6.781807899e+00f,1.418226659e-01f,
+6.923630238e+00f,1.447884887e-01f,7.068418980e+00f,1.478163451e-01f,7.216235161e+00f,1.509075016e-01f,7.367142677e+00f,1.540633142e-01f,
+7.521205902e+00f,1.572851241e-01f,7.678491116e+00f,1.605730057e-01f,7.839064121e+00f,1.639322490e-01f,8.002996445e+00f,1.673604250e-01f,
+8.170356750e+00f,1.708603054e-01f,8.341217041e+00f,1.744333804e-01f,8.515650749e+00f,1.780811697e-01f,8.693731308e+00f,1.818052381e-01f,
+8.875536919e+00f,1.856071949e-01f,9.061143875e+00f,1.894886494e-01f,9.250632286e+00f,1.934512854e-01f,9.444084167e+00f,1.974967718e-01f,
+9.641580582e+00f,2.016268671e-01f,9.843207359e+00f,2.058433294e-01f,1.004905128e+01f,2.101479769e-01f,1.025919914e+01f,2.145426422e-01f,
+1.047374153e+01f,2.190274298e-01f,1.069276905e+01f,2.236095518e-01f,1.091637897e+01f,2.282857299e-01f,1.114466476e+01f,2.330596894e-01f,
+1.137772369e+01f,2.379334867e-01f,1.161565781e+01f,2.429091930e-01f,1.185856628e+01f,2.479889691e-01f,1.210655594e+01f,2.531749606e-01f,
+1.235973072e+01f,2.584694326e-01f,1.261820030e+01f,2.638745904e-01f,1.288207436e+01f,2.693927884e-01f,1.315146732e+01f,2.750264108e-01f,
+1.342649364e+01f,2.807778120e-01f,1.370727158e+01f,2.866494954e-01f,1.399392128e+01f,2.926416099e-01f,1.428656292e+01f,2.987637520e-01f,
+1.458532619e+01f,3.050115705e-01f,1.489033794e+01f,3.113900423e-01f,1.520172787e+01f,3.179019094e-01f,1.551963043e+01f,3.245499432e-01f,
+1.584418011e+01f,3.313370049e-01f,1.617551613e+01f,3.382687271e-01f,1.651378632e+01f,3.453371525e-01f,1.685912323e+01f,3.525588512e-01f,
+1.721168137e+01f,3.599373996e-01f,1.757161903e+01f,3.674586117e-01f,1.793907738e+01f,3.751489818e-01f,1.831422615e+01f,3.829880655e-01f,
+1.869721413e+01f,3.910034597e-01f,1.908821869e+01f,3.991738260e-01f,1.948739243e+01f,4.075279534e-01f,1.989492035e+01f,4.160436094e-01f,
+2.031096268e+01f,4.247508049e-01f,2.073571396e+01f,4.336263537e-01f,2.116934013e+01f,4.427015185e-01f,2.161204147e+01f,4.519521594e-01f,
+2.206399536e+01f,4.614033997e-01f,2.252539825e+01f,4.710599184e-01f,2.299645805e+01f,4.809031188e-01f,2.347736168e+01f,4.909677207e-01f,
+2.396832848e+01f,5.012269616e-01f,2.446955490e+01f,5.117169023e-01f,2.498127174e+01f,5.224096775e-01f,2.550368118e+01f,5.333429575e-01f,
+2.603702545e+01f,5.444876552e-01f,2.658151245e+01f,5.558829308e-01f,2.713739586e+01f,5.674986243e-01f,2.770489502e+01f,5.793755651e-01f,
+2.828426933e+01f,5.914821625e-01f,2.887575150e+01f,6.038609743e-01f,2.947961235e+01f,6.164792180e-01f,3.009609222e+01f,6.293710470e-01f,
+3.072546387e+01f,6.425428987e-01f,3.136800575e+01f,6.559693813e-01f,3.202397537e+01f,6.696978807e-01f,3.269367218e+01f,6.836917996e-01f,
+3.337736511e+01f,6.980004907e-01f,3.407536697e+01f,7.125858068e-01f,3.478795242e+01f,7.274991870e-01f,3.551544952e+01f,7.427009940e-01f,
+3.625815201e+01f,7.582446337e-01f,3.701639557e+01f,7.740888000e-01f,3.779048538e+01f,7.902893424e-01f,3.858077621e+01f,8.068031669e-01f,
+3.938757706e+01f,8.236883879e-01f,4.021126556e+01f,8.409001231e-01f,4.105216599e+01f,8.584850430e-01f,4.191065216e+01f,8.764519095e-01f,
+4.278710175e+01f,8.947661519e-01f,4.368186951e+01f,9.134922624e-01f,4.459535980e+01f,9.325805306e-01f,4.552794266e+01f,9.520980716e-01f,
+4.648004150e+01f,9.719930291e-01f,4.745203400e+01f,9.923354387e-01f,4.844437027e+01f,1.013071179e+00f,4.945743942e+01f,1.034273267e+00f,
+5.049171448e+01f,1.055885315e+00f,5.154759979e+01f,1.077983499e+00f,5.262558365e+01f,1.100508928e+00f,5.372608948e+01f,1.123540998e+00f,
+5.484963226e+01f,1.147018433e+00f,5.599665070e+01f,1.171004891e+00f,5.716765594e+01f,1.195512295e+00f,5.836316681e+01f,1.220493674e+00f,
+5.958366013e+01f,1.246036768e+00f,6.082969666e+01f,1.272073865e+00f,6.210177231e+01f,1.298696518e+00f,6.340046692e+01f,1.325833917e+00f,
+6.472630310e+01f,1.353581667e+00f,6.607988739e+01f,1.381865978e+00f,6.746174622e+01f,1.410786390e+00f,6.887253571e+01f,1.440266132e+00f,
+7.031280518e+01f,1.470408678e+00f,7.178321075e+01f,1.501134276e+00f,7.328434753e+01f,1.532526016e+00f,7.481687164e+01f,1.564599633e+00f,
+7.638146973e+01f,1.597293377e+00f,7.797876740e+01f,1.630722284e+00f,7.960948944e+01f,1.664797783e+00f,8.127428436e+01f,1.699639559e+00f,
+8.297392273e+01f,1.735155106e+00f,8.470907593e+01f,1.771469235e+00f,8.648054504e+01f,1.808485746e+00f,8.828903198e+01f,1.846334696e+00f,
+9.013536835e+01f,1.884915590e+00f,9.202028656e+01f,1.924364090e+00f,9.394464874e+01f,1.964575410e+00f,9.590922546e+01f,2.005691051e+00f,
+9.791491699e+01f,2.047601938e+00f,9.996251678e+01f,2.090421438e+00f,1.020529404e+02f,2.134170771e+00f,1.041871109e+02f,2.178766251e+00f,
+1.063658752e+02f,2.224364758e+00f,1.085902405e+02f,2.270844698e+00f,1.108610840e+02f,2.318370342e+00f,1.131794510e+02f,2.366814613e+00f,
+1.155462723e+02f,2.416348696e+00f,1.179626160e+02f,2.466840506e+00f,1.204294586e+02f,2.518467903e+00f,1.229479294e+02f,2.571093559e+00f,
+1.255190201e+02f,2.624902725e+00f,1.281439209e+02f,2.679752350e+00f,1.308236694e+02f,2.735835791e+00f,1.335595093e+02f,2.793003559e+00f,
+1.363525085e+02f,2.851410866e+00f,1.392039185e+02f,2.911086798e+00f,1.421150055e+02f,2.971916676e+00f,1.450869293e+02f,3.034114361e+00f,
+1.481210480e+02f,3.097515106e+00f,1.512185516e+02f,3.162341356e+00f,1.543809052e+02f,3.228421450e+00f,1.576093140e+02f,3.295987606e+00f,
+1.609053040e+02f,3.364860296e+00f,1.642701721e+02f,3.435281754e+00f,1.677054443e+02f,3.507065296e+00f,1.712125092e+02f,3.580462933e+00f,
+1.747929840e+02f,3.655279875e+00f,1.784482574e+02f,3.731779575e+00f,1.821800385e+02f,3.809758425e+00f,1.859897919e+02f,3.889428377e+00f,
+1.898792267e+02f,3.970828295e+00f,1.938500519e+02f,4.053802490e+00f,1.979038544e+02f,4.138709545e+00f,2.020425720e+02f,4.225124836e+00f,
+2.062676849e+02f,4.313550472e+00f,2.105812378e+02f,4.403686047e+00f,2.149849243e+02f,4.495848656e+00f,2.194807739e+02f,4.589793682e+00f,
+2.240705719e+02f,4.685851097e+00f,2.287564240e+02f,4.783766270e+00f,2.335401917e+02f,4.883883476e+00f,2.384240723e+02f,4.985936642e+00f,
+2.434100037e+02f,5.090202808e+00f,2.485002136e+02f,5.196733475e+00f,2.536969452e+02f,5.305323601e+00f,2.590022583e+02f,5.416268826e+00f,
+2.644185486e+02f,5.529712677e+00f,2.699482422e+02f,5.645172119e+00f,2.755934143e+02f,5.763224125e+00f,2.813566284e+02f,5.883744717e+00f,
+2.872403870e+02f,6.006979942e+00f,2.932473755e+02f,6.132404327e+00f,2.993797607e+02f,6.260645390e+00f,3.056404114e+02f,6.391568661e+00f,
+3.120319824e+02f,6.525439739e+00f,3.185574341e+02f,6.661689758e+00f,3.252191162e+02f,6.800999165e+00f,3.320201111e+02f,6.943222046e+00f,
+3.389633484e+02f,7.088418961e+00f,3.460517578e+02f,7.236886024e+00f,3.532886353e+02f,7.387990475e+00f,3.606766357e+02f,7.542488575e+00f,
+3.682191162e+02f,7.700217724e+00f,3.759193420e+02f,7.861498833e+00f,3.837808533e+02f,8.025645256e+00f,3.918064880e+02f,8.193477631e+00f,
+3.999999695e+02f,8.364820480e+00f
+};
+
+static const float exp2ExHighEntries[1026] = {
+3.999999695e+02f,3.068075418e+00f,4.030680237e+02f,3.091339588e+00f,4.061593628e+02f,3.115319252e+00f,4.092746887e+02f,3.139214277e+00f,
+4.124139099e+02f,3.163017988e+00f,4.155769348e+02f,3.187553644e+00f,4.187644958e+02f,3.212002754e+00f,4.219764709e+02f,3.236358404e+00f,
+4.252128296e+02f,3.261462927e+00f,4.284743042e+02f,3.286193609e+00f,4.317604980e+02f,3.311684608e+00f,4.350721741e+02f,3.337085962e+00f,
+4.384092712e+02f,3.362390041e+00f,4.417716675e+02f,3.388472080e+00f,4.451601257e+02f,3.414165974e+00f,4.485743103e+02f,3.440649748e+00f,
+4.520149536e+02f,3.467040062e+00f,4.554819946e+02f,3.493329525e+00f,4.589753113e+02f,3.520427465e+00f,4.624957581e+02f,3.547429800e+00f,
+4.660431824e+02f,3.574328899e+00f,4.696174927e+02f,3.602055073e+00f,4.732195435e+02f,3.629368305e+00f,4.768489380e+02f,3.657521486e+00f,
+4.805064392e+02f,3.685575247e+00f,4.841920166e+02f,3.713521957e+00f,4.879055481e+02f,3.742327929e+00f,4.916478577e+02f,3.770704746e+00f,
+4.954185791e+02f,3.799954176e+00f,4.992185364e+02f,3.829100609e+00f,5.030476379e+02f,3.858135462e+00f,5.069057617e+02f,3.888063192e+00f,
+5.107938232e+02f,3.917885303e+00f,5.147117310e+02f,3.947593451e+00f,5.186593018e+02f,3.978214979e+00f,5.226375122e+02f,4.008380413e+00f,
+5.266459351e+02f,4.039473534e+00f,5.306853638e+02f,4.070457458e+00f,5.347558594e+02f,4.101322174e+00f,5.388571777e+02f,4.133136272e+00f,
+5.429902954e+02f,4.164476395e+00f,5.471547852e+02f,4.196780682e+00f,5.513515625e+02f,4.228970528e+00f,5.555805054e+02f,4.261037827e+00f,
+5.598415527e+02f,4.294090748e+00f,5.641356201e+02f,4.327027321e+00f,5.684627075e+02f,4.359837532e+00f,5.728225098e+02f,4.393657207e+00f,
+5.772161865e+02f,4.426972866e+00f,5.816431274e+02f,4.461312771e+00f,5.861044312e+02f,4.495532036e+00f,5.905999756e+02f,4.529620171e+00f,
+5.951296387e+02f,4.564756870e+00f,5.996943970e+02f,4.599769115e+00f,6.042941284e+02f,4.634647846e+00f,6.089287720e+02f,4.670598984e+00f,
+6.135993652e+02f,4.706014633e+00f,6.183054199e+02f,4.742519379e+00f,6.230479126e+02f,4.778895378e+00f,6.278267822e+02f,4.815132141e+00f,
+6.326419678e+02f,4.852483273e+00f,6.374944458e+02f,4.889278412e+00f,6.423837280e+02f,4.927204609e+00f,6.473109131e+02f,4.964997292e+00f,
+6.522758789e+02f,5.002645016e+00f,6.572785645e+02f,5.041450977e+00f,6.623200073e+02f,5.080119610e+00f,6.674001465e+02f,5.118640423e+00f,
+6.725187378e+02f,5.158346176e+00f,6.776771240e+02f,5.197460175e+00f,6.828745728e+02f,5.237777233e+00f,6.881123657e+02f,5.277951717e+00f,
+6.933903198e+02f,5.317972660e+00f,6.987082520e+02f,5.359224796e+00f,7.040675049e+02f,5.399861813e+00f,7.094673462e+02f,5.441748619e+00f,
+7.149091187e+02f,5.483488083e+00f,7.203925781e+02f,5.525067806e+00f,7.259176636e+02f,5.567925930e+00f,7.314855957e+02f,5.610632896e+00f,
+7.370961914e+02f,5.653176308e+00f,7.427493896e+02f,5.697028160e+00f,7.484464111e+02f,5.740227222e+00f,7.541866455e+02f,5.784754276e+00f,
+7.599714355e+02f,5.829124451e+00f,7.658005371e+02f,5.873324871e+00f,7.716738281e+02f,5.918884277e+00f,7.775927124e+02f,5.964283466e+00f,
+7.835570068e+02f,6.009508610e+00f,7.895665283e+02f,6.056124687e+00f,7.956226807e+02f,6.102046490e+00f,8.017247314e+02f,6.149380207e+00f,
+8.078740845e+02f,6.196547031e+00f,8.140706177e+02f,6.243533611e+00f,8.203141479e+02f,6.291965008e+00f,8.266061401e+02f,6.339674950e+00f,
+8.329458008e+02f,6.388851643e+00f,8.393346558e+02f,6.437855721e+00f,8.457725220e+02f,6.486671925e+00f,8.522591553e+02f,6.536989212e+00f,
+8.587961426e+02f,6.587129116e+00f,8.653833008e+02f,6.637077332e+00f,8.720203857e+02f,6.688561440e+00f,8.787089233e+02f,6.739278316e+00f,
+8.854482422e+02f,6.791555405e+00f,8.922397461e+02f,6.843647957e+00f,8.990834351e+02f,6.895541191e+00f,9.059789429e+02f,6.949029922e+00f,
+9.129279785e+02f,7.001722336e+00f,9.199296875e+02f,7.056035042e+00f,9.269857788e+02f,7.110156059e+00f,9.340958862e+02f,7.164070129e+00f,
+9.412599487e+02f,7.219642162e+00f,9.484796143e+02f,7.275018215e+00f,9.557546387e+02f,7.330182076e+00f,9.630848389e+02f,7.387042522e+00f,
+9.704718628e+02f,7.443056107e+00f,9.779149170e+02f,7.500792503e+00f,9.854157104e+02f,7.558324814e+00f,9.929740601e+02f,7.615637302e+00f,
+1.000589661e+03f,7.674712181e+00f,1.008264404e+03f,7.732906818e+00f,1.015997314e+03f,7.792891502e+00f,1.023790161e+03f,7.852664471e+00f,
+1.031642822e+03f,7.912208557e+00f,1.039555054e+03f,7.973583698e+00f,1.047528687e+03f,8.034742355e+00f,1.055563354e+03f,8.095667839e+00f,
+1.063659058e+03f,8.158466339e+00f,1.071817505e+03f,8.220329285e+00f,1.080037842e+03f,8.284094810e+00f,1.088321899e+03f,8.347635269e+00f,
+1.096669556e+03f,8.410932541e+00f,1.105080566e+03f,8.476176262e+00f,1.113556641e+03f,8.541190147e+00f,1.122097900e+03f,8.605955124e+00f,
+1.130703857e+03f,8.672712326e+00f,1.139376587e+03f,8.738474846e+00f,1.148114990e+03f,8.806259155e+00f,1.156921265e+03f,8.873805046e+00f,
+1.165795044e+03f,8.941092491e+00f,1.174736206e+03f,9.010448456e+00f,1.183746582e+03f,9.078771591e+00f,1.192825439e+03f,9.149196625e+00f,
+1.201974609e+03f,9.219372749e+00f,1.211193970e+03f,9.289279938e+00f,1.220483276e+03f,9.361337662e+00f,1.229844604e+03f,9.433140755e+00f,
+1.239277710e+03f,9.504669189e+00f,1.248782349e+03f,9.578396797e+00f,1.258360840e+03f,9.651026726e+00f,1.268011841e+03f,9.725890160e+00f,
+1.277737671e+03f,9.800489426e+00f,1.287538208e+03f,9.874803543e+00f,1.297412964e+03f,9.951402664e+00f,1.307364380e+03f,1.002686119e+01f,
+1.317391235e+03f,1.010464001e+01f,1.327495850e+03f,1.018214512e+01f,1.337678101e+03f,1.025935268e+01f,1.347937378e+03f,1.033893490e+01f,
+1.358276367e+03f,1.041823673e+01f,1.368694580e+03f,1.049723434e+01f,1.379191772e+03f,1.057866192e+01f,1.389770508e+03f,1.065887642e+01f,
+1.400429321e+03f,1.074155807e+01f,1.411170898e+03f,1.082394791e+01f,1.421994873e+03f,1.090602207e+01f,1.432900879e+03f,1.099062061e+01f,
+1.443891479e+03f,1.107492065e+01f,1.454966431e+03f,1.115889835e+01f,1.466125366e+03f,1.124545860e+01f,1.477370728e+03f,1.133072948e+01f,
+1.488701538e+03f,1.141862202e+01f,1.500120117e+03f,1.150620461e+01f,1.511626343e+03f,1.159345245e+01f,1.523219727e+03f,1.168338394e+01f,
+1.534903198e+03f,1.177197552e+01f,1.546675171e+03f,1.186329079e+01f,1.558538452e+03f,1.195428467e+01f,1.570492676e+03f,1.204493046e+01f,
+1.582537598e+03f,1.213836288e+01f,1.594676025e+03f,1.223146629e+01f,1.606907471e+03f,1.232421398e+01f,1.619231689e+03f,1.241981316e+01f,
+1.631651489e+03f,1.251398849e+01f,1.644165527e+03f,1.261106014e+01f,1.656776489e+03f,1.270778942e+01f,1.669484375e+03f,1.280414867e+01f,
+1.682288452e+03f,1.290347099e+01f,1.695192017e+03f,1.300131416e+01f,1.708193237e+03f,1.310216522e+01f,1.721295410e+03f,1.320266151e+01f,
+1.734498047e+03f,1.330277348e+01f,1.747800903e+03f,1.340596294e+01f,1.761206787e+03f,1.350878906e+01f,1.774715576e+03f,1.361122227e+01f,
+1.788326904e+03f,1.371680546e+01f,1.802043701e+03f,1.382081509e+01f,1.815864502e+03f,1.392802429e+01f,1.829792480e+03f,1.403485489e+01f,
+1.843827393e+03f,1.414127636e+01f,1.857968628e+03f,1.425097084e+01f,1.872219604e+03f,1.436027813e+01f,1.886579834e+03f,1.446916771e+01f,
+1.901049072e+03f,1.458140564e+01f,1.915630493e+03f,1.469197178e+01f,1.930322388e+03f,1.480593777e+01f,1.945128296e+03f,1.491950226e+01f,
+1.960047852e+03f,1.503263187e+01f,1.975080444e+03f,1.514924049e+01f,1.990229736e+03f,1.526411247e+01f,2.005493896e+03f,1.538251686e+01f,
+2.020876343e+03f,1.550050354e+01f,2.036376831e+03f,1.561803913e+01f,2.051994873e+03f,1.573918915e+01f,2.067734131e+03f,1.585991192e+01f,
+2.083593994e+03f,1.598017216e+01f,2.099574219e+03f,1.610413170e+01f,2.115678223e+03f,1.622624397e+01f,2.131904541e+03f,1.635211182e+01f,
+2.148256592e+03f,1.647753525e+01f,2.164734131e+03f,1.660247803e+01f,2.181336670e+03f,1.673126411e+01f,2.198067871e+03f,1.685813332e+01f,
+2.214926025e+03f,1.698890114e+01f,2.231915039e+03f,1.711920929e+01f,2.249034180e+03f,1.724901962e+01f,2.266283203e+03f,1.738282013e+01f,
+2.283666016e+03f,1.751614952e+01f,2.301182129e+03f,1.764896965e+01f,2.318831055e+03f,1.778587341e+01f,2.336616943e+03f,1.792073822e+01f,
+2.354537842e+03f,1.805974960e+01f,2.372597412e+03f,1.819827080e+01f,2.390795898e+03f,1.833626366e+01f,2.409132080e+03f,1.847849846e+01f,
+2.427610596e+03f,1.861861420e+01f,2.446229248e+03f,1.876304054e+01f,2.464992188e+03f,1.890695572e+01f,2.483899170e+03f,1.905032158e+01f,
+2.502949463e+03f,1.919642830e+01f,2.522145996e+03f,1.934533691e+01f,2.541491211e+03f,1.949202538e+01f,2.560983154e+03f,1.964322662e+01f,
+2.580626465e+03f,1.979389381e+01f,2.600420410e+03f,1.994398308e+01f,2.620364258e+03f,2.009869003e+01f,2.640463135e+03f,2.025285149e+01f,
+2.660715820e+03f,2.040642166e+01f,2.681122314e+03f,2.056471443e+01f,2.701687012e+03f,2.072065163e+01f,2.722407715e+03f,2.088138199e+01f,
+2.743289062e+03f,2.104154587e+01f,2.764330566e+03f,2.120109749e+01f,2.785531738e+03f,2.136555481e+01f,2.806897217e+03f,2.152943230e+01f,
+2.828426758e+03f,2.169268417e+01f,2.850119385e+03f,2.186095428e+01f,2.871980469e+03f,2.202672005e+01f,2.894007080e+03f,2.219758224e+01f,
+2.916204590e+03f,2.236784172e+01f,2.938572510e+03f,2.253744888e+01f,2.961109863e+03f,2.271227264e+01f,2.983822266e+03f,2.288449287e+01f,
+3.006706787e+03f,2.306200981e+01f,3.029768799e+03f,2.323889923e+01f,3.053007568e+03f,2.341511154e+01f,3.076422607e+03f,2.359674454e+01f,
+3.100019531e+03f,2.377773476e+01f,3.123797119e+03f,2.395803452e+01f,3.147755127e+03f,2.414387894e+01f,3.171899170e+03f,2.432695389e+01f,
+3.196226074e+03f,2.451565933e+01f,3.220741699e+03f,2.470369911e+01f,3.245445312e+03f,2.489101791e+01f,3.270336426e+03f,2.508409882e+01f,
+3.295420654e+03f,2.527430344e+01f,3.320694824e+03f,2.547035789e+01f,3.346165283e+03f,2.566571999e+01f,3.371830811e+03f,2.586033440e+01f,
+3.397691162e+03f,2.606093407e+01f,3.423752197e+03f,2.626082611e+01f,3.450012939e+03f,2.645995522e+01f,3.476472900e+03f,2.666520500e+01f,
+3.503138184e+03f,2.686739922e+01f,3.530005615e+03f,2.707581139e+01f,3.557081299e+03f,2.728348732e+01f,3.584364990e+03f,2.749036980e+01f,
+3.611855225e+03f,2.770361328e+01f,3.639558838e+03f,2.791610527e+01f,3.667474854e+03f,2.812778282e+01f,3.695602783e+03f,2.834597206e+01f,
+3.723948730e+03f,2.856091118e+01f,3.752509521e+03f,2.878245926e+01f,3.781291992e+03f,2.900322533e+01f,3.810295410e+03f,2.922314835e+01f,
+3.839518555e+03f,2.944983292e+01f,3.868968262e+03f,2.967314148e+01f,3.898641357e+03f,2.990331650e+01f,3.928544678e+03f,3.013268089e+01f,
+3.958677490e+03f,3.036116791e+01f,3.989038574e+03f,3.059667969e+01f,4.019635254e+03f,3.083136368e+01f,4.050466553e+03f,3.106514740e+01f,
+4.081531738e+03f,3.130611992e+01f,4.112837891e+03f,3.154350471e+01f,4.144381348e+03f,3.178818893e+01f,4.176169434e+03f,3.203200912e+01f,
+4.208201660e+03f,3.227489853e+01f,4.240476562e+03f,3.252525711e+01f,4.273001953e+03f,3.277188492e+01f,4.305773438e+03f,3.302610016e+01f,
+4.338799805e+03f,3.327941513e+01f,4.372079102e+03f,3.353176117e+01f,4.405610840e+03f,3.379187012e+01f,4.439402832e+03f,3.405105972e+01f,
+4.473454102e+03f,3.430925751e+01f,4.507763184e+03f,3.457539749e+01f,4.542338379e+03f,3.483757019e+01f,4.577176270e+03f,3.510780716e+01f,
+4.612283691e+03f,3.537709045e+01f,4.647661133e+03f,3.564534378e+01f,4.683306152e+03f,3.592184448e+01f,4.719228027e+03f,3.619737244e+01f,
+4.755425781e+03f,3.647184753e+01f,4.791897461e+03f,3.675476074e+01f,4.828652344e+03f,3.703345871e+01f,4.865685547e+03f,3.732072830e+01f,
+4.903006348e+03f,3.760698700e+01f,4.940613281e+03f,3.789214706e+01f,4.978505371e+03f,3.818607712e+01f,5.016691406e+03f,3.847563171e+01f,
+5.055166992e+03f,3.877408981e+01f,5.093941406e+03f,3.907149124e+01f,5.133012695e+03f,3.936775970e+01f,5.172380371e+03f,3.967313766e+01f,
+5.212053711e+03f,3.997743607e+01f,5.252031250e+03f,4.028057480e+01f,5.292311523e+03f,4.059303284e+01f,5.332904785e+03f,4.090083694e+01f,
+5.373805664e+03f,4.121810532e+01f,5.415023438e+03f,4.153425598e+01f,5.456558105e+03f,4.184919739e+01f,5.498407227e+03f,4.217382431e+01f,
+5.540581055e+03f,4.249361420e+01f,5.583074707e+03f,4.282323837e+01f,5.625897949e+03f,4.315169907e+01f,5.669049316e+03f,4.347890472e+01f,
+5.712528320e+03f,4.381617355e+01f,5.756344727e+03f,4.415225220e+01f,5.800496582e+03f,4.448704529e+01f,5.844983887e+03f,4.483213043e+01f,
+5.889815918e+03f,4.517208099e+01f,5.934988281e+03f,4.552248001e+01f,5.980510742e+03f,4.587164688e+01f,6.026382324e+03f,4.621947861e+01f,
+6.072601562e+03f,4.657800293e+01f,6.119179688e+03f,4.693119049e+01f,6.166110840e+03f,4.729523468e+01f,6.213406250e+03f,4.765800095e+01f,
+6.261063965e+03f,4.801937485e+01f,6.309083496e+03f,4.839186478e+01f,6.357475098e+03f,4.876303864e+01f,6.406238281e+03f,4.913279343e+01f,
+6.455371094e+03f,4.951391602e+01f,6.504885254e+03f,4.988936615e+01f,6.554774414e+03f,5.027635956e+01f,6.605050781e+03f,5.066198730e+01f,
+6.655712891e+03f,5.104614258e+01f,6.706758789e+03f,5.144210815e+01f,6.758201172e+03f,5.183668137e+01f,6.810037598e+03f,5.222974014e+01f,
+6.862267578e+03f,5.263488770e+01f,6.914902344e+03f,5.303400421e+01f,6.967936523e+03f,5.344538879e+01f,7.021381836e+03f,5.385532761e+01f,
+7.075237305e+03f,5.426369476e+01f,7.129500977e+03f,5.468461990e+01f,7.184185547e+03f,5.509927368e+01f,7.239284668e+03f,5.552668381e+01f,
+7.294811523e+03f,5.595258331e+01f,7.350764160e+03f,5.637685394e+01f,7.407140625e+03f,5.681417084e+01f,7.463955078e+03f,5.724994659e+01f,
+7.521205078e+03f,5.768405533e+01f,7.578889160e+03f,5.813151169e+01f,7.637020508e+03f,5.857230377e+01f,7.695592773e+03f,5.902665329e+01f,
+7.754619629e+03f,5.947939682e+01f,7.814098633e+03f,5.993041229e+01f,7.874029297e+03f,6.039529419e+01f,7.934424316e+03f,6.085325241e+01f,
+7.995277832e+03f,6.132529449e+01f,8.056603027e+03f,6.179566956e+01f,8.118398926e+03f,6.226424789e+01f,8.180663086e+03f,6.274723053e+01f,
+8.243410156e+03f,6.322851562e+01f,8.306638672e+03f,6.370795822e+01f,8.370346680e+03f,6.420214081e+01f,8.434548828e+03f,6.468896484e+01f,
+8.499238281e+03f,6.519075775e+01f,8.564428711e+03f,6.569078827e+01f,8.630119141e+03f,6.618889618e+01f,8.696308594e+03f,6.670233154e+01f,
+8.763010742e+03f,6.721395111e+01f,8.830224609e+03f,6.772360992e+01f,8.897948242e+03f,6.824894714e+01f,8.966197266e+03f,6.876645660e+01f,
+9.034963867e+03f,6.929988098e+01f,9.104263672e+03f,6.983142090e+01f,9.174094727e+03f,7.036093140e+01f,9.244456055e+03f,7.090672302e+01f,
+9.315362305e+03f,7.144438934e+01f,9.386806641e+03f,7.199858093e+01f,9.458805664e+03f,7.255082703e+01f,9.531356445e+03f,7.310095978e+01f,
+9.604457031e+03f,7.366800690e+01f,9.678125000e+03f,7.423304749e+01f,9.752358398e+03f,7.479593658e+01f,9.827154297e+03f,7.537612915e+01f,
+9.902530273e+03f,7.594768524e+01f,9.978478516e+03f,7.653681183e+01f,1.005501465e+04f,7.712386322e+01f,1.013213867e+04f,7.770867157e+01f,
+1.020984766e+04f,7.831146240e+01f,1.028815918e+04f,7.890527344e+01f,1.036706445e+04f,7.951734161e+01f,1.044658105e+04f,8.012725830e+01f,
+1.052670898e+04f,8.073483276e+01f,1.060744336e+04f,8.136109924e+01f,1.068880469e+04f,8.198515320e+01f,1.077079004e+04f,8.260681915e+01f,
+1.085339648e+04f,8.324760437e+01f,1.093664453e+04f,8.387884521e+01f,1.102052344e+04f,8.452949524e+01f,1.110505273e+04f,8.517785645e+01f,
+1.119023047e+04f,8.582373047e+01f,1.127605371e+04f,8.648947144e+01f,1.136254395e+04f,8.714528656e+01f,1.144968848e+04f,8.782128143e+01f,
+1.153750977e+04f,8.849488831e+01f,1.162600488e+04f,8.916591644e+01f,1.171517090e+04f,8.985757446e+01f,1.180502832e+04f,9.054679871e+01f,
+1.189557520e+04f,9.123339081e+01f,1.198680859e+04f,9.194109344e+01f,1.207875000e+04f,9.263825226e+01f,1.217138770e+04f,9.335684967e+01f,
+1.226474512e+04f,9.407291412e+01f,1.235881836e+04f,9.478623962e+01f,1.245360449e+04f,9.552149963e+01f,1.254912598e+04f,9.625416565e+01f,
+1.264537988e+04f,9.698403168e+01f,1.274236426e+04f,9.773634338e+01f,1.284010059e+04f,9.847744751e+01f,1.293857715e+04f,9.924134064e+01f,
+1.303781934e+04f,1.000025406e+02f,1.313782129e+04f,1.007608261e+02f,1.323858203e+04f,1.015424271e+02f,1.334012500e+04f,1.023123932e+02f,
+1.344243750e+04f,1.031060333e+02f,1.354554297e+04f,1.038968811e+02f,1.364944043e+04f,1.046846924e+02f,1.375412500e+04f,1.054967346e+02f,
+1.385962109e+04f,1.063059158e+02f,1.396592773e+04f,1.071119995e+02f,1.407303906e+04f,1.079428711e+02f,1.418098242e+04f,1.087613678e+02f,
+1.428974316e+04f,1.096050339e+02f,1.439934863e+04f,1.104457245e+02f,1.450979395e+04f,1.112832031e+02f,1.462107715e+04f,1.121464310e+02f,
+1.473322363e+04f,1.129968033e+02f,1.484622070e+04f,1.138733215e+02f,1.496009375e+04f,1.147467499e+02f,1.507484082e+04f,1.156168365e+02f,
+1.519045801e+04f,1.165136871e+02f,1.530697168e+04f,1.174073639e+02f,1.542437891e+04f,1.182976303e+02f,1.554267676e+04f,1.192152710e+02f,
+1.566189160e+04f,1.201192398e+02f,1.578201074e+04f,1.210510101e+02f,1.590306152e+04f,1.219794922e+02f,1.602504102e+04f,1.229044266e+02f,
+1.614794629e+04f,1.238577957e+02f,1.627180371e+04f,1.248078079e+02f,1.639661133e+04f,1.257541885e+02f,1.652236523e+04f,1.267296677e+02f,
+1.664909570e+04f,1.276906204e+02f,1.677678516e+04f,1.286811218e+02f,1.690546680e+04f,1.296681366e+02f,1.703513477e+04f,1.306513672e+02f,
+1.716578711e+04f,1.316648254e+02f,1.729745117e+04f,1.326632080e+02f,1.743011523e+04f,1.336922760e+02f,1.756380664e+04f,1.347177277e+02f,
+1.769852539e+04f,1.357392426e+02f,1.783426367e+04f,1.367921753e+02f,1.797105664e+04f,1.378414001e+02f,1.810889648e+04f,1.388866119e+02f,
+1.824778320e+04f,1.399639587e+02f,1.838774805e+04f,1.410252533e+02f,1.852877344e+04f,1.421192017e+02f,1.867089258e+04f,1.432092743e+02f,
+1.881410156e+04f,1.442951813e+02f,1.895839648e+04f,1.454144897e+02f,1.910381055e+04f,1.465171204e+02f,1.925032812e+04f,1.476536560e+02f,
+1.939798242e+04f,1.487861938e+02f,1.954676758e+04f,1.499143829e+02f,1.969668359e+04f,1.510772858e+02f,1.984775977e+04f,1.522360687e+02f,
+1.999999609e+04f,1.533904266e+02f
+};
+
+static const float db2GainEntries[66] = {
+9.999999747e-05f,4.330125739e-05f,1.433012512e-04f,6.205124373e-05f,2.053525095e-04f,8.892021287e-05f,2.942727297e-04f,1.274237875e-04f,
+4.216965172e-04f,1.825998916e-04f,6.042963942e-04f,2.616683196e-04f,8.659646846e-04f,3.749736061e-04f,1.240938320e-03f,5.373418680e-04f,
+1.778280246e-03f,7.700176793e-04f,2.548297867e-03f,1.103444956e-03f,3.651742823e-03f,1.581250574e-03f,5.232993513e-03f,2.265951829e-03f,
+7.498945575e-03f,3.247137647e-03f,1.074608322e-02f,4.653188866e-03f,1.539927162e-02f,6.668078247e-03f,2.206735127e-02f,9.555440396e-03f,
+3.162278980e-02f,1.369306538e-02f,4.531585798e-02f,1.962233521e-02f,6.493819505e-02f,2.811905369e-02f,9.305724502e-02f,4.029495642e-02f,
+1.333522052e-01f,5.774319917e-02f,1.910953969e-01f,8.274671435e-02f,2.738421261e-01f,1.185770780e-01f,3.924191892e-01f,1.699224412e-01f,
+5.623416305e-01f,2.435009927e-01f,8.058426380e-01f,3.489399850e-01f,1.154782653e+00f,5.000354052e-01f,1.654818058e+00f,7.165570259e-01f,
+2.371375084e+00f,1.026835203e+00f,3.398210287e+00f,1.471467733e+00f,4.869678020e+00f,2.108632565e+00f,6.978310585e+00f,3.021696091e+00f,
+1.000000668e+01f,4.330128670e+00f
+};
+
+static const float tanh5Entries[514] = {
+-9.999092221e-01f,7.377500424e-06f,-9.999018312e-01f,7.976918823e-06f,-9.998938441e-01f,8.625033843e-06f,-9.998852015e-01f,9.325801329e-06f,
+-9.998759031e-01f,1.008349773e-05f,-9.998658299e-01f,1.090274691e-05f,-9.998549223e-01f,1.178854563e-05f,-9.998431206e-01f,1.274630085e-05f,
+-9.998303652e-01f,1.378185425e-05f,-9.998165965e-01f,1.490152408e-05f,-9.998016953e-01f,1.611213884e-05f,-9.997856021e-01f,1.742108543e-05f,
+-9.997681379e-01f,1.883634286e-05f,-9.997493029e-01f,2.036654223e-05f,-9.997289777e-01f,2.202101678e-05f,-9.997069240e-01f,2.380985097e-05f,
+-9.996831417e-01f,2.574394784e-05f,-9.996573925e-01f,2.783509990e-05f,-9.996295571e-01f,3.009604734e-05f,-9.995994568e-01f,3.254056719e-05f,
+-9.995669127e-01f,3.518355152e-05f,-9.995317459e-01f,3.804109656e-05f,-9.994936585e-01f,4.113060277e-05f,-9.994525313e-01f,4.447088213e-05f,
+-9.994080663e-01f,4.808226004e-05f,-9.993600249e-01f,5.198671715e-05f,-9.993079901e-01f,5.620800221e-05f,-9.992517829e-01f,6.077178477e-05f,
+-9.991910458e-01f,6.570581172e-05f,-9.991253018e-01f,7.104006363e-05f,-9.990543127e-01f,7.680694398e-05f,-9.989774823e-01f,8.304146468e-05f,
+-9.988944530e-01f,8.978146798e-05f,-9.988046885e-01f,9.706783749e-05f,-9.987075925e-01f,1.049447528e-04f,-9.986026287e-01f,1.134599297e-04f,
+-9.984892011e-01f,1.226649474e-04f,-9.983665347e-01f,1.326154888e-04f,-9.982339144e-01f,1.433717262e-04f,-9.980905652e-01f,1.549986482e-04f,
+-9.979355335e-01f,1.675664389e-04f,-9.977679849e-01f,1.811508992e-04f,-9.975868464e-01f,1.958338689e-04f,-9.973909855e-01f,2.117036929e-04f,
+-9.971792698e-01f,2.288557880e-04f,-9.969504476e-01f,2.473930945e-04f,-9.967030287e-01f,2.674267744e-04f,-9.964355826e-01f,2.890766773e-04f,
+-9.961465597e-01f,3.124722280e-04f,-9.958340526e-01f,3.377529792e-04f,-9.954963326e-01f,3.650694562e-04f,-9.951312542e-01f,3.945839417e-04f,
+-9.947366714e-01f,4.264713789e-04f,-9.943102002e-01f,4.609203606e-04f,-9.938492775e-01f,4.981340608e-04f,-9.933511019e-01f,5.383313983e-04f,
+-9.928128123e-01f,5.817479105e-04f,-9.922310710e-01f,6.286374410e-04f,-9.916024208e-01f,6.792729255e-04f,-9.909231663e-01f,7.339479635e-04f,
+-9.901891947e-01f,7.929783314e-04f,-9.893962145e-01f,8.567032637e-04f,-9.885395169e-01f,9.254873148e-04f,-9.876140356e-01f,9.997215820e-04f,
+-9.866142869e-01f,1.079825801e-03f,-9.855344892e-01f,1.166249975e-03f,-9.843682051e-01f,1.259476296e-03f,-9.831087589e-01f,1.360020950e-03f,
+-9.817487001e-01f,1.468435861e-03f,-9.802802801e-01f,1.585311024e-03f,-9.786949754e-01f,1.711276476e-03f,-9.769837260e-01f,1.847003587e-03f,
+-9.751366973e-01f,1.993207727e-03f,-9.731435180e-01f,2.150649903e-03f,-9.709928632e-01f,2.320138039e-03f,-9.686726928e-01f,2.502529183e-03f,
+-9.661701918e-01f,2.698730212e-03f,-9.634714723e-01f,2.909699455e-03f,-9.605617523e-01f,3.136447398e-03f,-9.574252963e-01f,3.380036214e-03f,
+-9.540452361e-01f,3.641580464e-03f,-9.504036903e-01f,3.922245931e-03f,-9.464814067e-01f,4.223247524e-03f,-9.422581792e-01f,4.545846954e-03f,
+-9.377123117e-01f,4.891350400e-03f,-9.328209758e-01f,5.261100363e-03f,-9.275599122e-01f,5.656473804e-03f,-9.219034314e-01f,6.078870501e-03f,
+-9.158245325e-01f,6.529705133e-03f,-9.092948437e-01f,7.010396104e-03f,-9.022844434e-01f,7.522349246e-03f,-8.947620988e-01f,8.066943847e-03f,
+-8.866951466e-01f,8.645511232e-03f,-8.780496120e-01f,9.259313345e-03f,-8.687903285e-01f,9.909517132e-03f,-8.588808179e-01f,1.059716754e-02f,
+-8.482836485e-01f,1.132315211e-02f,-8.369604945e-01f,1.208816748e-02f,-8.248723149e-01f,1.289268024e-02f,-8.119796515e-01f,1.373688597e-02f,
+-7.982427478e-01f,1.462066360e-02f,-7.836220860e-01f,1.554352697e-02f,-7.680785656e-01f,1.650458016e-02f,-7.515739799e-01f,1.750246435e-02f,
+-7.340714931e-01f,1.853531040e-02f,-7.155362368e-01f,1.960069314e-02f,-6.959354877e-01f,2.069558948e-02f,-6.752399206e-01f,2.181633934e-02f,
+-6.534236073e-01f,2.295861021e-02f,-6.304649711e-01f,2.411738597e-02f,-6.063476205e-01f,2.528695576e-02f,-5.810606480e-01f,2.646091580e-02f,
+-5.545997024e-01f,2.763219550e-02f,-5.269675255e-01f,2.879310027e-02f,-4.981744289e-01f,2.993537299e-02f,-4.682390392e-01f,3.105026856e-02f,
+-4.371887743e-01f,3.212866932e-02f,-4.050601125e-01f,3.316120431e-02f,-3.718989193e-01f,3.413838893e-02f,-3.377605081e-01f,3.505079076e-02f,
+-3.027097285e-01f,3.588920087e-02f,-2.668205202e-01f,3.664481640e-02f,-2.301757038e-01f,3.730941936e-02f,-1.928662956e-01f,3.787556291e-02f,
+-1.549907327e-01f,3.833674267e-02f,-1.166539863e-01f,3.868754581e-02f,-7.796644419e-02f,3.892379627e-02f,-3.904264420e-02f,3.904264420e-02f,
+0.000000000e+00f,3.904264420e-02f,3.904264420e-02f,3.892379627e-02f,7.796644419e-02f,3.868754581e-02f,1.166539863e-01f,3.833674267e-02f,
+1.549907327e-01f,3.787556291e-02f,1.928662956e-01f,3.730941936e-02f,2.301757038e-01f,3.664481640e-02f,2.668205202e-01f,3.588920087e-02f,
+3.027097285e-01f,3.505079076e-02f,3.377605081e-01f,3.413838893e-02f,3.718989193e-01f,3.316120431e-02f,4.050601125e-01f,3.212866932e-02f,
+4.371887743e-01f,3.105026856e-02f,4.682390392e-01f,2.993537299e-02f,4.981744289e-01f,2.879310027e-02f,5.269675255e-01f,2.763219550e-02f,
+5.545997024e-01f,2.646091580e-02f,5.810606480e-01f,2.528695576e-02f,6.063476205e-01f,2.411738597e-02f,6.304649711e-01f,2.295861021e-02f,
+6.534236073e-01f,2.181633934e-02f,6.752399206e-01f,2.069558948e-02f,6.959354877e-01f,1.960069314e-02f,7.155362368e-01f,1.853531040e-02f,
+7.340714931e-01f,1.750246435e-02f,7.515739799e-01f,1.650458016e-02f,7.680785656e-01f,1.554352697e-02f,7.836220860e-01f,1.462066360e-02f,
+7.982427478e-01f,1.373688597e-02f,8.119796515e-01f,1.289268024e-02f,8.248723149e-01f,1.208816748e-02f,8.369604945e-01f,1.132315211e-02f,
+8.482836485e-01f,1.059716754e-02f,8.588808179e-01f,9.909517132e-03f,8.687903285e-01f,9.259313345e-03f,8.780496120e-01f,8.645511232e-03f,
+8.866951466e-01f,8.066943847e-03f,8.947620988e-01f,7.522349246e-03f,9.022844434e-01f,7.010396104e-03f,9.092948437e-01f,6.529705133e-03f,
+9.158245325e-01f,6.078870501e-03f,9.219034314e-01f,5.656473804e-03f,9.275599122e-01f,5.261100363e-03f,9.328209758e-01f,4.891350400e-03f,
+9.377123117e-01f,4.545846954e-03f,9.422581792e-01f,4.223247524e-03f,9.464814067e-01f,3.922245931e-03f,9.504036903e-01f,3.641580464e-03f,
+9.540452361e-01f,3.380036214e-03f,9.574252963e-01f,3.136447398e-03f,9.605617523e-01f,2.909699455e-03f,9.634714723e-01f,2.698730212e-03f,
+9.661701918e-01f,2.502529183e-03f,9.686726928e-01f,2.320138039e-03f,9.709928632e-01f,2.150649903e-03f,9.731435180e-01f,1.993207727e-03f,
+9.751366973e-01f,1.847003587e-03f,9.769837260e-01f,1.711276476e-03f,9.786949754e-01f,1.585311024e-03f,9.802802801e-01f,1.468435861e-03f,
+9.817487001e-01f,1.360020950e-03f,9.831087589e-01f,1.259476296e-03f,9.843682051e-01f,1.166249975e-03f,9.855344892e-01f,1.079825801e-03f,
+9.866142869e-01f,9.997215820e-04f,9.876140356e-01f,9.254873148e-04f,9.885395169e-01f,8.567032637e-04f,9.893962145e-01f,7.929783314e-04f,
+9.901891947e-01f,7.339479635e-04f,9.909231663e-01f,6.792729255e-04f,9.916024208e-01f,6.286374410e-04f,9.922310710e-01f,5.817479105e-04f,
+9.928128123e-01f,5.383313983e-04f,9.933511019e-01f,4.981340608e-04f,9.938492775e-01f,4.609203606e-04f,9.943102002e-01f,4.264713789e-04f,
+9.947366714e-01f,3.945839417e-04f,9.951312542e-01f,3.650694562e-04f,9.954963326e-01f,3.377529792e-04f,9.958340526e-01f,3.124722280e-04f,
+9.961465597e-01f,2.890766773e-04f,9.964355826e-01f,2.674267744e-04f,9.967030287e-01f,2.473930945e-04f,9.969504476e-01f,2.288557880e-04f,
+9.971792698e-01f,2.117036929e-04f,9.973909855e-01f,1.958338689e-04f,9.975868464e-01f,1.811508992e-04f,9.977679849e-01f,1.675664389e-04f,
+9.979355335e-01f,1.549986482e-04f,9.980905652e-01f,1.433717262e-04f,9.982339144e-01f,1.326154888e-04f,9.983665347e-01f,1.226649474e-04f,
+9.984892011e-01f,1.134599297e-04f,9.986026287e-01f,1.049447528e-04f,9.987075925e-01f,9.706783749e-05f,9.988046885e-01f,8.978146798e-05f,
+9.988944530e-01f,8.304146468e-05f,9.989774823e-01f,7.680694398e-05f,9.990543127e-01f,7.104006363e-05f,9.991253018e-01f,6.570581172e-05f,
+9.991910458e-01f,6.077178477e-05f,9.992517829e-01f,5.620800221e-05f,9.993079901e-01f,5.198671715e-05f,9.993600249e-01f,4.808226004e-05f,
+9.994080663e-01f,4.447088213e-05f,9.994525313e-01f,4.113060277e-05f,9.994936585e-01f,3.804109656e-05f,9.995317459e-01f,3.518355152e-05f,
+9.995669127e-01f,3.254056719e-05f,9.995994568e-01f,3.009604734e-05f,9.996295571e-01f,2.783509990e-05f,9.996573925e-01f,2.574394784e-05f,
+9.996831417e-01f,2.380985097e-05f,9.997069240e-01f,2.202101678e-05f,9.997289777e-01f,2.036654223e-05f,9.997493029e-01f,1.883634286e-05f,
+9.997681379e-01f,1.742108543e-05f,9.997856021e-01f,1.611213884e-05f,9.998016953e-01f,1.490152408e-05f,9.998165965e-01f,1.378185425e-05f,
+9.998303652e-01f,1.274630085e-05f,9.998431206e-01f,1.178854563e-05f,9.998549223e-01f,1.090274691e-05f,9.998658299e-01f,1.008349773e-05f,
+9.998759031e-01f,9.325801329e-06f,9.998852015e-01f,8.625033843e-06f,9.998938441e-01f,7.976918823e-06f,9.999018312e-01f,7.377500424e-06f,
+9.999092221e-01f,6.823121112e-06f
+};
+
+const FixedTableData fixedTableData[13] = {
+    {audioTaperEntries, 32, 3.200000000e+01f, -0.000000000e+00f, 0.000000000e+00f, 1.000000000e+00f},
+    {audioTaper18Entries, 32, 3.200000000e+01f, -0.000000000e+00f, 0.000000000e+00f, 1.000000000e+00f},
+    {bipolarAudioTaperEntries, 32, 1.600000000e+01f, 1.600000000e+01f, -1.000000000e+00f, 1.000000000e+00f},
+    {bipolarAudioTaper30Entries, 32, 1.600000000e+01f, 1.600000000e+01f, -1.000000000e+00f, 1.000000000e+00f},
+    {bipolarAudioTaper42Entries, 32, 1.600000000e+01f, 1.600000000e+01f, -1.000000000e+00f, 1.000000000e+00f},
+    {sinEntries, 2048, 2.048000000e+03f, -0.000000000e+00f, 0.000000000e+00f, 1.000000000e+00f},
+    {mixerPanLEntries, 16, 8.000000000e+00f, 8.000000000e+00f, -1.000000000e+00f, 1.000000000e+00f},
+    {mixerPanREntries, 16, 8.000000000e+00f, 8.000000000e+00f, -1.000000000e+00f, 1.000000000e+00f},
+    {exp2Entries, 256, 1.926592064e+01f, -3.853184128e+01f, 2.000000000e+00f, 1.528771210e+01f},
+    {exp2ExLowEntries, 256, 3.349095154e+01f, -3.349095154e+01f, 1.000000000e+00f, 8.643856049e+00f},
+    {exp2ExHighEntries, 512, 9.071811676e+01f, -7.841543579e+02f, 8.643856049e+00f, 1.428771210e+01f},
+    {db2GainEntries, 32, 3.199999928e-01f, 2.559999847e+01f, -8.000000000e+01f, 2.000000000e+01f},
+    {tanh5Entries, 256, 2.560000038e+01f, 1.280000000e+02f, -5.000000000e+00f, 5.000000000e+00f},
+};
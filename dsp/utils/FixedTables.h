@@ -0,0 +1,62 @@
+#pragma once
+
+#include "LookupTable.h"
+
+#include <memory>
+
+/**
+ * The float lookup tables in ObjectCache that have a fixed shape are
+ * generated ahead of time, and live in FixedTables.cpp as const data.
+ * So making one is just pointing a LookupTableParams at that data:
+ * nothing is computed when the plugin loads, and nothing is on the heap.
+ *
+ * After changing one of these tables in LookupTableFactory or ObjectCache,
+ * run the unit tests with --fixedTables and paste the output into the
+ * bottom of FixedTables.cpp. testFixedTables will fail until you do.
+ */
+class FixedTables
+{
+public:
+    FixedTables() = delete;
+
+    enum class Table
+    {
+        AudioTaper,
+        AudioTaper18,
+        BipolarAudioTaper,
+        BipolarAudioTaper30,
+        BipolarAudioTaper42,
+        Sin,
+        MixerPanL,
+        MixerPanR,
+        Exp2,
+        Exp2ExLow,
+        Exp2ExHigh,
+        Db2Gain,
+        Tanh5,
+        NUM_TABLES
+    };
+
+    /**
+     * Points params at the generated table.
+     * returns false if the fixed tables have been turned off.
+     */
+    static bool init(LookupTableParams<float>& params, Table table);
+
+    /**
+     * Builds the table at run time, the slow way, from ObjectCache.
+     */
+    static std::shared_ptr<LookupTableParams<float>> makeAtRunTime(Table table);
+
+    /**
+     * Prints all the tables as C++, built at run time.
+     */
+    static void gen();
+
+    static const char* getName(Table table);
+
+    /**
+     * For the generator and unit tests.
+     */
+    static void _setEnabled(bool enabled);
+};
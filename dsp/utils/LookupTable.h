@@ -2,6 +2,7 @@
 
 #include "AudioMath.h"
 #include "SqLog.h"
+#include "simd.h"
 
 #include <algorithm>
 #include <assert.h>
@@ -35,6 +36,18 @@ public:
      */
     static T lookup(const LookupTableParams<T>& params, T input, bool allowOutsideDomain = false);
 
+    /**
+     * Four lookups into the same table at once.
+     * Same as the scalar one with allowOutsideDomain: input is always limited to the domain.
+     */
+    static float_4 lookup(const LookupTableParams<float>& params, float_4 input);
+
+    /**
+     * Four lookups, where each lane uses its own table.
+     * The tables may have different sizes and domains.
+     */
+    static float_4 lookup(const LookupTableParams<float>* const params[4], float_4 input);
+
     /**
      * init will create the entries in the lookup table
      * bins is the number of entries desired in the lookup table.
@@ -117,6 +130,53 @@ inline T LookupTable<T>::lookup(const LookupTableParams<T>& params, T input, boo
     return x;
 }
 
+/**
+ * SSE has no gather, so the only per-lane work is loading the entries.
+ * The index and interpolation are the same math as the scalar lookup.
+ * The vectors are built from scalars, rather than written a lane at a time,
+ * so they never have to go through memory.
+ */
+template<typename T>
+inline float_4 LookupTable<T>::lookup(const LookupTableParams<float>& params, float_4 input)
+{
+    assert(params.isValid());
+    input = rack::simd::clamp(input, params.xMin, params.xMax);
+    const float_4 scaledInput = input * params.a + params.b;
+    const int32_4 index = scaledInput;      // truncates, like cvtt
+    const float_4 frac = rack::simd::clamp(scaledInput - float_4(index), 0.f, 1.f);
+
+    const float* e0 = params.entries + (2 * index[0]);
+    const float* e1 = params.entries + (2 * index[1]);
+    const float* e2 = params.entries + (2 * index[2]);
+    const float* e3 = params.entries + (2 * index[3]);
+    const float_4 y(e0[0], e1[0], e2[0], e3[0]);
+    const float_4 slope(e0[1], e1[1], e2[1], e3[1]);
+    return y + frac * slope;
+}
+
+template<typename T>
+inline float_4 LookupTable<T>::lookup(const LookupTableParams<float>* const params[4], float_4 input)
+{
+    const LookupTableParams<float>& p0 = *params[0];
+    const LookupTableParams<float>& p1 = *params[1];
+    const LookupTableParams<float>& p2 = *params[2];
+    const LookupTableParams<float>& p3 = *params[3];
+    assert(p0.isValid() && p1.isValid() && p2.isValid() && p3.isValid());
+
+    input = rack::simd::clamp(input, float_4(p0.xMin, p1.xMin, p2.xMin, p3.xMin), float_4(p0.xMax, p1.xMax, p2.xMax, p3.xMax));
+    const float_4 scaledInput = input * float_4(p0.a, p1.a, p2.a, p3.a) + float_4(p0.b, p1.b, p2.b, p3.b);
+    const int32_4 index = scaledInput;
+    const float_4 frac = rack::simd::clamp(scaledInput - float_4(index), 0.f, 1.f);
+
+    const float* e0 = p0.entries + (2 * index[0]);
+    const float* e1 = p1.entries + (2 * index[1]);
+    const float* e2 = p2.entries + (2 * index[2]);
+    const float* e3 = p3.entries + (2 * index[3]);
+    const float_4 y(e0[0], e1[0], e2[0], e3[0]);
+    const float_4 slope(e0[1], e1[1], e2[1], e3[1]);
+    return y + frac * slope;
+}
+
 template<typename T>
 inline void LookupTable<T>::init(LookupTableParams<T>& params,
     int bins, T x0In, T x1In, std::function<double(double)> f)
@@ -211,6 +271,7 @@ public:
     T * entries = 0;		// each entry is value, slope
     T xMin = 0;				// minimum x value we will accept as input
     T xMax = 0;				// max x value we will accept as input
+    bool ownsEntries = true;	// false when entries point at a FixedTables table
 
     LookupTableParams()
     {
@@ -221,7 +282,9 @@ public:
 
     ~LookupTableParams()
     {
-        free(entries);
+        if (ownsEntries) {
+            free(entries);
+        }
         --_numLookupParams;
     }
 
@@ -235,14 +298,31 @@ public:
 
     void alloc(int bins)
     {
-        if (entries) free(entries);
+        if (entries && ownsEntries) free(entries);
         // allocate one extra, so we can index all the way to the end...
         entries = (T *) malloc((bins + 1) * 2 * sizeof(T));
+        ownsEntries = true;
         numBins_i = bins;
         a = 0;
         b = 0;
     }
 
+    /**
+     * Uses entries that were made ahead of time, instead of allocating them.
+     * fixedEntries must have (bins + 1) pairs, and must outlive us. They are never written.
+     */
+    void initFixed(const T* fixedEntries, int bins, T a_, T b_, T xMin_, T xMax_)
+    {
+        if (entries && ownsEntries) free(entries);
+        entries = const_cast<T*>(fixedEntries);
+        ownsEntries = false;
+        numBins_i = bins;
+        a = a_;
+        b = b_;
+        xMin = xMin_;
+        xMax = xMax_;
+    }
+
     void _dump() const {
         //SQINFO("_dump lookup");
         for(int i = 0; i < numBins_i; ++i) {
@@ -1,9 +1,13 @@
 #pragma once
 
 #include "SqLog.h"
+#include "simd.h"
 #include <assert.h>
+#include <algorithm>
+#include <limits>
 #include <map>
 #include <memory>
+#include <vector>
 
 template <typename T> class NonUniformLookupTable;
 
@@ -51,6 +55,22 @@ private:
     using container = std::map<T, Entry>;
     bool isFinalized = false;
     container entries;
+
+    /**
+     * finalize freezes the map into these, so lookup doesn't have to walk a tree.
+     * flat is sorted by x, and has extra entries at the end with x = max, so
+     * lookup can always look ahead.
+     *
+     * x values in a bucket (all the same width) are always in segment
+     * buckets[n] .. buckets[n] + maxSteps, so lookup only has to look
+     * at a few breakpoints.
+     */
+    std::vector<Entry> flat;
+    std::vector<int> buckets;
+    T xMin = 0;
+    T xMax = 0;
+    T invBucketWidth = 0;
+    int maxSteps = 0;
 };
 
 
@@ -62,6 +82,20 @@ public:
     static void addPoint(NonUniformLookupTableParams<T>& params, T x, T y);
     static void finalize(NonUniformLookupTableParams<T>& params);
     static T lookup(const NonUniformLookupTableParams<T>& params, T x);
+
+    /**
+     * Four lookups at once, only for float tables.
+     */
+    static float_4 lookup(const NonUniformLookupTableParams<float>& params, float_4 x);
+
+private:
+    /**
+     * @param x must already be clamped to the range of the table.
+     * @returns the index of the last entry with entry.x <= x.
+     */
+    static int findSegment(const NonUniformLookupTableParams<T>& params, T x);
+    static int getBucket(const NonUniformLookupTableParams<T>& params, T x);
+    static int buildBuckets(NonUniformLookupTableParams<T>& params, int numBuckets);
 };
 
 template <typename T>
@@ -95,9 +129,89 @@ inline void NonUniformLookupTable<T>::finalize(NonUniformLookupTableParams<T>& p
         }
     }
 
+    params.flat.clear();
+    for (it = params.entries.begin(); it != params.entries.end(); ++it) {
+        params.flat.push_back(it->second);
+    }
+    assert(!params.flat.empty());
+    params.xMin = params.flat.front().x;
+    params.xMax = params.flat.back().x;
+
+    typename NonUniformLookupTableParams<T>::Entry sentinel;
+    sentinel.x = std::numeric_limits<T>::max();
+    sentinel.y = params.flat.back().y;
+    sentinel.a = 0;
+    params.flat.push_back(sentinel);
+
+    // More buckets until no bucket has more than a couple of breakpoints in it.
+    // Very uneven tables will give up and take more steps.
+    const int numSegments = int(params.entries.size());
+    int numBuckets = numSegments;
+    while (buildBuckets(params, numBuckets) > 2 && numBuckets < 1024) {
+        numBuckets *= 2;
+    }
+
+    // enough sentinels that findSegment can always look maxSteps ahead
+    params.flat.resize(numSegments + params.maxSteps + 1, sentinel);
+
     params.isFinalized = true;
 }
 
+/**
+ * returns maxSteps
+ */
+template <typename T>
+inline int NonUniformLookupTable<T>::buildBuckets(NonUniformLookupTableParams<T>& params, int numBuckets)
+{
+    const T range = params.xMax - params.xMin;
+    if (range <= 0) {
+        numBuckets = 1;
+    }
+    params.invBucketWidth = (range > 0) ? T(numBuckets) / range : T(0);
+    params.buckets.assign(numBuckets, 0);
+
+    // Put each breakpoint in a bucket, with the same math lookup will use.
+    // Anything in bucket n is >= every breakpoint in a bucket below n, and < every
+    // breakpoint in a bucket above n.
+    const int numSegments = int(params.entries.size());
+    std::vector<int> lastInBucket(numBuckets, -1);
+    for (int i = 0; i < numSegments; ++i) {
+        const int bucket = getBucket(params, params.flat[i].x);
+        lastInBucket[bucket] = i;
+        for (int b = bucket + 1; b < numBuckets; ++b) {
+            params.buckets[b] = i;
+        }
+    }
+
+    params.maxSteps = 0;
+    for (int b = 0; b < numBuckets; ++b) {
+        params.maxSteps = std::max(params.maxSteps, lastInBucket[b] - params.buckets[b]);
+    }
+    return params.maxSteps;
+}
+
+template <typename T>
+inline int NonUniformLookupTable<T>::getBucket(const NonUniformLookupTableParams<T>& params, T x)
+{
+    const int lastBucket = int(params.buckets.size()) - 1;
+    return std::min(lastBucket, int((x - params.xMin) * params.invBucketWidth));
+}
+
+template <typename T>
+inline int NonUniformLookupTable<T>::findSegment(const NonUniformLookupTableParams<T>& params, T x)
+{
+    const int first = params.buckets[getBucket(params, x)];
+
+    // Count the breakpoints in the bucket that are <= x. These are compares and adds,
+    // not branches, and don't depend on each other. The sentinels on the end of flat
+    // keep this from running off the table.
+    int ret = first;
+    for (int i = first + 1; i <= first + params.maxSteps; ++i) {
+        ret += (params.flat[i].x <= x) ? 1 : 0;
+    }
+    return ret;
+}
+
 
 template <typename T>
 inline T NonUniformLookupTable<T>::lookup(const NonUniformLookupTableParams<T>& params, T x)
@@ -105,29 +219,30 @@ inline T NonUniformLookupTable<T>::lookup(const NonUniformLookupTableParams<T>&
     assert(params.isFinalized);
     assert(!params.entries.empty());
 
-    auto lb_init = params.entries.lower_bound(x);
-    auto lb = lb_init;
-
-    if (lb == params.entries.end()) {
-        return params.entries.rbegin()->second.y;
-    }
-    if (x >= lb->second.x) {
-        // this could only happen if we hit equal
-    } else {
-        // added this case to keep mac from crashing, as we were trying to decrement begin()
-        if (lb == params.entries.begin()) {
-            return lb_init->second.y;
-        }
-        --lb;
-        if (lb == params.entries.end()) {
-            // I thing now that above is fixed this won't happen?
-            assert(false);
-            return lb_init->second.y;
-        }
-    }
+    // clamping is the same as returning the first or last y
+    x = std::max(params.xMin, std::min(x, params.xMax));
+    const auto& entry = params.flat[findSegment(params, x)];
 
     // Now that we have the right entry, interpolate.
-    T ret = lb->second.a * (x - lb->second.x) + lb->second.y;
+    T ret = entry.a * (x - entry.x) + entry.y;
     return ret;
 }
 
+template <typename T>
+inline float_4 NonUniformLookupTable<T>::lookup(const NonUniformLookupTableParams<float>& params, float_4 x)
+{
+    assert(params.isFinalized);
+    assert(!params.entries.empty());
+
+    x = rack::simd::clamp(x, params.xMin, params.xMax);
+
+    // there is no gather in SSE, so load the segments one lane at a time
+    float_4 x0, y0, a;
+    for (int i = 0; i < 4; ++i) {
+        const auto& entry = params.flat[findSegment(params, x[i])];
+        x0[i] = entry.x;
+        y0[i] = entry.y;
+        a[i] = entry.a;
+    }
+    return a * (x - x0) + y0;
+}
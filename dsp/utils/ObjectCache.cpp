@@ -7,147 +7,149 @@
 
 #include "AudioMath.h"
 #include "ButterworthFilterDesigner.h"
+#include "FixedTables.h"
 #include "LookupTableFactory.h"
 #include "ObjectCache.h"
 
+/**
+ * The float tables come pre-built from FixedTables.
+ * Other types are always computed.
+ */
+template <typename T>
+static bool initFixed(LookupTableParams<T>&, FixedTables::Table)
+{
+    return false;
+}
 
+template <>
+bool initFixed(LookupTableParams<float>& params, FixedTables::Table table)
+{
+    return FixedTables::init(params, table);
+}
 
 template <typename T>
 std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getBipolarAudioTaper()
 {
-    std::shared_ptr< LookupTableParams<T>> ret = bipolarAudioTaper.lock();
-    if (!ret) {
-        ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeBipolarAudioTaper(*ret);
-        bipolarAudioTaper = ret;
-    }
-    return ret;
+    return bipolarAudioTaper.get([](LookupTableParams<T>& params) {
+        if (initFixed(params, FixedTables::Table::BipolarAudioTaper)) {
+            return;
+        }
+        LookupTableFactory<T>::makeBipolarAudioTaper(params);
+    });
 }
 
 template <typename T>
 std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getBipolarAudioTaper30()
 {
-    std::shared_ptr< LookupTableParams<T>> ret = bipolarAudioTaper30.lock();
-    if (!ret) {
-        ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeBipolarAudioTaper(*ret, -30);
-        bipolarAudioTaper30 = ret;
-    }
-    return ret;
+    return bipolarAudioTaper30.get([](LookupTableParams<T>& params) {
+        if (initFixed(params, FixedTables::Table::BipolarAudioTaper30)) {
+            return;
+        }
+        LookupTableFactory<T>::makeBipolarAudioTaper(params, -30);
+    });
 }
 
 template <typename T>
 std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getBipolarAudioTaper42()
 {
-    std::shared_ptr< LookupTableParams<T>> ret = bipolarAudioTaper42.lock();
-    if (!ret) {
-        ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeBipolarAudioTaper(*ret, -42);
-        bipolarAudioTaper42 = ret;
-    }
-    return ret;
+    return bipolarAudioTaper42.get([](LookupTableParams<T>& params) {
+        if (initFixed(params, FixedTables::Table::BipolarAudioTaper42)) {
+            return;
+        }
+        LookupTableFactory<T>::makeBipolarAudioTaper(params, -42);
+    });
 }
 
 template <typename T>
 std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getAudioTaper()
 {
-
-    std::shared_ptr< LookupTableParams<T>> ret = audioTaper.lock();
-    if (!ret) {
-        ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeAudioTaper(*ret);
-        audioTaper = ret;
-    }
-    return ret;
+    return audioTaper.get([](LookupTableParams<T>& params) {
+        if (initFixed(params, FixedTables::Table::AudioTaper)) {
+            return;
+        }
+        LookupTableFactory<T>::makeAudioTaper(params);
+    });
 }
 
 template <typename T>
 std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getAudioTaper18()
 {
-
-    std::shared_ptr< LookupTableParams<T>> ret = audioTaper18.lock();
-    if (!ret) {
-        ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeAudioTaper(*ret, -18);
-        audioTaper18 = ret;
-    }
-    return ret;
+    return audioTaper18.get([](LookupTableParams<T>& params) {
+        if (initFixed(params, FixedTables::Table::AudioTaper18)) {
+            return;
+        }
+        LookupTableFactory<T>::makeAudioTaper(params, -18);
+    });
 }
 
 template <typename T>
 std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getSinLookup()
 {
-    std::shared_ptr< LookupTableParams<T>> ret = sinLookupTable.lock();
-    if (!ret) {
-        ret = std::make_shared<LookupTableParams<T>>();
+    return sinLookupTable.get([](LookupTableParams<T>& params) {
+        if (initFixed(params, FixedTables::Table::Sin)) {
+            return;
+        }
         std::function<double(double)> f = AudioMath::makeFunc_Sin();
         // Used to use 4096, but 512 gives about 92db  snr, so let's save memory
         // working on high purity BasicVCO. move up to 2k to get rid of slight
         // High-frequency junk (very, very low);
-        LookupTable<T>::init(*ret, 2 * 1024, 0, 1, f);
-        sinLookupTable = ret;
-    }
-    return ret;
+        LookupTable<T>::init(params, 2 * 1024, 0, 1, f);
+    });
 }
 
 template <typename T>
 std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getMixerPanL()
 {
-    std::shared_ptr< LookupTableParams<T>> ret = mixerPanL.lock();
-    if (!ret) {
-        ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeMixerPanL(*ret);
-        mixerPanL = ret;
-    }
-    return ret;
+    return mixerPanL.get([](LookupTableParams<T>& params) {
+        if (initFixed(params, FixedTables::Table::MixerPanL)) {
+            return;
+        }
+        LookupTableFactory<T>::makeMixerPanL(params);
+    });
 }
 
 template <typename T>
 std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getMixerPanR()
 {
-    std::shared_ptr< LookupTableParams<T>> ret = mixerPanR.lock();
-    if (!ret) {
-        ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeMixerPanR(*ret);
-        mixerPanR = ret;
-    }
-    return ret;
+    return mixerPanR.get([](LookupTableParams<T>& params) {
+        if (initFixed(params, FixedTables::Table::MixerPanR)) {
+            return;
+        }
+        LookupTableFactory<T>::makeMixerPanR(params);
+    });
 }
 
 template <typename T>
 std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getExp2()
 {
-    std::shared_ptr< LookupTableParams<T>> ret = exp2.lock();
-    if (!ret) {
-        ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeExp2(*ret);
-        exp2 = ret;
-    }
-    return ret;
+    return exp2.get([](LookupTableParams<T>& params) {
+        if (initFixed(params, FixedTables::Table::Exp2)) {
+            return;
+        }
+        LookupTableFactory<T>::makeExp2(params);
+    });
 }
 
 template <typename T>
 std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getExp2ExtendedLow()
 {
-    std::shared_ptr< LookupTableParams<T>> ret = exp2ExLow.lock();
-    if (!ret) {
-        ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeExp2ExLow(*ret);
-        exp2ExLow = ret;
-    }
-    return ret;
+    return exp2ExLow.get([](LookupTableParams<T>& params) {
+        if (initFixed(params, FixedTables::Table::Exp2ExLow)) {
+            return;
+        }
+        LookupTableFactory<T>::makeExp2ExLow(params);
+    });
 }
 
 template <typename T>
 std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getExp2ExtendedHigh()
 {
-    std::shared_ptr< LookupTableParams<T>> ret = exp2ExHigh.lock();
-    if (!ret) {
-        ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeExp2ExHigh(*ret);
-        exp2ExHigh = ret;
-    }
-    return ret;
+    return exp2ExHigh.get([](LookupTableParams<T>& params) {
+        if (initFixed(params, FixedTables::Table::Exp2ExHigh)) {
+            return;
+        }
+        LookupTableFactory<T>::makeExp2ExHigh(params);
+    });
 }
 
 
@@ -155,30 +157,28 @@ std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getExp2ExtendedHigh()
 template <typename T>
 std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getDb2Gain()
 {
-    std::shared_ptr< LookupTableParams<T>> ret = db2Gain.lock();
-    if (!ret) {
-        ret = std::make_shared<LookupTableParams<T>>();
-        LookupTable<T>::init(*ret, 32, -80, 20, [](double x) {
+    return db2Gain.get([](LookupTableParams<T>& params) {
+        if (initFixed(params, FixedTables::Table::Db2Gain)) {
+            return;
+        }
+        LookupTable<T>::init(params, 32, -80, 20, [](double x) {
             return AudioMath::gainFromDb(x);
             });
-        db2Gain = ret;
-    }
-    return ret;
+    });
 }
 
 
 template <typename T>
 std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getTanh5()
 {
-    std::shared_ptr< LookupTableParams<T>> ret = tanh5.lock();
-    if (!ret) {
-        ret = std::make_shared<LookupTableParams<T>>();
-        LookupTable<T>::init(*ret, 256, -5, 5, [](double x) {
+    return tanh5.get([](LookupTableParams<T>& params) {
+        if (initFixed(params, FixedTables::Table::Tanh5)) {
+            return;
+        }
+        LookupTable<T>::init(params, 256, -5, 5, [](double x) {
             return std::tanh(x);
             });
-        tanh5 = ret;
-    }
-    return ret;
+    });
 }
 
 /**
@@ -200,83 +200,129 @@ std::function<T(T)> ObjectCache<T>::getExp2Ex()
 template <typename T>
 std::shared_ptr<BiquadParams<T, 3>> ObjectCache<T>::get6PLPParams(float normalizedFc)
 {
+    auto design = [normalizedFc](BiquadParams<T, 3>& params) {
+        ButterworthFilterDesigner<T>::designSixPoleLowpass(params, normalizedFc);
+    };
     const int div = (int) std::round(1.0 / normalizedFc);
     if (div == 64) {
-        std::shared_ptr < BiquadParams<T, 3>> ret = lowpass64.lock();
-        if (!ret) {
-            ret = std::make_shared<BiquadParams<T, 3>>();
-            ButterworthFilterDesigner<T>::designSixPoleLowpass(*ret, normalizedFc);
-            lowpass64 = ret;
-        }
-        return ret;
+        return lowpass64.get(design);
     } else if (div == 16) {
-        std::shared_ptr < BiquadParams<T, 3>> ret = lowpass16.lock();
-        if (!ret) {
-            ret = std::make_shared<BiquadParams<T, 3>>();
-            ButterworthFilterDesigner<T>::designSixPoleLowpass(*ret, normalizedFc);
-            lowpass16 = ret;
-        }
-        return ret;
+        return lowpass16.get(design);
     } else if (div == 32) {
-        std::shared_ptr < BiquadParams<T, 3>> ret = lowpass32.lock();
-        if (!ret) {
-            ret = std::make_shared<BiquadParams<T, 3>>();
-            ButterworthFilterDesigner<T>::designSixPoleLowpass(*ret, normalizedFc);
-            lowpass32 = ret;
-        }
-        return ret;
+        return lowpass32.get(design);
     } else {
         assert(false);
     }
     return nullptr;
 };
 
-// The weak pointers that hold our singletons.
 template <typename T>
-std::weak_ptr< BiquadParams<T, 3> >  ObjectCache<T>::lowpass64;
+void ObjectCache<T>::init()
+{
+    getAudioTaper();
+    getBipolarAudioTaper();
+    getBipolarAudioTaper30();
+    getBipolarAudioTaper42();
+    getAudioTaper18();
+    getSinLookup();
+    getMixerPanL();
+    getMixerPanR();
+    getExp2();
+    getExp2ExtendedLow();
+    getExp2ExtendedHigh();
+    getDb2Gain();
+    getTanh5();
+}
+
+template <typename T>
+std::vector<ObjectCacheStats> ObjectCache<T>::getStats()
+{
+    return {
+        audioTaper.getStats("audioTaper"),
+        bipolarAudioTaper.getStats("bipolarAudioTaper"),
+        bipolarAudioTaper30.getStats("bipolarAudioTaper30"),
+        bipolarAudioTaper42.getStats("bipolarAudioTaper42"),
+        audioTaper18.getStats("audioTaper18"),
+        sinLookupTable.getStats("sinLookup"),
+        mixerPanL.getStats("mixerPanL"),
+        mixerPanR.getStats("mixerPanR"),
+        exp2.getStats("exp2"),
+        exp2ExLow.getStats("exp2ExtendedLow"),
+        exp2ExHigh.getStats("exp2ExtendedHigh"),
+        db2Gain.getStats("db2Gain"),
+        tanh5.getStats("tanh5"),
+        lowpass64.getStats("6PLP/64"),
+        lowpass32.getStats("6PLP/32"),
+        lowpass16.getStats("6PLP/16")};
+}
+
+template <typename T>
+void ObjectCache<T>::_reset()
+{
+    audioTaper.reset();
+    bipolarAudioTaper.reset();
+    bipolarAudioTaper30.reset();
+    bipolarAudioTaper42.reset();
+    audioTaper18.reset();
+    sinLookupTable.reset();
+    mixerPanL.reset();
+    mixerPanR.reset();
+    exp2.reset();
+    exp2ExLow.reset();
+    exp2ExHigh.reset();
+    db2Gain.reset();
+    tanh5.reset();
+    lowpass64.reset();
+    lowpass32.reset();
+    lowpass16.reset();
+}
+
+// The entries that hold our singletons.
+template <typename T>
+ObjectCacheEntry<BiquadParams<T, 3>> ObjectCache<T>::lowpass64;
 template <typename T>
-std::weak_ptr< BiquadParams<T, 3> >  ObjectCache<T>::lowpass32;
+ObjectCacheEntry<BiquadParams<T, 3>> ObjectCache<T>::lowpass32;
 template <typename T>
-std::weak_ptr< BiquadParams<T, 3> >  ObjectCache<T>::lowpass16;
+ObjectCacheEntry<BiquadParams<T, 3>> ObjectCache<T>::lowpass16;
 
 template <typename T>
-std::weak_ptr<LookupTableParams<T>> ObjectCache<T>::bipolarAudioTaper;
+ObjectCacheEntry<LookupTableParams<T>> ObjectCache<T>::bipolarAudioTaper;
 
 template <typename T>
-std::weak_ptr<LookupTableParams<T>> ObjectCache<T>::bipolarAudioTaper30;
+ObjectCacheEntry<LookupTableParams<T>> ObjectCache<T>::bipolarAudioTaper30;
 
 template <typename T>
-std::weak_ptr<LookupTableParams<T>> ObjectCache<T>::bipolarAudioTaper42;
+ObjectCacheEntry<LookupTableParams<T>> ObjectCache<T>::bipolarAudioTaper42;
 
 template <typename T>
-std::weak_ptr<LookupTableParams<T>> ObjectCache<T>::audioTaper;
+ObjectCacheEntry<LookupTableParams<T>> ObjectCache<T>::audioTaper;
 
 template <typename T>
-std::weak_ptr<LookupTableParams<T>> ObjectCache<T>::audioTaper18;
+ObjectCacheEntry<LookupTableParams<T>> ObjectCache<T>::audioTaper18;
 
 template <typename T>
-std::weak_ptr<LookupTableParams<T>> ObjectCache<T>::sinLookupTable;
+ObjectCacheEntry<LookupTableParams<T>> ObjectCache<T>::sinLookupTable;
 
 template <typename T>
-std::weak_ptr<LookupTableParams<T>> ObjectCache<T>::exp2;
+ObjectCacheEntry<LookupTableParams<T>> ObjectCache<T>::exp2;
 
 template <typename T>
-std::weak_ptr<LookupTableParams<T>> ObjectCache<T>::exp2ExLow;
+ObjectCacheEntry<LookupTableParams<T>> ObjectCache<T>::exp2ExLow;
 
 template <typename T>
-std::weak_ptr<LookupTableParams<T>> ObjectCache<T>::exp2ExHigh;
+ObjectCacheEntry<LookupTableParams<T>> ObjectCache<T>::exp2ExHigh;
 
 template <typename T>
-std::weak_ptr<LookupTableParams<T>> ObjectCache<T>::db2Gain;
+ObjectCacheEntry<LookupTableParams<T>> ObjectCache<T>::db2Gain;
 
 template <typename T>
-std::weak_ptr<LookupTableParams<T>> ObjectCache<T>::tanh5;
+ObjectCacheEntry<LookupTableParams<T>> ObjectCache<T>::tanh5;
 
 template <typename T>
-std::weak_ptr<LookupTableParams<T>> ObjectCache<T>::mixerPanL;
+ObjectCacheEntry<LookupTableParams<T>> ObjectCache<T>::mixerPanL;
 
 template <typename T>
-std::weak_ptr<LookupTableParams<T>> ObjectCache<T>::mixerPanR;
+ObjectCacheEntry<LookupTableParams<T>> ObjectCache<T>::mixerPanR;
 
 // Explicit instantiation, so we can put implementation into .cpp file
 template class ObjectCache<double>;
@@ -285,4 +331,5 @@ template class ObjectCache<float>;
 
 // we don't want to do the entire object cache in simd, but we do need this:
 template std::shared_ptr<BiquadParams<float_4, 3>>  ObjectCache<float_4>::get6PLPParams(float normalizedFc);
+template void ObjectCache<float_4>::_reset();
 
@@ -3,21 +3,119 @@
 #include "LookupTable.h"
 #include "BiquadParams.h"
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * How many times one cached object has been built, and
+ * how many times it was handed out without building it.
+ */
+struct ObjectCacheStats
+{
+    const char* name = "";
+    int builds = 0;
+    int hits = 0;
+};
+
+/**
+ * One object in the cache. The object is built the first time it is asked for,
+ * and then kept until _reset. After that, get is just a shared_ptr copy.
+ *
+ * Safe to call from any thread. All the members have constexpr constructors,
+ * so static entries are ready before any static constructor can use them.
+ */
+template <typename Obj>
+class ObjectCacheEntry
+{
+public:
+    /**
+     * build(Obj&) fills in a new, default constructed object.
+     * It is only called once, even if many threads ask at the same time.
+     */
+    template <typename F>
+    std::shared_ptr<Obj> get(F build)
+    {
+        std::shared_ptr<Obj> ret = std::atomic_load(&object);
+        if (ret) {
+            ++hits;
+            return ret;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        ret = std::atomic_load(&object);
+        if (ret) {
+            // someone else built it while we waited
+            ++hits;
+            return ret;
+        }
+        ret = std::make_shared<Obj>();
+        build(*ret);
+        ++builds;
+        std::atomic_store(&object, ret);
+        return ret;
+    }
+
+    ObjectCacheStats getStats(const char* name) const
+    {
+        ObjectCacheStats ret;
+        ret.name = name;
+        ret.builds = builds;
+        ret.hits = hits;
+        return ret;
+    }
+
+    /**
+     * Drops our reference, and clears the counts.
+     * Clients that still hold the object may keep using it.
+     */
+    void reset()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::atomic_store(&object, std::shared_ptr<Obj>());
+        builds = 0;
+        hits = 0;
+    }
+
+private:
+    std::mutex mutex;
+    std::shared_ptr<Obj> object;
+    std::atomic<int> builds = {0};
+    std::atomic<int> hits = {0};
+};
+
 /**
  * This class creates objects and caches them.
- * Objects in the cache only stay alive as long as there is a reference to the object,
- * If all refs go away, the object will be deleted.
+ * Each object is built once, on first use or by init(), and then
+ * stays in the cache for the life of the plugin. So after init(),
+ * constructing a module that uses these is just a pointer copy, and
+ * adding and removing modules never re-builds the tables.
  *
- * All accessors return shared pointers to make the lifetime management easy.
- * Clients are free to use the shared_ptr directly, or may use the raw pointer,
+ * All accessors are thread safe, and return shared pointers. Clients
+ * are free to use the shared_ptr directly, or may use the raw pointer,
  * as long as the client holds onto the reference.
+ * The objects are never modified after they are built.
  */
 
 template <typename T>
 class ObjectCache
 {
 public:
-  
+    /**
+     * Builds all the objects now, rather than when the first module asks for them.
+     */
+    static void init();
+
+    /**
+     * Build and hit counts for all the objects.
+     */
+    static std::vector<ObjectCacheStats> getStats();
+
+    /**
+     * Empties the cache. For unit tests that look for leaks.
+     */
+    static void _reset();
 
     // default is 24db
     static std::shared_ptr<LookupTableParams<T>> getAudioTaper();
@@ -60,26 +158,22 @@ public:
     static std::shared_ptr<BiquadParams<T, 3>> get6PLPParams(float normalizedFc);
 
 private:
-    /**
-     * Cache uses weak pointers. This allows the cached objects to be
-     * freed when the last client reference goes away.
-     */
-    static std::weak_ptr<LookupTableParams<T>> bipolarAudioTaper;
-    static std::weak_ptr<LookupTableParams<T>> bipolarAudioTaper30;
-    static std::weak_ptr<LookupTableParams<T>> bipolarAudioTaper42;
-    static std::weak_ptr<LookupTableParams<T>> audioTaper;
-    static std::weak_ptr<LookupTableParams<T>> audioTaper18;
-    static std::weak_ptr<LookupTableParams<T>> sinLookupTable;
-    static std::weak_ptr<LookupTableParams<T>> exp2;
-    static std::weak_ptr<LookupTableParams<T>> exp2ExHigh;
-    static std::weak_ptr<LookupTableParams<T>> exp2ExLow;
-    static std::weak_ptr<LookupTableParams<T>> db2Gain;
-    static std::weak_ptr<LookupTableParams<T>> tanh5;
-
-    static std::weak_ptr< BiquadParams<T, 3>> lowpass64;
-    static std::weak_ptr< BiquadParams<T, 3>> lowpass32; 
-    static std::weak_ptr< BiquadParams<T, 3>> lowpass16;
-
-    static std::weak_ptr<LookupTableParams<T>> mixerPanL;
-    static std::weak_ptr<LookupTableParams<T>> mixerPanR;
+    static ObjectCacheEntry<LookupTableParams<T>> bipolarAudioTaper;
+    static ObjectCacheEntry<LookupTableParams<T>> bipolarAudioTaper30;
+    static ObjectCacheEntry<LookupTableParams<T>> bipolarAudioTaper42;
+    static ObjectCacheEntry<LookupTableParams<T>> audioTaper;
+    static ObjectCacheEntry<LookupTableParams<T>> audioTaper18;
+    static ObjectCacheEntry<LookupTableParams<T>> sinLookupTable;
+    static ObjectCacheEntry<LookupTableParams<T>> exp2;
+    static ObjectCacheEntry<LookupTableParams<T>> exp2ExHigh;
+    static ObjectCacheEntry<LookupTableParams<T>> exp2ExLow;
+    static ObjectCacheEntry<LookupTableParams<T>> db2Gain;
+    static ObjectCacheEntry<LookupTableParams<T>> tanh5;
+
+    static ObjectCacheEntry<BiquadParams<T, 3>> lowpass64;
+    static ObjectCacheEntry<BiquadParams<T, 3>> lowpass32;
+    static ObjectCacheEntry<BiquadParams<T, 3>> lowpass16;
+
+    static ObjectCacheEntry<LookupTableParams<T>> mixerPanL;
+    static ObjectCacheEntry<LookupTableParams<T>> mixerPanR;
 };
@@ -148,4 +148,90 @@ void Poly<T, order>::calcDC(T gain)
     dcComponent[2] = T(32 * sinEnergy6 - 48 * sinEnergy4 + 18 * sinEnergy2);
     dcComponent[3] = T(128 * sinEnergy8 - 256 * sinEnergy6 + 160 * sinEnergy4  - 32 * sinEnergy2);
     dcComponent[4] = T(512 * sinEnergy10 - 1280 * sinEnergy8 + 1120 * sinEnergy6 - 400 * sinEnergy4 + 50 * sinEnergy2);
-}
\ No newline at end of file
+}
+
+/**
+ * The same sum of Chebyshev polynomials (and DC correction) as Poly,
+ * but cheap enough to run in float, and on SIMD types (like float_4).
+ *
+ * Instead of summing powers of x, which needs doubles to stay accurate at order 10,
+ * it uses Clenshaw's recurrence to evaluate the Chebyshev series directly.
+ * That is stable in float, and only takes one multiply-add per harmonic.
+ *
+ * All of the constant terms are folded into one offset. Since that depends on the gains,
+ * call update() after changing them. It isn't needed every sample.
+ */
+template <typename T, int order>
+class ChebyshevPoly
+{
+public:
+    ChebyshevPoly();
+
+    /**
+     * @param index is 0 for the fundamental, 1 for the second harmonic, etc.
+     */
+    void setGain(int index, T value)
+    {
+        assert(index >= 0 && index < order);
+        gains[index] = value;
+    }
+
+    /**
+     * Re-calculates the DC correction.
+     * @param inputGain is the peak level of the sine wave that will be fed to run().
+     */
+    void update(T inputGain);
+    T run(T x) const;
+
+private:
+    T gains[order];
+    T offset;
+};
+
+template <typename T, int order>
+inline ChebyshevPoly<T, order>::ChebyshevPoly()
+{
+    assert(order == 10);        // like Poly, the DC correction is hard coded.
+    for (int i = 0; i < order; ++i) {
+        gains[i] = 0;
+    }
+    offset = 0;
+}
+
+template <typename T, int order>
+inline T ChebyshevPoly<T, order>::run(T x) const
+{
+    // b(k) = gain(k) + 2x * b(k+1) - b(k+2), from the top down.
+    const T twoX = x + x;
+    T b1 = 0;
+    T b2 = 0;
+    for (int i = order - 1; i > 0; --i) {
+        const T b0 = (gains[i] - b2) + twoX * b1;   // b1 is the only long dependency
+        b2 = b1;
+        b1 = b0;
+    }
+    // gains[0] is T1, and there is no T0 term - just the offset.
+    return offset + x * ((gains[0] - b2) + twoX * b1) - b1;
+}
+
+template <typename T, int order>
+inline void ChebyshevPoly<T, order>::update(T inputGain)
+{
+    // The average of (inputGain * sin) ** n, for the even powers.
+    const T g2 = inputGain * inputGain;
+    const T e2 = g2 * T(2.f / 4.f);
+    const T e4 = e2 * g2 * T(3.f / 4.f);
+    const T e6 = e4 * g2 * T(5.f / 6.f);
+    const T e8 = e6 * g2 * T(7.f / 8.f);
+    const T e10 = e8 * g2 * T(9.f / 10.f);
+
+    // Average of each even harmonic, including its constant term (which Poly leaves out).
+    // Then we subtract them all at once.
+    const T dc2 = T(2) * e2 - T(1);
+    const T dc4 = T(8) * e4 - T(8) * e2 + T(1);
+    const T dc6 = T(32) * e6 - T(48) * e4 + T(18) * e2 - T(1);
+    const T dc8 = T(128) * e8 - T(256) * e6 + T(160) * e4 - T(32) * e2 + T(1);
+    const T dc10 = T(512) * e10 - T(1280) * e8 + T(1120) * e6 - T(400) * e4 + T(50) * e2 - T(1);
+
+    offset = T(0) - (gains[1] * dc2 + gains[3] * dc4 + gains[5] * dc6 + gains[7] * dc8 + gains[9] * dc10);
+}
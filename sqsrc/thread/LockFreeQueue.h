@@ -0,0 +1,130 @@
+#pragma once
+
+#include <assert.h>
+#include <atomic>
+#include <cstddef>
+
+/**
+ * A bounded queue that is safe for any number of producer and consumer threads.
+ * Template arguments are for type stored, and for size, which must be a power of two.
+ *
+ * Neither push nor pop will ever block, lock a mutex, or allocate memory, so
+ * they may be called from the audio thread. Instead they fail if the queue is full (or empty).
+ *
+ * Each slot has a sequence number that tells whose turn it is to use it, which
+ * is what lets producers and consumers claim slots with a single compare-exchange.
+ * (This is Dmitry Vyukov's bounded MPMC queue).
+ *
+ * Objects in the queue are not owned by the queue - they will not be destroyed.
+ */
+template <typename T, int SIZE>
+class LockFreeQueue
+{
+public:
+    LockFreeQueue();
+    const LockFreeQueue& operator= (const LockFreeQueue&) = delete;
+    LockFreeQueue(const LockFreeQueue&) = delete;
+
+    /**
+     * returns false if the queue is full.
+     */
+    bool tryPush(T);
+
+    /**
+     * returns false if the queue is empty.
+     */
+    bool tryPop(T&);
+
+    /**
+     * Only a hint when other threads are using the queue.
+     */
+    bool empty() const;
+
+    static int capacity()
+    {
+        return SIZE;
+    }
+
+private:
+    static_assert(SIZE > 0 && (SIZE & (SIZE - 1)) == 0, "queue size must be a power of two");
+
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    // Keep the producer and consumer positions on separate cache lines.
+    // (padding instead of alignas, since we get allocated with plain new).
+    Cell cells[SIZE];
+    char pad0[64];
+    std::atomic<size_t> pushPos;
+    char pad1[64];
+    std::atomic<size_t> popPos;
+};
+
+template <typename T, int SIZE>
+inline LockFreeQueue<T, SIZE>::LockFreeQueue()
+{
+    for (size_t i = 0; i < SIZE; ++i) {
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    pushPos.store(0, std::memory_order_relaxed);
+    popPos.store(0, std::memory_order_relaxed);
+}
+
+template <typename T, int SIZE>
+inline bool LockFreeQueue<T, SIZE>::tryPush(T value)
+{
+    size_t pos = pushPos.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell& cell = cells[pos & (SIZE - 1)];
+        const size_t seq = cell.sequence.load(std::memory_order_acquire);
+        const ptrdiff_t diff = ptrdiff_t(seq) - ptrdiff_t(pos);
+        if (diff == 0) {
+            // slot is free - try to claim it
+            if (pushPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                cell.value = value;
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            // consumer hasn't freed this slot yet, so we are full
+            return false;
+        } else {
+            // another producer beat us to it
+            pos = pushPos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T, int SIZE>
+inline bool LockFreeQueue<T, SIZE>::tryPop(T& value)
+{
+    size_t pos = popPos.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell& cell = cells[pos & (SIZE - 1)];
+        const size_t seq = cell.sequence.load(std::memory_order_acquire);
+        const ptrdiff_t diff = ptrdiff_t(seq) - ptrdiff_t(pos + 1);
+        if (diff == 0) {
+            if (popPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                value = cell.value;
+                // hand the slot back to the producers, one lap later
+                cell.sequence.store(pos + SIZE, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = popPos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T, int SIZE>
+inline bool LockFreeQueue<T, SIZE>::empty() const
+{
+    const size_t pos = popPos.load(std::memory_order_relaxed);
+    const size_t seq = cells[pos & (SIZE - 1)].sequence.load(std::memory_order_acquire);
+    return seq != pos + 1;
+}
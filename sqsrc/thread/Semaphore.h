@@ -0,0 +1,112 @@
+#pragma once
+
+#if defined(ARCH_WIN)
+#include <windows.h>
+#include <limits.h>
+#elif defined(ARCH_MAC)
+#include <dispatch/dispatch.h>
+#else
+#include <errno.h>
+#include <semaphore.h>
+#endif
+
+/**
+ * A counting semaphore, for waking up a thread that is waiting for work.
+ *
+ * post() never blocks and doesn't take any lock, so the audio thread may call it.
+ * If a thread is waiting it is a system call to wake it up, so callers keep track
+ * of who is asleep and only post when someone is.
+ *
+ * Unlike a condition variable, a post is never lost: if it comes in before the
+ * other thread gets to wait(), that wait() returns right away.
+ */
+class Semaphore
+{
+public:
+    Semaphore();
+    ~Semaphore();
+
+    void post();
+    void wait();
+
+    Semaphore(const Semaphore&) = delete;
+    const Semaphore& operator=(const Semaphore&) = delete;
+private:
+#if defined(ARCH_WIN)
+    HANDLE handle;
+#elif defined(ARCH_MAC)
+    dispatch_semaphore_t sem;
+#else
+    sem_t sem;
+#endif
+};
+
+#if defined(ARCH_WIN)
+
+inline Semaphore::Semaphore()
+{
+    handle = CreateSemaphore(nullptr, 0, LONG_MAX, nullptr);
+}
+
+inline Semaphore::~Semaphore()
+{
+    CloseHandle(handle);
+}
+
+inline void Semaphore::post()
+{
+    ReleaseSemaphore(handle, 1, nullptr);
+}
+
+inline void Semaphore::wait()
+{
+    WaitForSingleObject(handle, INFINITE);
+}
+
+#elif defined(ARCH_MAC)
+
+inline Semaphore::Semaphore()
+{
+    sem = dispatch_semaphore_create(0);
+}
+
+inline Semaphore::~Semaphore()
+{
+    dispatch_release(sem);
+}
+
+inline void Semaphore::post()
+{
+    dispatch_semaphore_signal(sem);
+}
+
+inline void Semaphore::wait()
+{
+    dispatch_semaphore_wait(sem, DISPATCH_TIME_FOREVER);
+}
+
+#else
+
+inline Semaphore::Semaphore()
+{
+    sem_init(&sem, 0, 0);
+}
+
+inline Semaphore::~Semaphore()
+{
+    sem_destroy(&sem);
+}
+
+inline void Semaphore::post()
+{
+    sem_post(&sem);
+}
+
+inline void Semaphore::wait()
+{
+    // a signal can wake us up early
+    while (sem_wait(&sem) != 0 && errno == EINTR) {
+    }
+}
+
+#endif
@@ -17,14 +17,8 @@ ThreadClient::ThreadClient(std::shared_ptr<ThreadSharedState> state,
 ThreadClient::~ThreadClient()
 {
     sharedState->client_askServerToStop();
-    sharedState->serverStopRequested.store(true);               // ask server to stop
-
-    while (sharedState->serverRunning) {
-        static bool did = false;
-        if (!did) {
-            did = true;
-        }
-    }
+    _server->stop();
+    assert(!sharedState->serverRunning);
 }
 
 ThreadMessage * ThreadClient::getMessage()
@@ -36,4 +30,9 @@ ThreadMessage * ThreadClient::getMessage()
 bool ThreadClient::sendMessage(ThreadMessage * message)
 {
     return sharedState->client_trySendMessage(message);
-}
\ No newline at end of file
+}
+
+int ThreadClient::messagesInPlay() const
+{
+    return sharedState->client_messagesInPlay();
+}
@@ -25,14 +25,18 @@ public:
 
     /**
      * Try to send a message.
-     * Returns true if message sent.
+     * Returns true if message sent, in which case message->token
+     * will match the token of the reply.
      *
-     * Message might not be sent for various reasons:
-     *      - Mailbox still has previous message.
-     *      - Unable to lock semaphore without blocking.
+     * Message will not be sent if there are already
+     * ThreadSharedState::maxMessagesInPlay messages waiting for replies.
      */
     bool sendMessage(ThreadMessage *);
 
+    /**
+     * Number of messages sent that have not come back yet.
+     */
+    int messagesInPlay() const;
 
 
     const ThreadClient& operator= (const ThreadClient&) = delete;
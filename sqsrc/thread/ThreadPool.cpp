@@ -0,0 +1,285 @@
+#include "ThreadPool.h"
+
+#include <assert.h>
+#include <algorithm>
+
+#include "ThreadServer.h"
+#include "ThreadSharedState.h"
+
+ThreadPool& ThreadPool::get()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+ThreadPool::~ThreadPool()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    stopWorkers();
+}
+
+void ThreadPool::setNumThreads(int numThreads)
+{
+    assert(numThreads >= 0);
+    std::lock_guard<std::mutex> lock(mutex);
+    requestedThreads = numThreads;
+    if (!workers.empty()) {
+        stopWorkers();
+        startWorkers();
+    }
+}
+
+int ThreadPool::getNumThreads()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return (requestedThreads > 0) ? requestedThreads : defaultNumThreads();
+}
+
+int ThreadPool::defaultNumThreads()
+{
+    // Most work is loading samples, which is mostly waiting on the disk.
+    // So we don't need a lot.
+    const int cores = int(std::thread::hardware_concurrency());
+    return std::max(2, std::min(4, cores / 2));
+}
+
+bool ThreadPool::add(ThreadServer* server)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // Each server is in line at most once, so as long as we stay under
+    // maxServers, the line can't overflow.
+    int removedStillInLine = 0;
+    {
+        std::lock_guard<std::mutex> removedLock(removedMutex);
+        removedStillInLine = int(removedInLine.size());
+    }
+    if (numServers + removedStillInLine >= maxServers) {
+        return false;
+    }
+    ++numServers;
+
+    // don't start any threads until someone needs them
+    if (workers.empty()) {
+        startWorkers();
+    }
+    return true;
+}
+
+void ThreadPool::remove(ThreadServer* server)
+{
+    using Phase = ThreadSharedState::Phase;
+    ThreadSharedState& state = *server->sharedState;
+    for (bool done = false; !done; ) {
+        Phase phase = state.serverPhase.load();
+        switch (phase) {
+            case Phase::Running: {
+                // have to let the worker finish the message.
+                std::unique_lock<std::mutex> lock(idleMutex);
+                ++removersWaiting;
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                while (state.serverPhase.load() == Phase::Running) {
+                    idleCondition.wait(lock);
+                }
+                --removersWaiting;
+            }
+                break;
+            case Phase::Queued: {
+                // We can't take it out of the lock free queue, so leave it there,
+                // holding a reference, and the worker that pops it will throw it away.
+                // Add the reference first, so that worker is sure to find it.
+                std::lock_guard<std::mutex> lock(removedMutex);
+                removedInLine.push_back(server->sharedState);
+                done = state.serverPhase.compare_exchange_strong(phase, Phase::Removed);
+                if (!done) {
+                    removedInLine.pop_back();
+                }
+            }
+                break;
+            case Phase::Idle:
+                done = state.serverPhase.compare_exchange_strong(phase, Phase::Removed);
+                break;
+            case Phase::Removed:
+                done = true;
+                break;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    --numServers;
+}
+
+void ThreadPool::schedule(ThreadServer* server)
+{
+    using Phase = ThreadSharedState::Phase;
+    Phase expected = Phase::Idle;
+    if (!server->sharedState->serverPhase.compare_exchange_strong(expected, Phase::Queued)) {
+        return;  // already in line, or running, or removed
+    }
+    enqueue(server->sharedState.get(), server->getPriority() == ThreadServer::Priority::High);
+}
+
+void ThreadPool::enqueue(ThreadSharedState* state, bool highPriority)
+{
+    assert(state->serverPhase == ThreadSharedState::Phase::Queued);
+    auto& line = highPriority ? highPriorityServers : normalPriorityServers;
+    const bool pushed = line.tryPush(state);
+    assert(pushed);  // can't happen, add() doesn't let in more than maxServers
+    (void) pushed;
+
+    // Wake up one worker that can take it, if any are asleep. A worker that is
+    // about to sleep will either see what we pushed, or get our post.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (highPriority && claimSleeper(sleepingHighPriority)) {
+        highPriorityWakeup.post();
+    } else if (claimSleeper(sleepingNormal)) {
+        normalWakeup.post();
+    }
+}
+
+/**
+ * Takes one from the count of sleeping workers. If it returns true,
+ * the caller must post once for that worker.
+ */
+bool ThreadPool::claimSleeper(std::atomic<int>& sleeping)
+{
+    int n = sleeping.load();
+    while (n > 0) {
+        if (sleeping.compare_exchange_weak(n, n - 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+ThreadSharedState* ThreadPool::getNextServer(bool highPriorityOnly)
+{
+    ThreadSharedState* state = nullptr;
+    if (highPriorityServers.tryPop(state)) {
+        return state;
+    }
+    if (!highPriorityOnly && normalPriorityServers.tryPop(state)) {
+        return state;
+    }
+    return nullptr;
+}
+
+void ThreadPool::runServer(ThreadSharedState* state)
+{
+    using Phase = ThreadSharedState::Phase;
+    Phase expected = Phase::Queued;
+    if (!state->serverPhase.compare_exchange_strong(expected, Phase::Running)) {
+        // it was removed while in line.
+        discardRemoved(state);
+        return;
+    }
+
+    // Now remove() will wait for us, so the server can't go away until we are done.
+    // It may be stopping, though.
+    ThreadServer* server = state->server.load();
+    if (!server) {
+        wentIdle(state);
+        return;
+    }
+
+    // Hold on to the shared state, since the server may be
+    // deleted as soon as we go back to Idle.
+    std::shared_ptr<ThreadSharedState> holdState = server->sharedState;
+    const bool highPriority = server->getPriority() == ThreadServer::Priority::High;
+    server->serviceOneMessage();
+    wentIdle(state);
+
+    // If more messages came in, get back in line behind everyone else.
+    // Only if we can get it out of Idle - then we know it wasn't removed.
+    if (!state->serverStopRequested.load() && state->server_hasMessage()) {
+        expected = Phase::Idle;
+        if (state->serverPhase.compare_exchange_strong(expected, Phase::Queued)) {
+            enqueue(state, highPriority);
+        }
+    }
+}
+
+/**
+ * After this, the server (and even the state) may be gone,
+ * unless the caller is holding on to it.
+ */
+void ThreadPool::wentIdle(ThreadSharedState* state)
+{
+    state->serverPhase.store(ThreadSharedState::Phase::Idle);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (removersWaiting.load()) {
+        std::lock_guard<std::mutex> lock(idleMutex);
+        idleCondition.notify_all();
+    }
+}
+
+void ThreadPool::discardRemoved(ThreadSharedState* state)
+{
+    // Last thing we do, since this may delete the state.
+    std::lock_guard<std::mutex> lock(removedMutex);
+    for (auto it = removedInLine.begin(); it != removedInLine.end(); ++it) {
+        if (it->get() == state) {
+            removedInLine.erase(it);
+            return;
+        }
+    }
+}
+
+void ThreadPool::workerFunction(bool highPriorityOnly)
+{
+    while (!stopRequested.load()) {
+        ThreadSharedState* state = getNextServer(highPriorityOnly);
+        if (state) {
+            runServer(state);
+            continue;
+        }
+
+        // Nothing to do, so go to sleep. Tell schedule() we are asleep, then
+        // look once more in case something came in before it could see that.
+        Semaphore& wakeup = highPriorityOnly ? highPriorityWakeup : normalWakeup;
+        std::atomic<int>& sleeping = highPriorityOnly ? sleepingHighPriority : sleepingNormal;
+        ++sleeping;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const bool haveWork = !highPriorityServers.empty() || (!highPriorityOnly && !normalPriorityServers.empty());
+        if (haveWork || stopRequested.load()) {
+            // Take ourselves off the count. If someone already did, there is a post for us.
+            if (!claimSleeper(sleeping)) {
+                wakeup.wait();
+            }
+            continue;
+        }
+        wakeup.wait();
+    }
+}
+
+void ThreadPool::startWorkers()
+{
+    assert(workers.empty());
+    const int numThreads = (requestedThreads > 0) ? requestedThreads : defaultNumThreads();
+
+    stopRequested = false;
+    for (int i = 0; i < numThreads; ++i) {
+        // Keep the first one free for high priority servers, as long as
+        // that still leaves two for everyone else.
+        const bool highPriorityOnly = (i == 0) && (numThreads > 2);
+        workers.push_back(std::unique_ptr<std::thread>(new std::thread([this, highPriorityOnly]() {
+            this->workerFunction(highPriorityOnly);
+        })));
+    }
+}
+
+void ThreadPool::stopWorkers()
+{
+    stopRequested = true;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while (claimSleeper(sleepingHighPriority)) {
+        highPriorityWakeup.post();
+    }
+    while (claimSleeper(sleepingNormal)) {
+        normalWakeup.post();
+    }
+    for (auto& worker : workers) {
+        worker->join();
+    }
+    workers.clear();
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "LockFreeQueue.h"
+#include "Semaphore.h"
+
+class ThreadServer;
+class ThreadSharedState;
+
+/**
+ * One set of worker threads, shared by every ThreadServer in the process.
+ * This way a patch with dozens of modules that use ThreadServer doesn't
+ * have dozens of threads, mostly doing nothing.
+ *
+ * ThreadServers register with the pool when they start. When a client sends a message,
+ * its server is put in line for a worker. A worker will only handle one message for a
+ * server before putting it at the back of the line, so one busy module can't
+ * hog the pool. A server's messages are never handled by two workers at once, so
+ * each server still sees its messages one at a time, in order.
+ *
+ * ThreadServers with Priority::High are always served first. If there are at least
+ * three workers, the first one is reserved for them, so they are never stuck behind
+ * a slow job (like loading samples). With fewer than that, reserving one would leave a
+ * single worker for every normal server.
+ *
+ * schedule() is lock free, and may be called from the audio thread. If a worker is
+ * asleep, it also posts a Semaphore to wake it up. That is a system call, but it
+ * doesn't take any lock, and only happens when the pool was idle.
+ * The rest of the API is for the UI thread.
+ */
+class ThreadPool
+{
+public:
+    static ThreadPool& get();
+    ~ThreadPool();
+
+    /**
+     * Change the number of worker threads. Waits for running jobs to finish.
+     * Zero (the default) means pick a number based on the number of cores.
+     */
+    void setNumThreads(int numThreads);
+    int getNumThreads();
+
+    /**
+     * Register / unregister a server.
+     * remove() will wait until the server is not handling a message, and
+     * after that the pool will never call it again. If the server is only
+     * waiting in line, remove() takes it out of line without waiting.
+     * add() returns false if there are already maxServers. That server will
+     * never be scheduled.
+     */
+    bool add(ThreadServer*);
+    void remove(ThreadServer*);
+
+    /**
+     * Asks the pool to give this server a worker. Does nothing if it already
+     * has one, or is already in line for one.
+     */
+    void schedule(ThreadServer*);
+
+    /**
+     * Most servers that can be registered at once (counting the ones that
+     * were removed while in line, and are still there).
+     */
+    static const int maxServers = 1024;
+
+    const ThreadPool& operator= (const ThreadPool&) = delete;
+    ThreadPool(const ThreadPool&) = delete;
+private:
+    ThreadPool() = default;
+
+    /**
+     * The line holds the shared state rather than the server, since a server
+     * may be removed (and deleted) while it is still in line.
+     */
+    LockFreeQueue<ThreadSharedState*, maxServers> highPriorityServers;
+    LockFreeQueue<ThreadSharedState*, maxServers> normalPriorityServers;
+
+    /**
+     * One reference for every shared state that was removed while still in line,
+     * to keep it alive until a worker pops it and throws it away.
+     */
+    std::mutex removedMutex;
+    std::vector<std::shared_ptr<ThreadSharedState>> removedInLine;
+
+    /**
+     * Workers wait on these when there is nothing in line. The one reserved for
+     * high priority has its own, since it can't take normal work.
+     * The counts are how many are asleep, or about to be, that no one has posted for yet.
+     */
+    Semaphore highPriorityWakeup;
+    Semaphore normalWakeup;
+    std::atomic<int> sleepingHighPriority = {0};
+    std::atomic<int> sleepingNormal = {0};
+
+    /**
+     * remove() sleeps on this while a worker is running its server.
+     * Workers only take the mutex when removersWaiting is not zero.
+     */
+    std::mutex idleMutex;
+    std::condition_variable idleCondition;
+    std::atomic<int> removersWaiting = {0};
+
+    /**
+     * protects everything below here
+     */
+    std::mutex mutex;
+    std::vector<std::unique_ptr<std::thread>> workers;
+    int requestedThreads = 0;
+    int numServers = 0;
+
+    std::atomic<bool> stopRequested = {false};
+
+    void startWorkers();
+    void stopWorkers();
+    void workerFunction(bool highPriorityOnly);
+    ThreadSharedState* getNextServer(bool highPriorityOnly);
+    void runServer(ThreadSharedState*);
+    void discardRemoved(ThreadSharedState*);
+    void wentIdle(ThreadSharedState*);
+    static bool claimSleeper(std::atomic<int>& sleeping);
+
+    /**
+     * puts the server in line. Caller must have just moved it to Phase::Queued.
+     */
+    void enqueue(ThreadSharedState*, bool highPriority);
+    static int defaultNumThreads();
+};
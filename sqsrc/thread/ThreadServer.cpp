@@ -1,48 +1,66 @@
 
 #include <assert.h>
+#include "ThreadPool.h"
 #include "ThreadServer.h"
 #include "ThreadSharedState.h"
 
 int ThreadServer::_instanceCount = 0;
-ThreadServer::ThreadServer(std::shared_ptr<ThreadSharedState> state) : 
-    sharedState(state)
+ThreadServer::ThreadServer(std::shared_ptr<ThreadSharedState> state, Priority p) :
+    sharedState(state),
+    priority(p)
 {
     ++_instanceCount;
 }
 
 ThreadServer::~ThreadServer()
 {
+    stop();
     --_instanceCount;
 }
 
 void ThreadServer::start()
 {
-    auto startupFunc = [this]() {
-        this->threadFunction();
-    };
-    std::unique_ptr<std::thread> th(new std::thread(startupFunc));
-    thread = std::move(th);
+    assert(!started);
+    started = true;
+    sharedState->serverRunning = true;
+    registered = ThreadPool::get().add(this);
+    if (!registered) {
+        return;
+    }
+    sharedState->serverPhase = ThreadSharedState::Phase::Idle;
+    sharedState->server = this;
+
+    // in case any messages were sent before we started
+    if (sharedState->server_hasMessage()) {
+        ThreadPool::get().schedule(this);
+    }
 }
 
-void ThreadServer::threadFunction()
+void ThreadServer::stop()
 {
-    sharedState->serverRunning = true;
-    for (bool done = false; !done; ) {
-        if (sharedState->serverStopRequested.load()) {
-            done = true;
-        } else {
-            // if msg is null, stop was requested (that's not true anyh more, is it?)
-            ThreadMessage* msg = sharedState->server_waitForMessageOrShutdown();
-            if (msg) {
-                procMessage(msg);
-            }
-        }
+    if (!started) {
+        return;
+    }
+    started = false;
+    sharedState->serverStopRequested = true;
+    sharedState->server = nullptr;
+    if (registered) {
+        ThreadPool::get().remove(this);
+        registered = false;
     }
-
-    thread->detach();
     sharedState->serverRunning = false;
 }
 
+void ThreadServer::serviceOneMessage()
+{
+    if (!sharedState->serverStopRequested.load()) {
+        ThreadMessage* msg = sharedState->server_pollMessage();
+        if (msg) {
+            procMessage(msg);
+        }
+    }
+}
+
 //TODO: get rid of this function
 void ThreadServer::procMessage(ThreadMessage* msg)
 {
@@ -1,26 +1,50 @@
 #pragma once
 
 #include <memory>
-#include <thread>
 
 class ThreadSharedState;
 class ThreadMessage;
 
 /**
- * ThreadServer implements a worker thread that can do work
- * off of the audio thread in a plugin.
+ * ThreadServer does work off of the audio thread in a plugin.
  * To do useful work with Thread server:
  *      Derive a class from ThreadServer, and override handleMessage.
  *      Define at least one message by deriving from ThreadMessage.
  *      Control ThreadServer with ThreadClient.
  * For more info, refer to ThreadSharedState
+ *
+ * handleMessage is called on one of the ThreadPool's workers. It may not be the
+ * same thread every time, but it will never be called on two threads at once.
  */
 class ThreadServer
 {
 public:
-    ThreadServer(std::shared_ptr<ThreadSharedState> state);
+    /**
+     * High priority servers are for short jobs that the audio is waiting on.
+     * Normal is for everything else.
+     */
+    enum class Priority
+    {
+        Normal,
+        High
+    };
+
+    ThreadServer(std::shared_ptr<ThreadSharedState> state, Priority priority = Priority::Normal);
     virtual ~ThreadServer();
+
+    /**
+     * start and stop are called by ThreadClient.
+     * stop will wait for the message being handled (if any) to finish.
+     * If the ThreadPool is full, start will leave the server unregistered,
+     * and it will never get any messages.
+     */
     void start();
+    void stop();
+
+    Priority getPriority() const
+    {
+        return priority;
+    }
 
     const ThreadServer& operator= (const ThreadServer&) = delete;
     ThreadServer(const ThreadServer&) = delete;
@@ -35,16 +59,22 @@ protected:
 
     /**
      * Utility for sending replies back to the  client.
-     * Will causes an error if there is a message in the mailbox already.
+     * Should only be called with messages that came from the client.
      */
     void sendMessageToClient(ThreadMessage*);
 
     std::shared_ptr<ThreadSharedState> sharedState;
-    std::unique_ptr<std::thread> thread;
 private:
+    friend class ThreadPool;
+    const Priority priority;
+    bool started = false;
+    bool registered = false;
 
-    // Message based clients should not override this
-    virtual void threadFunction();
+    /**
+     * Called by the ThreadPool when we have a worker.
+     * Handles one message, if there is one.
+     */
+    void serviceOneMessage();
 
     /**
      *
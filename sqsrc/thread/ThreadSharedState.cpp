@@ -1,89 +1,69 @@
 
 #include <assert.h>
+#include "ThreadPool.h"
 #include "ThreadSharedState.h"
 
 std::atomic<int> ThreadSharedState::_dbgCount;
 std::atomic<int> ThreadMessage::_dbgCount;
 
-#include <iostream>
-#include <chrono>
-#include <thread>
-
-ThreadMessage*  ThreadSharedState::server_waitForMessageOrShutdown()
+ThreadMessage* ThreadSharedState::server_pollMessage()
 {
-    // printf("wait\n"); fflush(stdout);
+    ThreadMessage* msg = nullptr;
+    return queueClient2Server.tryPop(msg) ? msg : nullptr;
+}
 
-    std::unique_lock<std::mutex> guard(mailboxMutex);           // grab the mutex that protects condition
-    ThreadMessage* returnMessage = nullptr;
-    for (bool done = false; !done; ) {
-        if (serverStopRequested.load()) {
-            done = true;
-        } else {
-            returnMessage = mailboxClient2Server.load();
-            if (returnMessage) {
-                done = true;
-            }
-        }
-        if (!done) {
-            mailboxCondition.wait(guard);
-        }
-    }
-    mailboxClient2Server.store(nullptr);
-    return returnMessage;
+bool ThreadSharedState::server_hasMessage() const
+{
+    return !queueClient2Server.empty();
 }
 
 void ThreadSharedState::client_askServerToStop()
 {
     serverStopRequested.store(true);                        // ask server to stop
-    std::unique_lock<std::mutex> guard(mailboxMutex);       // grab the mutex
-    mailboxCondition.notify_all();                          // wake up server
 }
 
 ThreadMessage* ThreadSharedState::client_pollMessage()
 {
     ThreadMessage* msg = nullptr;
-
-    // grab lock
-    std::unique_lock<std::mutex> guard(mailboxMutex);
-    msg = mailboxServer2Client.load();
-    if (msg) {
-        mailboxServer2Client.store(nullptr);
+    if (queueServer2Client.tryPop(msg)) {
+        --messagesInPlay;
+        return msg;
     }
-    return msg;
+    return nullptr;
+}
+
+int ThreadSharedState::client_messagesInPlay() const
+{
+    return messagesInPlay.load();
 }
 
-// signal in lock
 bool ThreadSharedState::client_trySendMessage(ThreadMessage* msg)
 {
     assert(serverRunning.load());
-    // If the client tries to send a message before the previous one is read, the
-    // call will fail and the client must try again.
-    if (mailboxClient2Server.load()) {
-        return false;
-    }
-
-    // Write to mailbox (condition) in lock
 
-    std::unique_lock<std::mutex> guard(mailboxMutex, std::defer_lock);
-    // We must use a try_lock here, as calling regular lock() could cause a priority inversion.
-    bool didLock = guard.try_lock();
-    if (!didLock) {
+    // Don't let more out than will fit in the queue back from the server.
+    if (++messagesInPlay > maxMessagesInPlay) {
+        --messagesInPlay;
         return false;
     }
-    assert(guard.owns_lock());
 
-    assert(!mailboxClient2Server.load());               // if there is still a message there we are out of sync
-    mailboxClient2Server.store(msg);
+    msg->token = nextToken++;
+    const bool pushed = queueClient2Server.tryPush(msg);
+    assert(pushed);
+    (void) pushed;
 
-    mailboxCondition.notify_all();
+    // get the server a worker thread to handle it
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    ThreadServer* s = server.load();
+    if (s) {
+        ThreadPool::get().schedule(s);
+    }
     return true;
 }
 
 void ThreadSharedState::server_sendMessage(ThreadMessage* msg)
 {
-    std::unique_lock<std::mutex> guard(mailboxMutex);
-    assert(mailboxServer2Client.load() == nullptr);
-    mailboxServer2Client.store(msg);  
+    const bool pushed = queueServer2Client.tryPush(msg);
+    assert(pushed);         // if the queue is full, client sent more than it should have
+    (void) pushed;
 }
-
-
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <atomic>
-#include <mutex>
-#include <condition_variable>
+#include <cstdint>
+
+#include "LockFreeQueue.h"
+
+class ThreadServer;
 
 /**
  * Messaging protocol between client and server.
@@ -18,8 +21,9 @@
  *      For every message sent client -> server, the server will send once back.
  *          The message objects are owned by whoever created them. Passing
  *          a message does not transfer ownership.
- *      Only one message may be "in play" at a time. Until the client
- *          receives a reply from the server, it may not send another message.
+ *      Up to maxMessagesInPlay messages may be "in play" at a time. Once that
+ *          many have been sent without a reply, client_trySendMessage fails until
+ *          one comes back. The server handles them one at a time, in order.
  */
 
 
@@ -48,6 +52,12 @@ public:
     }
 
     const Type type;
+
+    /**
+     * Set by the client when the message is sent.
+     * The server should not change it.
+     */
+    uint32_t token = 0;
     static std::atomic<int> _dbgCount;
 };
 
@@ -64,8 +74,10 @@ public:
         ++_dbgCount;
         serverRunning.store(false);
         serverStopRequested.store(false);
-        mailboxClient2Server.store(nullptr);
-        mailboxServer2Client.store(nullptr);
+        serverPhase.store(Phase::Removed);
+        server.store(nullptr);
+        messagesInPlay.store(0);
+        nextToken.store(1);
     }
     ~ThreadSharedState()
     {
@@ -76,39 +88,65 @@ public:
     static std::atomic<int> _dbgCount;
 
     /**
-     * If return false, message not sent.
-     * otherwise message send, and msg may be reused.
+     * The server that gets scheduled when a message is sent.
+     * Set while the server is registered with the ThreadPool.
+     */
+    std::atomic<ThreadServer*> server;
+
+    /**
+     * Where the server is with the ThreadPool.
+     * Whoever moves it out of Idle owns the right to run the server. ThreadPool uses this
+     * to make sure one server never runs on two threads at once. It lives here rather
+     * than in the server, so that it can be looked at safely after the server goes away.
+     */
+    enum class Phase
+    {
+        Idle,       // registered, nothing to do
+        Queued,     // waiting in line for a worker
+        Running,    // a worker is handling a message
+        Removed     // not registered, never scheduled
+    };
+    std::atomic<Phase> serverPhase;
+
+    static const int maxMessagesInPlay = 64;
+
+    /**
+     * If return false, message not sent (there are already maxMessagesInPlay).
+     * otherwise message sent, and msg->token identifies it.
+     * Message may not be reused until it comes back.
      */
     bool client_trySendMessage(ThreadMessage* msg);
 
     ThreadMessage* client_pollMessage();
     void client_askServerToStop();
 
+    /**
+     * How many messages have been sent that have not come back yet.
+     */
+    int client_messagesInPlay() const;
+
     void server_sendMessage(ThreadMessage* msg);
 
     /**
      * returned message is a pointer to a message that we "own"
      * temporarily (sender may modify it, but won't delete it).
      *
-     * if null returned, a shutdown has been requested
+     * returns null if no message waiting.
      */
-    ThreadMessage* server_waitForMessageOrShutdown();
+    ThreadMessage* server_pollMessage();
+    bool server_hasMessage() const;
 
 
 private:
-
     /**
-     * This mutex protects all the private state
-     */
-    std::mutex mailboxMutex;
-
-    /** The message in the mailbox.
-     * This is an object by whoever created it. Ownership of message
+     * The messages in transit.
+     * These are owned by whoever created them. Ownership of message
      * is not passed.
-     * TODO: given that a mutex protects us, we have no reason to use atomics here
+     * Since the client will not send more than maxMessagesInPlay, neither
+     * of these can overflow.
      */
-    std::atomic<ThreadMessage*> mailboxClient2Server;
-    std::atomic<ThreadMessage*> mailboxServer2Client;
-
-    std::condition_variable mailboxCondition;
-};
\ No newline at end of file
+    LockFreeQueue<ThreadMessage*, maxMessagesInPlay> queueClient2Server;
+    LockFreeQueue<ThreadMessage*, maxMessagesInPlay> queueServer2Client;
+    std::atomic<int> messagesInPlay;
+    std::atomic<uint32_t> nextToken;
+};
@@ -253,6 +253,7 @@ void CompressorWidget2::appendContextMenu(Menu* theMenu) {
         }));
 
     SubMenuParamCtrl::create(theMenu, "Stereo/mono", {"Mono", "Stereo", "Linked-stereo"}, module, Comp::STEREO_PARAM);
+    SubMenuParamCtrl::create(theMenu, "Multi-band", {"Off", "Four bands"}, module, Comp::MULTIBAND_PARAM);
 
     auto render = [this](int value) {
         const bool isStereo = APP->engine->getParamValue(this->module, Comp::STEREO_PARAM) > .5;
@@ -287,7 +288,9 @@ void CompressorWidget2::step() {
     if (!module) {
         return;
     }
-    const int stereo = int(std::round(APP->engine->getParamValue(module, Comp::STEREO_PARAM)));
+    // multi-band is always mono: the sixteen "channels" are four inputs times four bands
+    const bool multiBand = APP->engine->getParamValue(module, Comp::MULTIBAND_PARAM) > .5;
+    const int stereo = multiBand ? 0 : int(std::round(APP->engine->getParamValue(module, Comp::STEREO_PARAM)));
     int labelMode = int(std::round(APP->engine->getParamValue(module, Comp::LABELS_PARAM)));
 
     if (stereo == 0) {
@@ -7,9 +7,11 @@
 #ifdef _SAMP
 #include <osdialog.h>
 
+#include "InstrumentCache.h"
 #include "InstrumentInfo.h"
 #include "PitchUtils.h"
 #include "Samp.h"
+#include "SampleDiskCache.h"
 #include "SqStream.h"
 #include "ctrl/PopupMenuParamWidget.h"
 #include "ctrl/SqHelper.h"
@@ -78,6 +80,12 @@ SampModule::SampModule() {
 
     onSampleRateChange();
     samp->init();
+
+    // all instances share one cache folder
+    const std::string cacheFolder = rack::asset::user("SquinkyLabs/samp-cache");
+    rack::system::createDirectories(cacheFolder);
+    SampleDiskCache::get().setFolder(cacheFolder);
+    InstrumentCache::get().setFolder(cacheFolder);
 }
 
 class SemitoneQuantity : public rack::engine::ParamQuantity {
@@ -195,6 +203,16 @@ struct SampWidget : ModuleWidget {
             
             theMenu->addChild(delay);
         }
+        {
+            SqMenuItem_BooleanParam2* stream = new SqMenuItem_BooleanParam2(module, Comp::STREAMING_PARAM);
+            stream->text = "Stream samples from disk (on next load)";
+            theMenu->addChild(stream);
+        }
+        {
+            SqMenuItem_BooleanParam2* cache = new SqMenuItem_BooleanParam2(module, Comp::DISKCACHE_PARAM);
+            cache->text = "Cache instruments and samples on disk (on next load)";
+            theMenu->addChild(cache);
+        }
     }
 
     void step() override;
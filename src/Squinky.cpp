@@ -2,6 +2,7 @@
 #include "Squinky.hpp"
 //#include "SqTime.h"
 #include "ctrl/SqHelper.h"
+#include "ObjectCache.h"
 
 
 // The plugin-wide instance of the Plugin class
@@ -148,6 +149,8 @@ p->addModel(modelSampModule);
 p->addModel(modelTestModule);
 #endif
 
+    // build the shared lookup tables now, so module construction doesn't have to.
+    ObjectCache<float>::init();
 }
 
 const NVGcolor SqHelper::COLOR_GREY = nvgRGB(0x80, 0x80, 0x80);
@@ -31,6 +31,10 @@ perf.exe : PERFFLAG = -D _PERF
 # Turn off asserts for perf, unless user overrides on command line
 perf.exe : FLAGS += $(ASSERTOFF)
 
+# render.exe is the same program, but it only renders a patch file. See PatchRenderer.h
+render.exe : PERFFLAG = -D _RENDER
+render.exe : FLAGS += $(ASSERTOFF)
+
 FLAGS += $(PERFFLAG)
 # FLAGS += -flto
 
@@ -39,20 +43,20 @@ test.exe : FLAGS += -D _TESTEX
 ifeq ($(ARCH), win)
 	# don't need these yet
 	#  -lcomdlg32 -lole32 -ldsound -lwinmm
-test.exe perf.exe : LDFLAGS = -static \
+test.exe perf.exe render.exe : LDFLAGS = -static \
 		-mwindows \
 -lpthread -lopengl32 -lgdi32 -lws2_32
 # -flto 
 endif
 
 ifeq ($(ARCH), lin)
-test.exe perf.exe : LDFLAGS = -rdynamic \
+test.exe perf.exe render.exe : LDFLAGS = -rdynamic \
 		-lpthread -lGL -ldl \
 		$(shell pkg-config --libs gtk+-2.0)
 endif
 
 ifeq ($(ARCH), mac)
-test.exe perf.exe : LDFLAGS = -stdlib=libc++ -lpthread -ldl \
+test.exe perf.exe render.exe : LDFLAGS = -stdlib=libc++ -lpthread -ldl \
 		-framework Cocoa -framework OpenGL -framework IOKit -framework CoreVideo
 endif
 
@@ -62,15 +66,20 @@ test : test.exe
 ## So you need to be careful to delete/clean when switching between the two.
 ## Consider fixing this in the future.
 perf : perf.exe
+render : render.exe
 
 ## cleantest will clean out all the test and perf build products
 cleantest :
 	rm -rfv build_test
 	rm -fv test.exe
 	rm -fv perf.exe
+	rm -fv render.exe
 
 test.exe : $(TEST_OBJECTS)
 	$(CXX) -o $@ $^ $(LDFLAGS)
 
 perf.exe : $(TEST_OBJECTS)
+	$(CXX) -o $@ $^ $(LDFLAGS)
+
+render.exe : $(TEST_OBJECTS)
 	$(CXX) -o $@ $^ $(LDFLAGS)
\ No newline at end of file
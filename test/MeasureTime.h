@@ -2,9 +2,14 @@
 
 #include "SimdBlocks.h"
 
+#include <algorithm>
 #include <functional>
+#include <memory>
+#include <string>
+#include <vector>
 #define __STDC_FORMAT_MACROS 
 #include <inttypes.h>
+#include "PerfResults.h"
 #include "TimeStatsCollector.h"
 
 
@@ -32,6 +37,7 @@ class TestBuffers;
  *      - In a tight loop all the data you code references will probably end up in fast on-chip
  *          cache memory. In VCV your step function is called once, then all the other module's step
  *          functions are called. This may force your data out of cache.
+ *          runHotAndCold() is for measuring that.
  */
 template <typename T>
 class MeasureTime
@@ -41,39 +47,118 @@ public:
 
     /**
      * Executes function "func" and measures how long it takes.
-     * Will call func in a tight loop lasting minTime seconds.
-     * When done, prints out statistics.
+     * First calls func in a tight loop until it lasts minTime seconds. That warms
+     * everything up, and tells us how many iterations to do in a trial.
+     * Then it does PerfResults::getTrials() trials that each last about minTime / trials.
+     * When done, prints out statistics, and adds them to PerfResults.
      *
-     * returns - percent used
+     * @param overhead is the percent used by a function that does nothing, and is
+     * subtracted from the result.
+     * returns - percent used, from the median trial
      */
     static double run(double overhead, const char * name, std::function<T()> func, float minTime)
     {
         int64_t iterations;
-        bool done = false;
-        double percent = 0;
+        double elapsed = 0;
 
         //keep increasing the number of iterations until we last at least minTime seconds
-        for (iterations = 100; !done; iterations *= 2) {
-            double elapsed = measureTimeSub(func, iterations);
+        for (iterations = 100; ; iterations *= 2) {
+            elapsed = measureTimeSub(func, iterations);
             if (elapsed >= minTime) {
-                double itersPerSec = iterations / elapsed;
-                double full = 44100;
-                percent = full * 100 / itersPerSec;
-                percent -= overhead;
-                printf("\nmeasure %s over time %f\n", name, minTime);
-
-                printf("did %" PRId64 " iterations in %f seconds\n", iterations, elapsed);
-                printf("that's %f per sec\n", itersPerSec);
-                printf("percent CPU usage: %f\n", percent);
-                printf("best case instances: %f\n", 100 / percent);
-                printf("quota used per 1 percent : %f\n", percent * 100);
-                fflush(stdout);
-                done = true;
+                break;
             }
         }
+
+        const double full = 44100;
+        const double overheadNs = overhead * 1e9 / (full * 100);
+        const int trials = PerfResults::getTrials();
+        const int64_t trialIterations = std::max<int64_t>(100, iterations / trials);
+        std::vector<double> nsPerSample;
+        PerfCounters& counters = PerfCounters::get();
+        const bool useCounters = PerfCounters::isEnabled();
+        counters.clear();
+        for (int i = 0; i < trials; ++i) {
+            if (useCounters) {
+                counters.start();
+            }
+            const double trialElapsed = measureTimeSub(func, trialIterations);
+            if (useCounters) {
+                counters.stop();
+            }
+            nsPerSample.push_back(trialElapsed * 1e9 / trialIterations - overheadNs);
+        }
+        PerfResults::Result result = PerfResults::summarize(name, trialIterations, nsPerSample);
+        if (useCounters) {
+            PerfResults::addCounters(result, counters.getTotal(), trialIterations * trials);
+        }
+        PerfResults::add(result);
+
+        const double itersPerSec = 1e9 / (result.median + overheadNs);
+        const double percent = result.median * full * 100 / 1e9;
+        printf("\nmeasure %s over time %f\n", name, minTime);
+
+        printf("did %" PRId64 " iterations in %f seconds\n", iterations, elapsed);
+        printf("that's %f per sec\n", itersPerSec);
+        printf("percent CPU usage: %f\n", percent);
+        printf("best case instances: %f\n", 100 / percent);
+        printf("quota used per 1 percent : %f\n", percent * 100);
+        printf("ns per sample: median %f p95 %f p99 %f (%d trials)\n", result.median, result.p95, result.p99, trials);
+        if (result.hasCounters) {
+            printf("IPC %f, per sample:", result.ipc);
+            for (int i = 0; i < PerfCounters::NUM_COUNTERS; ++i) {
+                printf(" %s %f", PerfCounters::getName(PerfCounters::Counter(i)), result.perSample[i]);
+            }
+            printf("\n");
+        }
+        fflush(stdout);
         return percent;
     }
 
+    /**
+     * Measures a benchmark twice: "hot", where one object is run in a tight loop like run() does,
+     * and "cold", where PerfResults::getColdInstances() objects are run round robin.
+     * In the cold case, each object's data has been pushed out of the cache by all the others
+     * before it runs again, which is closer to what happens in a big VCV patch.
+     *
+     * @param setup is called once for each new object.
+     * @param step runs one sample of one object.
+     * Adds "<name> (hot)" and "<name> (cold)" to PerfResults, so a benchmark
+     * may also run() the same thing as plain "<name>".
+     * returns - the cold percent used
+     */
+    template <class Obj>
+    static double runHotAndCold(double overhead, const char* name,
+                                std::function<void(Obj&)> setup, std::function<T(Obj&)> step, float minTime)
+    {
+        const int numInstances = std::max(1, PerfResults::getColdInstances());
+        std::vector<std::shared_ptr<Obj>> objects;
+        for (int i = 0; i < numInstances; ++i) {
+            auto obj = std::make_shared<Obj>();
+            setup(*obj);
+            objects.push_back(obj);
+        }
+
+        Obj& first = *objects[0];
+        const std::string hotName = std::string(name) + " (hot)";
+        const double hot = run(overhead, hotName.c_str(), [&first, step]() {
+            return step(first);
+        }, minTime);
+
+        size_t index = 0;
+        const std::string coldName = std::string(name) + " (cold)";
+        const double cold = run(overhead, coldName.c_str(), [&objects, &index, step]() {
+            const T x = step(*objects[index]);
+            if (++index == objects.size()) {
+                index = 0;
+            }
+            return x;
+        }, minTime);
+
+        printf("%s: cold / hot = %f with %d instances\n", name, cold / hot, numInstances);
+        fflush(stdout);
+        return cold;
+    }
+
    /**
     * Run test iterators time, return total seconds.
     */
@@ -0,0 +1,504 @@
+#include "PatchRenderer.h"
+
+#include <assert.h>
+#include <stdio.h>
+
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <locale>
+#include <map>
+#include <sstream>
+
+#include "CHB.h"
+#include "Compressor2.h"
+#include "Filt.h"
+#include "FrequencyShifter.h"
+#include "Basic.h"
+#include "Mix4.h"
+#include "Mix8.h"
+#include "MixStereo.h"
+#include "Samp.h"
+#include "SqWaveFile.h"
+
+/**
+ * Hides the type of the composite from the renderer.
+ */
+class RenderModule
+{
+public:
+    virtual ~RenderModule() = default;
+    virtual TestComposite& composite() = 0;
+    virtual int getNumParams() const = 0;
+    virtual int getNumInputs() const = 0;
+    virtual int getNumOutputs() const = 0;
+
+    /**
+     * Sets the sample rate, puts all the params at their defaults, and inits the composite.
+     */
+    virtual void init(float sampleRate) = 0;
+
+    /**
+     * Called after the patch has set all the params and voltages.
+     */
+    virtual bool start(const std::string& sfzPath) = 0;
+    virtual void process(const TestComposite::ProcessArgs&) = 0;
+};
+
+template <class Comp>
+class RenderComposite : public RenderModule
+{
+public:
+    using Hook = std::function<bool(Comp&, const std::string&)>;
+
+    RenderComposite(std::function<void(Comp&)> onInit, Hook onStart) : onInit(onInit), onStart(onStart)
+    {
+    }
+
+    TestComposite& composite() override
+    {
+        return comp;
+    }
+    int getNumParams() const override
+    {
+        return Comp::NUM_PARAMS;
+    }
+    int getNumInputs() const override
+    {
+        return Comp::NUM_INPUTS;
+    }
+    int getNumOutputs() const override
+    {
+        return Comp::NUM_OUTPUTS;
+    }
+
+    void init(float sampleRate) override
+    {
+        comp.engineSetSampleRate(sampleRate);
+        auto icomp = Comp::getDescription();
+        for (int i = 0; i < icomp->getNumParams(); ++i) {
+            comp.params[i].value = icomp->getParamValue(i).def;
+        }
+        if (onInit) {
+            onInit(comp);
+        }
+    }
+
+    bool start(const std::string& sfzPath) override
+    {
+        return onStart ? onStart(comp, sfzPath) : true;
+    }
+
+    /**
+     * Our composites override either step() or process(), never both,
+     * so calling both is the same as what VCV does.
+     */
+    void process(const TestComposite::ProcessArgs& args) override
+    {
+        comp.step();
+        comp.process(args);
+    }
+
+private:
+    Comp comp;
+    std::function<void(Comp&)> onInit;
+    Hook onStart;
+};
+
+using ModuleFactory = std::function<RenderModulePtr()>;
+
+template <class Comp>
+static ModuleFactory factory(std::function<void(Comp&)> onInit,
+                             typename RenderComposite<Comp>::Hook onStart = nullptr)
+{
+    return [onInit, onStart]() {
+        return std::make_shared<RenderComposite<Comp>>(onInit, onStart);
+    };
+}
+
+/**
+ * Samp loads on a worker thread, so we wait for it here, before the timing starts.
+ * Without an sfz it plays the same synthetic patch as the perf tests.
+ */
+static bool startSamp(Samp<TestComposite>& comp, const std::string& sfzPath)
+{
+    if (sfzPath.empty()) {
+        comp._setupPerfTest();
+        return true;
+    }
+
+    comp.setNewSamples_UI(sfzPath);
+    TestComposite::ProcessArgs args;
+    args.sampleRate = comp.engineGetSampleRate();
+    args.sampleTime = comp.engineGetSampleTime();
+    auto start = std::chrono::steady_clock::now();
+    while (!comp._sampleLoaded()) {
+        comp.process(args);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed.count() > 60) {
+            printf("timed out loading %s\n", sfzPath.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+static const std::map<std::string, ModuleFactory>& getFactories()
+{
+    static const std::map<std::string, ModuleFactory> factories = {
+        {"Samp", factory<Samp<TestComposite>>([](Samp<TestComposite>& c) { c.init(); }, startSamp)},
+        {"Filt", factory<Filt<TestComposite>>([](Filt<TestComposite>& c) { c.init(); })},
+        {"Basic", factory<Basic<TestComposite>>([](Basic<TestComposite>& c) { c.init(); })},
+        {"CHB", factory<CHB<TestComposite>>(nullptr)},
+        {"Booty", factory<FrequencyShifter<TestComposite>>([](FrequencyShifter<TestComposite>& c) {
+             c.setSampleRate(c.engineGetSampleRate());
+             c.init();
+         })},
+        {"Compressor2", factory<Compressor2<TestComposite>>(
+                            [](Compressor2<TestComposite>& c) { c.init(); },
+                            [](Compressor2<TestComposite>& c, const std::string&) {
+                                // The panel only edits the current channel. Run once so it knows
+                                // which one that is, then copy it to the others.
+                                c.process(TestComposite::ProcessArgs());
+                                c.ui_setAllChannelsToCurrent();
+                                return true;
+                            })},
+        {"Mix4", factory<Mix4<TestComposite>>([](Mix4<TestComposite>& c) { c.init(); })},
+        {"Mix8", factory<Mix8<TestComposite>>([](Mix8<TestComposite>& c) { c.init(); })},
+        {"MixStereo", factory<MixStereo<TestComposite>>([](MixStereo<TestComposite>& c) { c.init(); })},
+    };
+    return factories;
+}
+
+std::vector<std::string> PatchRenderer::getModuleTypes()
+{
+    std::vector<std::string> ret;
+    for (auto it : getFactories()) {
+        ret.push_back(it.first);
+    }
+    return ret;
+}
+
+PatchRenderer::PatchRenderer()
+{
+}
+
+PatchRenderer::~PatchRenderer()
+{
+}
+
+bool PatchRenderer::parseFile(const std::string& path)
+{
+    std::ifstream stream(path);
+    if (!stream.good()) {
+        printf("can't open patch %s\n", path.c_str());
+        return false;
+    }
+    return parse(stream);
+}
+
+bool PatchRenderer::parse(std::istream& stream)
+{
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(stream, line)) {
+        ++lineNumber;
+        if (!parseLine(line, lineNumber)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int PatchRenderer::findModule(const std::string& name) const
+{
+    for (int i = 0; i < int(modules.size()); ++i) {
+        if (modules[i].name == name) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+bool PatchRenderer::parseLine(const std::string& rawLine, int lineNumber)
+{
+    const std::string line = rawLine.substr(0, rawLine.find('#'));
+
+    // Patch files always use '.', whatever the test program set the locale to.
+    std::istringstream words(line);
+    words.imbue(std::locale::classic());
+
+    std::string command;
+    if (!(words >> command)) {
+        return true;  // blank line
+    }
+
+    auto error = [lineNumber, &rawLine](const char* msg) {
+        printf("patch line %d: %s\n  %s\n", lineNumber, msg, rawLine.c_str());
+        return false;
+    };
+
+    auto readModule = [this, &words](int& index) {
+        std::string name;
+        words >> name;
+        index = findModule(name);
+        return index >= 0;
+    };
+
+    if (command == "samplerate") {
+        if (!(words >> sampleRate) || sampleRate <= 0) {
+            return error("bad sample rate");
+        }
+    } else if (command == "seconds") {
+        if (!(words >> seconds) || seconds <= 0) {
+            return error("bad duration");
+        }
+    } else if (command == "module") {
+        Module module;
+        if (!(words >> module.name >> module.type)) {
+            return error("module needs a name and a type");
+        }
+        if (findModule(module.name) >= 0) {
+            return error("module name already used");
+        }
+        if (getFactories().find(module.type) == getFactories().end()) {
+            return error("unknown module type");
+        }
+        modules.push_back(module);
+    } else if (command == "param") {
+        int index;
+        std::pair<int, float> param;
+        if (!readModule(index)) {
+            return error("unknown module");
+        }
+        if (!(words >> param.first >> param.second)) {
+            return error("param needs an id and a value");
+        }
+        modules[index].params.push_back(param);
+    } else if (command == "voltage") {
+        int index;
+        Voltage voltage;
+        if (!readModule(index)) {
+            return error("unknown module");
+        }
+        if (!(words >> voltage.input >> voltage.channels >> voltage.volts) ||
+            voltage.channels < 1 || voltage.channels > 16) {
+            return error("voltage needs an input id, 1..16 channels, and volts");
+        }
+        modules[index].voltages.push_back(voltage);
+    } else if (command == "sfz") {
+        int index;
+        if (!readModule(index)) {
+            return error("unknown module");
+        }
+        if (modules[index].type != "Samp") {
+            return error("only Samp takes an sfz");
+        }
+        std::getline(words >> std::ws, modules[index].sfzPath);
+    } else if (command == "cable") {
+        Cable cable;
+        if (!readModule(cable.fromModule) || !(words >> cable.output) ||
+            !readModule(cable.toModule) || !(words >> cable.input)) {
+            return error("cable needs <from> <output id> <to> <input id>");
+        }
+        cables.push_back(cable);
+    } else if (command == "output") {
+        Tap tap;
+        if (!readModule(tap.module) || !(words >> tap.output)) {
+            return error("output needs a module and an output id");
+        }
+        if (taps.size() >= 2) {
+            return error("only stereo output is supported");
+        }
+        taps.push_back(tap);
+    } else {
+        return error("unknown command");
+    }
+    return true;
+}
+
+bool PatchRenderer::makeModules()
+{
+    auto badPort = [](const char* what, const Module& module, int id) {
+        printf("%s %d is out of range for %s (%s)\n", what, id, module.name.c_str(), module.type.c_str());
+        return false;
+    };
+
+    for (auto& module : modules) {
+        module.module = getFactories().at(module.type)();
+        module.module->init(sampleRate);
+        TestComposite& comp = module.module->composite();
+        for (auto param : module.params) {
+            if (param.first < 0 || param.first >= module.module->getNumParams()) {
+                return badPort("param", module, param.first);
+            }
+            comp.params[param.first].value = param.second;
+        }
+        for (auto voltage : module.voltages) {
+            if (voltage.input < 0 || voltage.input >= module.module->getNumInputs()) {
+                return badPort("input", module, voltage.input);
+            }
+            auto& input = comp.inputs[voltage.input];
+            input.channels = voltage.channels;
+            for (int i = 0; i < voltage.channels; ++i) {
+                input.setVoltage(voltage.volts, i);
+            }
+        }
+    }
+
+    for (auto cable : cables) {
+        if (cable.output < 0 || cable.output >= modules[cable.fromModule].module->getNumOutputs()) {
+            return badPort("output", modules[cable.fromModule], cable.output);
+        }
+        if (cable.input < 0 || cable.input >= modules[cable.toModule].module->getNumInputs()) {
+            return badPort("input", modules[cable.toModule], cable.input);
+        }
+        // In TestComposite an output with no channels is not connected, and won't change.
+        modules[cable.fromModule].module->composite().outputs[cable.output].channels = 1;
+        modules[cable.toModule].module->composite().inputs[cable.input].channels = 1;
+    }
+    for (auto tap : taps) {
+        if (tap.output < 0 || tap.output >= modules[tap.module].module->getNumOutputs()) {
+            return badPort("output", modules[tap.module], tap.output);
+        }
+        modules[tap.module].module->composite().outputs[tap.output].channels = 1;
+    }
+
+    for (auto& module : modules) {
+        if (!module.module->start(module.sfzPath)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void PatchRenderer::propagateCables()
+{
+    for (auto cable : cables) {
+        auto& output = modules[cable.fromModule].module->composite().outputs[cable.output];
+        auto& input = modules[cable.toModule].module->composite().inputs[cable.input];
+        const int channels = output.channels;
+        input.channels = channels;
+        for (int i = 0; i < channels; ++i) {
+            input.setVoltage(output.getVoltage(i), i);
+        }
+    }
+}
+
+bool PatchRenderer::render(const std::string& wavPath)
+{
+    if (modules.empty()) {
+        printf("patch has no modules\n");
+        return false;
+    }
+    if (!makeModules()) {
+        return false;
+    }
+
+    using Clock = std::chrono::steady_clock;
+
+    // Reading the clock isn't free, so measure it and take it out of each module's time.
+    double clockOverheadNs = 0;
+    {
+        const int reads = 100000;
+        auto begin = Clock::now();
+        auto t = begin;
+        for (int i = 0; i < reads; ++i) {
+            t = Clock::now();
+        }
+        clockOverheadNs = std::chrono::duration<double, std::nano>(t - begin).count() / reads;
+    }
+
+    TestComposite::ProcessArgs args;
+    args.sampleRate = sampleRate;
+    args.sampleTime = 1.f / sampleRate;
+
+    const int numSamples = int(seconds * sampleRate);
+    const int numChannels = int(taps.size());
+    audio.clear();
+    audio.reserve(size_t(numSamples) * numChannels);
+    for (auto& module : modules) {
+        module.elapsedNs = 0;
+    }
+
+    const auto renderStart = Clock::now();
+    for (int sample = 0; sample < numSamples; ++sample) {
+        auto t0 = Clock::now();
+        for (auto& module : modules) {
+            module.module->process(args);
+            const auto t1 = Clock::now();
+            module.elapsedNs += std::chrono::duration<double, std::nano>(t1 - t0).count() - clockOverheadNs;
+            t0 = t1;
+        }
+        propagateCables();
+
+        for (auto tap : taps) {
+            auto& output = modules[tap.module].module->composite().outputs[tap.output];
+            float sum = 0;
+            for (int i = 0; i < output.channels; ++i) {
+                sum += output.getVoltage(i);
+            }
+            audio.push_back(sum / 10.f);
+        }
+    }
+    const double renderNs = std::chrono::duration<double, std::nano>(Clock::now() - renderStart).count();
+
+    numSamplesRendered = numSamples;
+    totalNsPerSample = numSamples ? renderNs / numSamples : 0;
+
+    if (!wavPath.empty() && numChannels) {
+        if (!SqWaveFile::save(wavPath, audio, numChannels, int(sampleRate))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<PatchRenderer::ModuleStats> PatchRenderer::getStats() const
+{
+    std::vector<ModuleStats> ret;
+    for (auto& module : modules) {
+        ModuleStats stats;
+        stats.name = module.name;
+        stats.type = module.type;
+        stats.nsPerSample = numSamplesRendered ? module.elapsedNs / numSamplesRendered : 0;
+        ret.push_back(stats);
+    }
+    return ret;
+}
+
+void PatchRenderer::printReport() const
+{
+    // the time we have for each sample, in ns
+    const double budget = 1e9 / sampleRate;
+    printf("rendered %d samples at %.0f\n", numSamplesRendered, sampleRate);
+    for (auto stats : getStats()) {
+        printf("  %-16s %-12s %10.1f ns/sample %6.2f%%\n",
+               stats.name.c_str(), stats.type.c_str(), stats.nsPerSample, 100 * stats.nsPerSample / budget);
+    }
+    printf("  %-29s %10.1f ns/sample %6.2f%%\n", "total", totalNsPerSample, 100 * totalNsPerSample / budget);
+}
+
+int renderPatch(int argc, char** argv)
+{
+    if (argc < 2) {
+        printf("usage: render.exe <patch file> [<wav file>]\n");
+        printf("module types:");
+        for (auto type : PatchRenderer::getModuleTypes()) {
+            printf(" %s", type.c_str());
+        }
+        printf("\n");
+        return 1;
+    }
+
+    PatchRenderer renderer;
+    if (!renderer.parseFile(argv[1])) {
+        return 1;
+    }
+    const std::string wavPath = argc > 2 ? argv[2] : "";
+    if (!renderer.render(wavPath)) {
+        return 1;
+    }
+    renderer.printReport();
+    return 0;
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+class RenderModule;
+using RenderModulePtr = std::shared_ptr<RenderModule>;
+
+/**
+ * Renders a whole "patch" of composites offline, using TestComposite in place of VCV.
+ * Used to see how a realistic mix of modules performs, where each one's
+ * data may get pushed out of the cache by the others.
+ *
+ * Like VCV, every module is processed once per sample, in the order they were
+ * declared, and then all the cables are copied. So every cable has one sample of delay.
+ *
+ * The patch is a text file, with one command per line. # starts a comment.
+ *
+ *      samplerate <rate>                           default 44100
+ *      seconds <seconds>                           default 10
+ *      module <name> <type>                        type is one of getModuleTypes()
+ *      param <name> <param id> <value>
+ *      voltage <name> <input id> <channels> <volts>    constant voltage on all channels
+ *      sfz <name> <path>                           only for Samp. Otherwise Samp plays a test patch
+ *      cable <from name> <output id> <to name> <input id>
+ *      output <name> <output id>                   first one is the left channel of the wav, second is right
+ *
+ * Port and param ids are the numbers from the composite's enums.
+ * All the channels of a polyphonic output are summed into the wav, and 10V is full scale.
+ */
+class PatchRenderer
+{
+public:
+    PatchRenderer();
+    ~PatchRenderer();
+
+    /**
+     * Each of these prints a message and returns false on error.
+     */
+    bool parse(std::istream&);
+    bool parseFile(const std::string& path);
+
+    /**
+     * Runs the patch for the requested number of seconds.
+     * @param wavPath is where to save the audio. If empty, it isn't saved.
+     */
+    bool render(const std::string& wavPath);
+
+    /**
+     * prints the time spent in each module
+     */
+    void printReport() const;
+
+    class ModuleStats
+    {
+    public:
+        std::string name;
+        std::string type;
+        double nsPerSample = 0;
+    };
+
+    std::vector<ModuleStats> getStats() const;
+
+    /**
+     * The whole render, including the cables, in ns per sample.
+     */
+    double getTotalNsPerSample() const
+    {
+        return totalNsPerSample;
+    }
+
+    float getSampleRate() const
+    {
+        return sampleRate;
+    }
+
+    /**
+     * The rendered audio, interleaved if there are two outputs.
+     */
+    const std::vector<float>& getAudio() const
+    {
+        return audio;
+    }
+
+    static std::vector<std::string> getModuleTypes();
+
+private:
+    class Voltage
+    {
+    public:
+        int input;
+        int channels;
+        float volts;
+    };
+
+    /**
+     * Everything the patch file says about one module.
+     * The composite itself isn't made until we render, so it can
+     * be initialized at the final sample rate.
+     */
+    class Module
+    {
+    public:
+        std::string name;
+        std::string type;
+        std::vector<std::pair<int, float>> params;
+        std::vector<Voltage> voltages;
+        std::string sfzPath;
+
+        RenderModulePtr module;
+        double elapsedNs = 0;
+    };
+
+    class Cable
+    {
+    public:
+        int fromModule;
+        int output;
+        int toModule;
+        int input;
+    };
+
+    class Tap
+    {
+    public:
+        int module;
+        int output;
+    };
+
+    float sampleRate = 44100;
+    double seconds = 10;
+
+    std::vector<Module> modules;
+    std::vector<Cable> cables;
+    std::vector<Tap> taps;
+    std::vector<float> audio;
+
+    int numSamplesRendered = 0;
+    double totalNsPerSample = 0;
+
+    bool parseLine(const std::string& line, int lineNumber);
+    int findModule(const std::string& name) const;
+    bool makeModules();
+    void propagateCables();
+};
@@ -0,0 +1,209 @@
+#include "PerfCounters.h"
+
+#include <stdio.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/**
+ * Opens the first counter of a group (groupFd = -1) disabled, and the
+ * rest to follow the first one.
+ */
+static int openCounter(uint32_t type, uint64_t config, int groupFd)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = (groupFd < 0) ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    // if there are more counters than the CPU has, the kernel will take turns,
+    // and the times tell us how to scale up the counts.
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    // this thread, on any cpu
+    return int(syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, 0));
+}
+
+static const uint64_t l1dReadMiss = PERF_COUNT_HW_CACHE_L1D |
+                                    (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+#endif
+
+PerfCounters::PerfCounters()
+{
+    for (int i = 0; i < NUM_COUNTERS; ++i) {
+        fds[i] = -1;
+    }
+}
+
+PerfCounters::~PerfCounters()
+{
+    close();
+}
+
+bool PerfCounters::open()
+{
+    close();
+#ifdef __linux__
+    openInGroup(0, CYCLES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    openInGroup(0, INSTRUCTIONS, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    openInGroup(1, L1D_MISSES, PERF_TYPE_HW_CACHE, l1dReadMiss);
+    openInGroup(1, LLC_MISSES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+    openInGroup(1, BRANCH_MISSES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+    available = (fds[CYCLES] >= 0) && (fds[INSTRUCTIONS] >= 0);
+    if (!available) {
+        close();
+    }
+#endif
+    return available;
+}
+
+void PerfCounters::openInGroup(int group, Counter counter, uint32_t type, uint64_t config)
+{
+#ifdef __linux__
+    Group& g = groups[group];
+    const int fd = openCounter(type, config, g.leader);
+    if (fd < 0) {
+        return;
+    }
+    fds[counter] = fd;
+    if (g.leader < 0) {
+        g.leader = fd;
+    }
+    g.members[g.size++] = counter;
+#endif
+}
+
+bool PerfCounters::readGroup(const Group& g, uint64_t& enabled, uint64_t& running, uint64_t* values) const
+{
+#ifdef __linux__
+    uint64_t data[3 + NUM_COUNTERS];       // number of counters, time enabled, time running, values
+    const ssize_t size = ssize_t(sizeof(uint64_t) * (3 + g.size));
+    if (g.leader < 0 || read(g.leader, data, sizeof(data)) != size || data[0] != uint64_t(g.size)) {
+        return false;
+    }
+    enabled = data[1];
+    running = data[2];
+    for (int i = 0; i < g.size; ++i) {
+        values[i] = data[3 + i];
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+void PerfCounters::close()
+{
+#ifdef __linux__
+    for (int i = 0; i < NUM_COUNTERS; ++i) {
+        if (fds[i] >= 0) {
+            ::close(fds[i]);
+        }
+        fds[i] = -1;
+    }
+#endif
+    for (Group& g : groups) {
+        g = Group();
+    }
+    available = false;
+}
+
+void PerfCounters::start()
+{
+#ifdef __linux__
+    // Reset doesn't reset the times, so remember where they started.
+    for (Group& g : groups) {
+        if (g.leader >= 0) {
+            ioctl(g.leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            uint64_t values[NUM_COUNTERS];
+            if (!readGroup(g, g.startEnabled, g.startRunning, values)) {
+                g.startEnabled = g.startRunning = 0;
+            }
+        }
+    }
+    for (Group& g : groups) {
+        if (g.leader >= 0) {
+            ioctl(g.leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+    }
+#endif
+}
+
+void PerfCounters::stop()
+{
+#ifdef __linux__
+    for (Group& g : groups) {
+        if (g.leader >= 0) {
+            ioctl(g.leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        }
+    }
+    for (Group& g : groups) {
+        uint64_t enabled = 0;
+        uint64_t running = 0;
+        uint64_t values[NUM_COUNTERS];
+        if (!readGroup(g, enabled, running, values) || running <= g.startRunning) {
+            continue;
+        }
+        const double scale = double(enabled - g.startEnabled) / double(running - g.startRunning);
+        for (int i = 0; i < g.size; ++i) {
+            total.values[g.members[i]] += uint64_t(values[i] * scale);
+        }
+    }
+#endif
+}
+
+void PerfCounters::clear()
+{
+    total = Counts();
+}
+
+const char* PerfCounters::getName(Counter counter)
+{
+    switch (counter) {
+        case CYCLES:
+            return "cycles";
+        case INSTRUCTIONS:
+            return "instructions";
+        case L1D_MISSES:
+            return "L1D misses";
+        case LLC_MISSES:
+            return "LLC misses";
+        case BRANCH_MISSES:
+            return "branch misses";
+        default:
+            return "";
+    }
+}
+
+static bool enabled = false;
+
+PerfCounters& PerfCounters::get()
+{
+    static PerfCounters counters;
+    return counters;
+}
+
+void PerfCounters::enable()
+{
+    if (enabled) {
+        return;
+    }
+    enabled = true;
+    if (!get().open()) {
+        printf("hardware performance counters not available, only measuring time\n");
+    }
+}
+
+bool PerfCounters::isEnabled()
+{
+    return enabled && get().isAvailable();
+}
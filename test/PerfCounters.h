@@ -0,0 +1,103 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Reads the CPU's hardware performance counters for the current thread,
+ * so a perf test can tell a slowdown from cache misses apart from one from
+ * mispredicted branches.
+ *
+ * Only on Linux, using perf_event_open. It won't be available in many
+ * places (other OSes, VMs, or kernel.perf_event_paranoid too high),
+ * in which case isAvailable() is false and the counts are all zero.
+ * Any one counter the CPU doesn't have will just read zero.
+ *
+ * Cycles and instructions are opened as one group, and the cache and branch
+ * counters as another, so each group is counted over exactly the same time.
+ * If the CPU has to take turns with the groups, each one is scaled up by how
+ * much of its trial it was actually counting.
+ *
+ * perf.exe turns these on with --counters.
+ */
+class PerfCounters
+{
+public:
+    enum Counter {
+        CYCLES,
+        INSTRUCTIONS,
+        L1D_MISSES,
+        LLC_MISSES,
+        BRANCH_MISSES,
+        NUM_COUNTERS
+    };
+
+    class Counts
+    {
+    public:
+        uint64_t values[NUM_COUNTERS] = {0};
+    };
+
+    PerfCounters();
+    ~PerfCounters();
+
+    /**
+     * Tries to open the counters. Returns false if we can't get cycles and instructions.
+     */
+    bool open();
+    bool isAvailable() const
+    {
+        return available;
+    }
+
+    /**
+     * Counts from start to stop are added to the total.
+     */
+    void start();
+    void stop();
+
+    void clear();
+    const Counts& getTotal() const
+    {
+        return total;
+    }
+
+    static const char* getName(Counter);
+
+    /**
+     * The one that MeasureTime uses. Is only opened if enabled.
+     */
+    static PerfCounters& get();
+    static void enable();
+    static bool isEnabled();
+
+    PerfCounters(const PerfCounters&) = delete;
+    const PerfCounters& operator=(const PerfCounters&) = delete;
+
+private:
+    class Group
+    {
+    public:
+        int leader = -1;
+        int size = 0;
+        Counter members[NUM_COUNTERS];      // in the order they were opened
+
+        // from the last start()
+        uint64_t startEnabled = 0;
+        uint64_t startRunning = 0;
+    };
+    static const int NUM_GROUPS = 2;
+
+    int fds[NUM_COUNTERS];
+    Group groups[NUM_GROUPS];
+    bool available = false;
+    Counts total;
+
+    void close();
+    void openInGroup(int group, Counter, uint32_t type, uint64_t config);
+
+    /**
+     * Reads the times the group has been enabled and running (which only ever go up),
+     * and the count of each member since start().
+     */
+    bool readGroup(const Group&, uint64_t& enabled, uint64_t& running, uint64_t* values) const;
+};
@@ -0,0 +1,278 @@
+#include "PerfResults.h"
+
+#include <assert.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <fstream>
+#include <locale>
+#include <map>
+#include <set>
+#include <sstream>
+
+static std::vector<PerfResults::Result> results;
+static int numTrials = 25;
+static int numColdInstances = 64;
+
+double PerfResults::percentile(const std::vector<double>& sorted, double fraction)
+{
+    assert(!sorted.empty());
+    const double position = fraction * (sorted.size() - 1);
+    const size_t index = size_t(position);
+    if (index + 1 >= sorted.size()) {
+        return sorted.back();
+    }
+    const double t = position - index;
+    return sorted[index] * (1 - t) + sorted[index + 1] * t;
+}
+
+PerfResults::Result PerfResults::summarize(const std::string& name, int64_t iterations, std::vector<double> nsPerSample)
+{
+    std::sort(nsPerSample.begin(), nsPerSample.end());
+    Result ret;
+    ret.name = name;
+    ret.iterations = iterations;
+    ret.trials = int(nsPerSample.size());
+    ret.median = percentile(nsPerSample, .5);
+    ret.p95 = percentile(nsPerSample, .95);
+    ret.p99 = percentile(nsPerSample, .99);
+    ret.best = nsPerSample.front();
+    return ret;
+}
+
+void PerfResults::addCounters(Result& result, const PerfCounters::Counts& counts, int64_t numSamples)
+{
+    assert(numSamples > 0);
+    result.hasCounters = true;
+    for (int i = 0; i < PerfCounters::NUM_COUNTERS; ++i) {
+        result.perSample[i] = double(counts.values[i]) / numSamples;
+    }
+    const double cycles = double(counts.values[PerfCounters::CYCLES]);
+    result.ipc = cycles > 0 ? counts.values[PerfCounters::INSTRUCTIONS] / cycles : 0;
+}
+
+void PerfResults::add(const Result& result)
+{
+    results.push_back(result);
+}
+
+const std::vector<PerfResults::Result>& PerfResults::get()
+{
+    return results;
+}
+
+void PerfResults::clear()
+{
+    results.clear();
+}
+
+void PerfResults::setTrials(int trials)
+{
+    assert(trials > 0);
+    numTrials = trials;
+}
+
+int PerfResults::getTrials()
+{
+    return numTrials;
+}
+
+void PerfResults::setColdInstances(int instances)
+{
+    assert(instances > 0);
+    numColdInstances = instances;
+}
+
+int PerfResults::getColdInstances()
+{
+    return numColdInstances;
+}
+
+std::string PerfResults::getBuildDescription()
+{
+    std::string ret;
+#if defined(__clang__)
+    ret += "clang " __clang_version__;
+#elif defined(__GNUC__)
+    ret += "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    ret += "msvc " + std::to_string(_MSC_VER);
+#endif
+#ifdef __OPTIMIZE__
+    ret += " optimized";
+#endif
+#ifdef NDEBUG
+    ret += " NDEBUG";
+#endif
+#ifdef __FAST_MATH__
+    ret += " fast-math";
+#endif
+#ifdef __SSE4_2__
+    ret += " sse4.2";
+#endif
+#ifdef __AVX__
+    ret += " avx";
+#endif
+#ifdef __AVX2__
+    ret += " avx2";
+#endif
+#ifdef __FMA__
+    ret += " fma";
+#endif
+    return ret;
+}
+
+static std::string quote(const std::string& s)
+{
+    std::string ret = "\"";
+    for (char c : s) {
+        if (c == '"' || c == '\\') {
+            ret += '\\';
+        }
+        ret += c;
+    }
+    return ret + "\"";
+}
+
+/**
+ * Results and baselines are matched up by name, so every name must be different.
+ * Prints the first name that isn't.
+ */
+static bool namesAreUnique()
+{
+    std::set<std::string> names;
+    for (const PerfResults::Result& r : results) {
+        if (!names.insert(r.name).second) {
+            printf("duplicate benchmark name: %s\n", r.name.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Each benchmark goes on one line, which keeps readBaseline simple.
+ * The stream is always in the "C" locale: the test program sets one that
+ * uses ',' for the decimal point, and that isn't JSON.
+ */
+bool PerfResults::writeJson(const std::string& path)
+{
+    if (!namesAreUnique()) {
+        return false;
+    }
+    std::ofstream out(path);
+    if (!out.good()) {
+        printf("can't write %s\n", path.c_str());
+        return false;
+    }
+    out.imbue(std::locale::classic());
+    out << "{\n";
+    out << "  \"build\": " << quote(getBuildDescription()) << ",\n";
+    out << "  \"trials\": " << numTrials << ",\n";
+    out << "  \"coldInstances\": " << numColdInstances << ",\n";
+    out << "  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        out << "    {\"name\": " << quote(r.name)
+            << ", \"iterations\": " << r.iterations
+            << ", \"trials\": " << r.trials
+            << ", \"median\": " << r.median
+            << ", \"p95\": " << r.p95
+            << ", \"p99\": " << r.p99
+            << ", \"best\": " << r.best;
+        if (r.hasCounters) {
+            out << ", \"ipc\": " << r.ipc;
+            for (int c = 0; c < PerfCounters::NUM_COUNTERS; ++c) {
+                out << ", " << quote(PerfCounters::getName(PerfCounters::Counter(c))) << ": " << r.perSample[c];
+            }
+        }
+        out << "}";
+        out << ((i + 1 < results.size()) ? ",\n" : "\n");
+    }
+    out << "  ]\n";
+    out << "}\n";
+    return out.good();
+}
+
+/**
+ * Only reads what writeJson writes: finds the name and median on each benchmark line.
+ * A file with no benchmarks in it is an error, it's not something writeJson made.
+ */
+static bool readBaseline(const std::string& path, std::map<std::string, double>& medians)
+{
+    std::ifstream in(path);
+    if (!in.good()) {
+        return false;
+    }
+    const std::string nameKey = "{\"name\": \"";
+    const std::string medianKey = "\"median\": ";
+    std::string line;
+    while (std::getline(in, line)) {
+        const auto namePos = line.find(nameKey);
+        const auto medianPos = line.find(medianKey);
+        if (namePos == std::string::npos || medianPos == std::string::npos) {
+            continue;
+        }
+        std::string name;
+        for (size_t i = namePos + nameKey.size(); i < line.size() && line[i] != '"'; ++i) {
+            if (line[i] == '\\' && i + 1 < line.size()) {
+                ++i;
+            }
+            name += line[i];
+        }
+        std::istringstream number(line.substr(medianPos + medianKey.size()));
+        number.imbue(std::locale::classic());
+        double median = 0;
+        if (number >> median) {
+            if (!medians.insert(std::make_pair(name, median)).second) {
+                printf("duplicate benchmark name in baseline: %s\n", name.c_str());
+                return false;
+            }
+        }
+    }
+    return !medians.empty();
+}
+
+int PerfResults::compareToBaseline(const std::string& path, double tolerance)
+{
+    if (!namesAreUnique()) {
+        return -1;
+    }
+    std::map<std::string, double> baseline;
+    if (!readBaseline(path, baseline)) {
+        printf("can't read baseline %s\n", path.c_str());
+        return -1;
+    }
+
+    int regressions = 0;
+    int compared = 0;
+    for (const Result& r : results) {
+        auto it = baseline.find(r.name);
+        if (it == baseline.end()) {
+            printf("not in baseline: %s\n", r.name.c_str());
+            continue;
+        }
+        ++compared;
+        // what's left in baseline at the end didn't get run
+        const double baselineMedian = it->second;
+        baseline.erase(it);
+        const double limit = baselineMedian * (1 + tolerance / 100);
+        // things that take almost no time are all noise.
+        if (r.median > limit && r.median - baselineMedian > 1) {
+            printf("REGRESSION: %s median %f ns, baseline %f ns (+%.1f%%)\n",
+                   r.name.c_str(), r.median, baselineMedian, 100 * (r.median / baselineMedian - 1));
+            ++regressions;
+        }
+    }
+    // a benchmark that went away can't be checked, so it can't pass
+    for (const auto& missing : baseline) {
+        printf("MISSING: %s is in the baseline, but was not run\n", missing.first.c_str());
+    }
+    printf("compared %d benchmarks to %s with %.1f%% tolerance: %d regressions, %d missing\n",
+           compared, path.c_str(), tolerance, regressions, int(baseline.size()));
+    if (compared == 0) {
+        printf("nothing was compared to the baseline\n");
+        return -1;
+    }
+    return regressions + int(baseline.size());
+}
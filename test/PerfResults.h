@@ -0,0 +1,101 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "PerfCounters.h"
+
+/**
+ * Collects the results of every MeasureTime::run, so perf.exe can
+ * save them as JSON and compare them to a baseline from an earlier run.
+ *
+ * Each benchmark is run as a number of equal trials, and we keep the spread of
+ * the trials, not just the average. The median is what we compare, since
+ * it is the least bothered by the OS taking the CPU away now and then.
+ *
+ * perf.exe options:
+ *      --trials <n>            trials per benchmark (default 25)
+ *      --json <path>           save the results
+ *      --baseline <path>       compare to results saved earlier with --json
+ *      --tolerance <percent>   how much slower than the baseline is a regression (default 10)
+ *      --cold <n>              instances for the cold benchmarks (default 64)
+ *      --counters              also read the hardware performance counters, see PerfCounters.h
+ *
+ * Timings are only comparable from the same machine and build, so make the
+ * baseline on the machine that will be checking against it.
+ */
+class PerfResults
+{
+public:
+    class Result
+    {
+    public:
+        std::string name;
+        int64_t iterations = 0;     // per trial
+        int trials = 0;
+        double median = 0;          // all times in ns per sample, less the overhead
+        double p95 = 0;
+        double p99 = 0;
+        double best = 0;
+
+        /**
+         * From the hardware counters, if we have them. Per sample, averaged over all the trials.
+         * Unlike the times, these include the overhead.
+         */
+        bool hasCounters = false;
+        double perSample[PerfCounters::NUM_COUNTERS] = {0};
+        double ipc = 0;
+    };
+
+    /**
+     * Makes a Result from the time of each trial.
+     */
+    static Result summarize(const std::string& name, int64_t iterations, std::vector<double> nsPerSample);
+
+    /**
+     * Adds the counts from a run of numSamples to result.
+     */
+    static void addCounters(Result& result, const PerfCounters::Counts&, int64_t numSamples);
+
+    static void add(const Result&);
+    static const std::vector<Result>& get();
+    static void clear();
+
+    static void setTrials(int);
+    static int getTrials();
+
+    /**
+     * How many objects MeasureTime::runHotAndCold round robins through.
+     */
+    static void setColdInstances(int);
+    static int getColdInstances();
+
+    /**
+     * returns false on error, including two results with the same name.
+     */
+    static bool writeJson(const std::string& path);
+
+    /**
+     * Prints every benchmark that is slower than the one in the baseline,
+     * and every one in the baseline that wasn't run this time.
+     * @param tolerance is in percent.
+     * @returns number of regressions plus the number missing from this run,
+     *      or -1 if the baseline can't be read, has no benchmarks, has nothing
+     *      in common with this run, or if either one has two benchmarks with the same name.
+     */
+    static int compareToBaseline(const std::string& path, double tolerance);
+
+    /**
+     * compiler, and the build options that matter for speed.
+     */
+    static std::string getBuildDescription();
+
+    /**
+     * Linearly interpolated, so it's reasonable for small numbers of trials.
+     * @param sorted must be sorted, and not empty.
+     * @param fraction is 0..1 (.95 for the 95th percentile).
+     */
+    static double percentile(const std::vector<double>& sorted, double fraction);
+};
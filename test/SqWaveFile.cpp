@@ -51,3 +51,29 @@ bool SqWaveFile::load(const std::string& path)
      }
      return load(name);
  }
+
+bool SqWaveFile::save(const std::string& path, const std::vector<float>& data, int numChannels, int sampleRate)
+{
+    assert(numChannels > 0);
+    drwav_data_format format;
+    format.container = drwav_container_riff;
+    format.format = DR_WAVE_FORMAT_IEEE_FLOAT;
+    format.channels = numChannels;
+    format.sampleRate = sampleRate;
+    format.bitsPerSample = 32;
+
+    drwav wav;
+    if (!drwav_init_file_write(&wav, path.c_str(), &format, NULL)) {
+        printf("can't open %s for writing\n", path.c_str());
+        return false;
+    }
+
+    const drwav_uint64 frames = data.size() / numChannels;
+    const drwav_uint64 framesWritten = drwav_write_pcm_frames(&wav, frames, data.data());
+    drwav_uninit(&wav);
+    if (framesWritten != frames) {
+        printf("error writing %s\n", path.c_str());
+        return false;
+    }
+    return true;
+}
@@ -21,6 +21,12 @@ public:
     {
         return (int) data.size();
     }
+
+    /**
+     * Writes a 32 bit float wave file.
+     * @param data is interleaved if numChannels > 1.
+     */
+    static bool save(const std::string& path, const std::vector<float>& data, int numChannels, int sampleRate);
 private:
     std::vector<float> data;
     //class Impl;
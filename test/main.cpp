@@ -5,9 +5,14 @@
 #include <assert.h>
 #include <stdio.h>
 
+#include <algorithm>
 #include <locale>
+#include <sstream>
 #include <string>
 
+#include "FixedTables.h"
+#include "PerfResults.h"
+
 extern void testMidiPlayer2();
 extern void testMidiPlayer4();
 extern void testBiquad();
@@ -22,10 +27,12 @@ extern void initPerf();
 extern void perfTest();
 extern void perfTest2();
 extern void perfTest3();
+extern int renderPatch(int argc, char** argv);
 extern void testFrequencyShifter();
 extern void testStateVariable();
 extern void testVocalAnimator();
 extern void testObjectCache();
+extern void testFixedTables();
 extern void testThread(bool exended);
 extern void testFFT();
 extern void testRingBuffer();
@@ -63,8 +70,12 @@ extern void testMidiEvents();
 extern void testMidiControllers();
 extern void testMultiLag();
 extern void testMultiLag2();
+extern void testMultiSmoother();
+extern void testCrossover4Band();
 extern void testUtils();
 extern void testIComposite();
+extern void testPatchRenderer();
+extern void testPerfResults();
 extern void testMidiEditor();
 extern void testMidiEditorNextPrev();
 extern void testNoteScreenScale();
@@ -134,6 +145,7 @@ extern void do_gc();
 extern void testxLex();
 extern void testGateDelay();
 extern void testRegionPrune();
+extern void testInstrumentCache();
 
 #if 0
 #include <iostream>
@@ -174,7 +186,23 @@ static void setupMem()
 }
 #endif
 
+/**
+ * command line numbers always use '.', whatever the locale.
+ * returns false if s isn't a number (with nothing after it).
+ */
+static bool parseNumber(const char* s, double& ret) {
+    std::istringstream stream(s);
+    stream.imbue(std::locale::classic());
+    ret = 0;
+    return (stream >> ret) && (stream >> std::ws).eof();
+}
+
 int main(int argc, char** argv) {
+#ifdef _RENDER
+    // render.exe only renders patches
+    return renderPatch(argc, argv);
+#endif
+
     // set up for a language that does not use . as a decimal point
     std::locale loc_it("it_IT");
     std::locale::global(loc_it);
@@ -188,17 +216,47 @@ int main(int argc, char** argv) {
     bool runPerf = false;
     bool extended = false;
     bool runShaperGen = false;
+    bool runFixedTablesGen = false;
     bool cq = false;
-    if (argc > 1) {
-        std::string arg = argv[1];
+    std::string perfJson;
+    std::string perfBaseline;
+    double perfTolerance = 10;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        const bool hasValue = (i + 1) < argc;
         if (arg == "--ext") {
             extended = true;
         } else if (arg == "--perf") {
             runPerf = true;
         } else if (arg == "--shaper") {
             runShaperGen = true;
+        } else if (arg == "--fixedTables") {
+            runFixedTablesGen = true;
         } else if (arg == "--calQ") {
             cq = true;
+        } else if (arg == "--json" || arg == "--baseline") {
+            // a perf run that was asked for these can't do without them.
+            if (!hasValue) {
+                printf("%s needs a file name\n", arg.c_str());
+                return 1;
+            }
+            (arg == "--json" ? perfJson : perfBaseline) = argv[++i];
+        } else if (arg == "--tolerance" || arg == "--trials" || arg == "--cold") {
+            double number = 0;
+            if (!hasValue || !parseNumber(argv[i + 1], number)) {
+                printf("%s needs a number\n", arg.c_str());
+                return 1;
+            }
+            ++i;
+            if (arg == "--tolerance") {
+                perfTolerance = number;
+            } else if (arg == "--trials") {
+                PerfResults::setTrials(std::max(1, int(number)));
+            } else {
+                PerfResults::setColdInstances(std::max(1, int(number)));
+            }
+        } else if (arg == "--counters") {
+            PerfCounters::enable();
         } else {
             printf("%s is not a valid command line argument\n", arg.c_str());
         }
@@ -220,6 +278,11 @@ int main(int argc, char** argv) {
         return 0;
     }
 
+    if (runFixedTablesGen) {
+        FixedTables::gen();
+        return 0;
+    }
+
     if (cq) {
         calQ();
         return 0;
@@ -231,6 +294,14 @@ int main(int argc, char** argv) {
         perfTest2();
 
         perfTest();
+
+        if (!perfJson.empty() && !PerfResults::writeJson(perfJson)) {
+            return 1;
+        }
+        if (!perfBaseline.empty()) {
+            // any regression, a missing benchmark, or a baseline we can't use fails the run
+            return PerfResults::compareToBaseline(perfBaseline, perfTolerance) == 0 ? 0 : 1;
+        }
         return 0;
     }
 
@@ -240,10 +311,14 @@ int main(int argc, char** argv) {
     testAudioMath();
     testCompCurves();
     testIComposite();
+    testPatchRenderer();
+    testPerfResults();
 
     // testTriggerSequencer();
     // mode these up where while we work...
     testMultiLag2();
+    testMultiSmoother();
+    testCrossover4Band();
     testCmprsr();
     testCompressorII();
     testCompressorParamHolder();
@@ -272,6 +347,7 @@ int main(int argc, char** argv) {
     testStreamer();
     testHeadingTracker();
     testRegionPrune();
+    testInstrumentCache();
     testSampComposite();
 
     testFlac();
@@ -343,6 +419,7 @@ int main(int argc, char** argv) {
     testManagedPool();
     testLookupTable();
     testObjectCache();
+    testFixedTables();
     testEditCommands4();
     testMultiLag();
     testSlew4();
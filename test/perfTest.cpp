@@ -256,6 +256,25 @@ static void testShifter()
         }, 1);
 }
 
+static void testShifter16()
+{
+    Shifter fs;
+
+    fs.setSampleRate(44100);
+    fs.init();
+    fs.inputs[Shifter::AUDIO_INPUT].channels = 16;
+
+    assert(overheadInOut >= 0);
+    MeasureTime<float>::run(overheadInOut, "shifter 16", [&fs]() {
+        const float x = TestBuffers<float>::get();
+        for (int i = 0; i < 16; ++i) {
+            fs.inputs[Shifter::AUDIO_INPUT].setVoltage(x, i);
+        }
+        fs.step();
+        return fs.outputs[Shifter::SIN_OUTPUT].getVoltage(15);
+        }, 1);
+}
+
 static void testAnimator()
 {
     Animator an;
@@ -591,6 +610,30 @@ static void testCHBdef()
         }, 1);
 }
 
+static void testCHB16()
+{
+    CHB<TestComposite> chb;
+    chb.inputs[CHB<TestComposite>::CV_INPUT].channels = 16;
+    chb.params[CHB<TestComposite>::PARAM_H3].value = .5;
+    std::string name = "chb 16 ";
+    MeasureTime<float>::run(overheadOutOnly, name.c_str(), [&chb]() {
+        chb.step();
+        return chb.outputs[CHB<TestComposite>::MIX_OUTPUT].getVoltage(0);
+        }, 1);
+}
+
+static void testCHB16Cold()
+{
+    using Comp = CHB<TestComposite>;
+    MeasureTime<float>::runHotAndCold<Comp>(overheadOutOnly, "chb 16", [](Comp& chb) {
+        chb.inputs[Comp::CV_INPUT].channels = 16;
+        chb.params[Comp::PARAM_H3].value = .5;
+        }, [](Comp& chb) {
+        chb.step();
+        return chb.outputs[Comp::MIX_OUTPUT].getVoltage(0);
+        }, 1);
+}
+
 #if 0
 static void testEV3()
 {
@@ -923,6 +966,17 @@ static void testSuper()
 }
 
 
+// Super has big arrays of saw state
+static void testSuperCold()
+{
+    using Comp = Super<TestComposite>;
+    MeasureTime<float>::runHotAndCold<Comp>(overheadOutOnly, "super", [](Comp&) {
+    }, [](Comp& super) {
+        super.step();
+        return super.outputs[Comp::MAIN_OUTPUT_LEFT].getVoltage(0);
+    }, 1);
+}
+
 static void testSuperPoly()
 {
     Super<TestComposite> super;
@@ -973,7 +1027,7 @@ static void testSuper2Stereo()
     super.params[Super<TestComposite>::CLEAN_PARAM].value = 1;
     super.inputs[Super<TestComposite>::MAIN_OUTPUT_LEFT].channels = 1;
     super.inputs[Super<TestComposite>::MAIN_OUTPUT_RIGHT].channels = 1;
-    MeasureTime<float>::run(overheadOutOnly, "super stereo", [&super]() {
+    MeasureTime<float>::run(overheadOutOnly, "super clean stereo", [&super]() {
         super.step();
         return super.outputs[Super<TestComposite>::MAIN_OUTPUT_LEFT].getVoltage(0) +
         super.outputs[Super<TestComposite>::MAIN_OUTPUT_RIGHT].getVoltage(0); 
@@ -1225,6 +1279,7 @@ void perfTest()
     testTremolo();
   
     testShifter();
+    testShifter16();
     testGMR();
 #endif
 #ifndef _MSC_VER
@@ -1239,6 +1294,7 @@ void perfTest()
     testOrgan4VCO();
     testOrgan12();
     testSuper();
+    testSuperCold();
     testSuperPoly();
     testWVCOPoly();
     testSubMono();
@@ -1265,6 +1321,8 @@ void perfTest()
 
 
     testCHBdef();
+    testCHB16();
+    testCHB16Cold();
 #if 0
     testShaper1b();
     testShaper1c();
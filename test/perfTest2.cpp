@@ -134,8 +134,13 @@ static void testNonUniform() {
             return NonUniformLookupTable<float>::lookup(*lookup, x);
         },
         1);
-    printf("Now abort");
-    abort();
+
+    MeasureTime<float>::run(
+        overheadInOut, "non-uniform float_4", [lookup]() {
+            float_4 x(TestBuffers<float>::get(), TestBuffers<float>::get(), TestBuffers<float>::get(), TestBuffers<float>::get());
+            return NonUniformLookupTable<float>::lookup(*lookup, x)[0];
+        },
+        1);
 }
 
 using Slewer = Slew4<TestComposite>;
@@ -207,6 +212,70 @@ static void testFilt2() {
         1);
 }
 
+// 16 channels, no CV patched and no knobs moving.
+// so the control rate path should have nothing to do.
+static void testFilt16Static() {
+    Filter fs;
+    fs.init();
+    fs.inputs[Filter::L_AUDIO_INPUT].channels = 16;
+    fs.outputs[Filter::L_AUDIO_OUTPUT].channels = 16;
+    fs.params[Filter::MASTER_VOLUME_PARAM].value = 1;
+    assert(overheadInOut >= 0);
+    MeasureTime<float>::run(
+        overheadInOut, "filt 16 static", [&fs]() {
+            const float x = TestBuffers<float>::get();
+            for (int i = 0; i < 16; ++i) {
+                fs.inputs[Filter::L_AUDIO_INPUT].setVoltage(x, i);
+            }
+            fs.step();
+            return fs.outputs[Filter::L_AUDIO_OUTPUT].getVoltage(0);
+        },
+        1);
+}
+
+// same, but with poly Fc CV that changes every sample.
+static void testFilt16Mod() {
+    Filter fs;
+    fs.init();
+    fs.inputs[Filter::L_AUDIO_INPUT].channels = 16;
+    fs.inputs[Filter::CV_INPUT1].channels = 16;
+    fs.outputs[Filter::L_AUDIO_OUTPUT].channels = 16;
+    fs.params[Filter::MASTER_VOLUME_PARAM].value = 1;
+    fs.params[Filter::FC1_TRIM_PARAM].value = 1;
+    assert(overheadInOut >= 0);
+    MeasureTime<float>::run(
+        overheadInOut, "filt 16 w/poly mod", [&fs]() {
+            const float x = TestBuffers<float>::get();
+            for (int i = 0; i < 16; ++i) {
+                fs.inputs[Filter::L_AUDIO_INPUT].setVoltage(x, i);
+                fs.inputs[Filter::CV_INPUT1].setVoltage(x, i);
+            }
+            fs.step();
+            return fs.outputs[Filter::L_AUDIO_OUTPUT].getVoltage(0);
+        },
+        1);
+}
+
+// The filters' state is big, so see how it does when it isn't in the cache.
+static void testFilt16Cold() {
+    MeasureTime<float>::runHotAndCold<Filter>(
+        overheadInOut, "filt 16 static", [](Filter& fs) {
+            fs.init();
+            fs.inputs[Filter::L_AUDIO_INPUT].channels = 16;
+            fs.outputs[Filter::L_AUDIO_OUTPUT].channels = 16;
+            fs.params[Filter::MASTER_VOLUME_PARAM].value = 1;
+        },
+        [](Filter& fs) {
+            const float x = TestBuffers<float>::get();
+            for (int i = 0; i < 16; ++i) {
+                fs.inputs[Filter::L_AUDIO_INPUT].setVoltage(x, i);
+            }
+            fs.step();
+            return fs.outputs[Filter::L_AUDIO_OUTPUT].getVoltage(0);
+        },
+        1);
+}
+
 using Mixer8 = Mix8<TestComposite>;
 static void testMix8() {
     Mixer8 fs;
@@ -225,6 +294,20 @@ static void testMix8() {
         1);
 }
 
+static void testMix8Cold() {
+    MeasureTime<float>::runHotAndCold<Mixer8>(
+        overheadInOut, "mix8", [](Mixer8& fs) {
+            fs.init();
+            fs.inputs[fs.AUDIO0_INPUT].setVoltage(0, 0);
+        },
+        [](Mixer8& fs) {
+            fs.inputs[Mixer8::AUDIO0_INPUT].setVoltage(TestBuffers<float>::get(), 0);
+            fs.step();
+            return fs.outputs[Mixer8::LEFT_OUTPUT].getVoltage(0);
+        },
+        1);
+}
+
 using Mixer4 = Mix4<TestComposite>;
 static void testMix4() {
     Mixer4 fs;
@@ -622,6 +705,33 @@ static void testComp2Knee16() {
         1);
 }
 
+static void testComp2Knee16Cold() {
+    using Comp = Compressor2<TestComposite>;
+    Comp::ProcessArgs args;
+    args.sampleTime = 1.f / 44100.f;
+    args.sampleRate = 44100;
+
+    MeasureTime<float>::runHotAndCold<Comp>(
+        overheadInOut, "Comp2 16 channel mono 4:1 soft", [](Comp& comp) {
+            comp.init();
+            initComposite(comp);
+            comp.inputs[Comp::LAUDIO_INPUT].channels = 16;
+            comp.inputs[Comp::LAUDIO_INPUT].setVoltage(0, 0);
+            comp.params[Comp::STEREO_PARAM].value = 0;
+            comp._initParamOnAllChannels(Comp::NOTBYPASS_PARAM, 1);
+            comp._initParamOnAllChannels(Comp::RATIO_PARAM, 3);
+            run(comp, 40);
+            comp.ui_setAllChannelsToCurrent();
+            run(comp, 41);
+        },
+        [args](Comp& comp) {
+            comp.inputs[Comp::LAUDIO_INPUT].setVoltage(TestBuffers<float>::get());
+            comp.process(args);
+            return comp.outputs[Comp::LAUDIO_OUTPUT].getVoltage(0);
+        },
+        1);
+}
+
 static void testComp2Knee16Linked() {
     using Comp = Compressor2<TestComposite>;
     Comp comp;
@@ -766,6 +876,33 @@ static void testCompKnee16Hard() {
         1);
 }
 
+static void testComp2MultiBand4() {
+    using Comp = Compressor2<TestComposite>;
+    Comp comp;
+
+    comp.init();
+    initComposite(comp);
+
+    comp.inputs[Comp::LAUDIO_INPUT].channels = 4;
+    comp.inputs[Comp::LAUDIO_INPUT].setVoltage(0, 0);
+    comp.params[Comp::MULTIBAND_PARAM].value = 1;
+    comp._initParamOnAllChannels(Comp::NOTBYPASS_PARAM, 1);
+    comp._initParamOnAllChannels(Comp::RATIO_PARAM, 3);
+    run(comp, 40);
+
+    Comp::ProcessArgs args;
+    args.sampleTime = 1.f / 44100.f;
+    args.sampleRate = 44100;
+
+    MeasureTime<float>::run(
+        overheadInOut, "Comp2 4 channel 4 band 4:1 soft", [&comp, args]() {
+            comp.inputs[Comp::LAUDIO_INPUT].setVoltage(TestBuffers<float>::get());
+            comp.process(args);
+            return comp.outputs[Comp::LAUDIO_OUTPUT].getVoltage(0);
+        },
+        1);
+}
+
 void perfTest2() {
     assert(overheadInOut > 0);
     assert(overheadOutOnly > 0);
@@ -774,6 +911,8 @@ void perfTest2() {
     testComp2Knee16();
     testComp2Knee16Linked();
     testComp2Knee16LinkedLimit();
+    testComp2Knee16Cold();
+    testComp2MultiBand4();
  
 
     testCompLim1();
@@ -794,9 +933,13 @@ void perfTest2() {
     testDrumTrigger();
     testFilt();
     testFilt2();
+    testFilt16Static();
+    testFilt16Mod();
+    testFilt16Cold();
     testSlew4();
     testMixStereo();
     testMix8();
+    testMix8Cold();
     testMix4();
     testMixM();
 
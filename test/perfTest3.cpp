@@ -2,10 +2,56 @@
 
 #include "MeasureTime.h"
 #include "Samp.h"
+#include "Sampler4vx.h"
 
 extern double overheadOutOnly;
 extern double overheadInOut;
 
+extern std::shared_ptr<Sampler4vx> makeTestSampler4vx(CompiledInstrument::Tests citest, WaveLoader::Tests wltest);
+
+static std::shared_ptr<Sampler4vx> makeFourVoiceSampler() {
+    auto s = makeTestSampler4vx(CompiledInstrument::Tests::MiddleC11, WaveLoader::Tests::DCTenSec);
+    s->setNumVoices(4);
+    for (int channel = 0; channel < 4; ++channel) {
+        s->note_on(channel, 60, 60, 44100);
+    }
+    // transpose them all a little, so we interpolate
+    s->setExpFM(float_4(.1f, .2f, .3f, .4f));
+    return s;
+}
+
+// one Sampler4vx, four voices, one frame at a time
+static void testSampVoiceStep() {
+    auto s = makeFourVoiceSampler();
+    const float sampleTime = 1.f / 44100.f;
+    const float_4 gates = SimdBlocks::maskTrue();
+    MeasureTime<float>::run(
+        overheadOutOnly, "sampler4vx step", [s, gates, sampleTime]() {
+            return s->step(gates, sampleTime, 0, false)[0];
+        },
+        1);
+}
+
+// same as above, but rendered in blocks
+static void testSampVoiceBlock(int blockSize) {
+    auto s = makeFourVoiceSampler();
+    const float sampleTime = 1.f / 44100.f;
+    const float_4 gates = SimdBlocks::maskTrue();
+    std::vector<float_4> block(blockSize);
+    int index = blockSize;
+
+    std::string title = "sampler4vx processBlock " + std::to_string(blockSize);
+    MeasureTime<float>::run(
+        overheadOutOnly, title.c_str(), [s, gates, sampleTime, &block, &index, blockSize]() {
+            if (index >= blockSize) {
+                s->processBlock(block.data(), blockSize, gates, sampleTime, 0, false);
+                index = 0;
+            }
+            return block[index++][0];
+        },
+        1);
+}
+
 static void testSamp1() {
     using Comp = Samp<TestComposite>;
     Comp comp;
@@ -137,4 +183,8 @@ void perfTest3() {
     testSamp3();
     testSamp4();
      testSamp5();
+
+    testSampVoiceStep();
+    testSampVoiceBlock(16);
+    testSampVoiceBlock(64);
 }
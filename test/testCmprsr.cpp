@@ -225,9 +225,48 @@ static void testIndependentAttack() {
     }
 }
 
+static void setupPoly(Cmprsr& cmp, const Cmprsr::Ratios* r, float_4 threshold, bool linked) {
+    cmp.setIsPolyCV(true);
+    cmp.setLinked(linked);
+    cmp.setCurvePoly(r);
+    cmp.setTimesPoly(0, 100, 1.f / 44100.f);
+    cmp.setThresholdPoly(threshold);
+}
+
+// each channel with its own ratio should be the same as all channels with that ratio
+static void testMixedRatios(bool linked) {
+    const Cmprsr::Ratios r[4] = {Cmprsr::Ratios::_2_1_soft, Cmprsr::Ratios::HardLimit, Cmprsr::Ratios::_20_1_hard, Cmprsr::Ratios::_8_1_soft};
+    const float_4 threshold(5, 4, 3, 2);
+    Cmprsr mixed;
+    setupPoly(mixed, r, threshold, linked);
+
+    Cmprsr single[4];
+    for (int i = 0; i < 4; ++i) {
+        // when linked, each pair uses the settings of the left channel
+        const int channel = linked ? (i & ~1) : i;
+        const Cmprsr::Ratios same[4] = {r[channel], r[channel], r[channel], r[channel]};
+        setupPoly(single[i], same, float_4(threshold[channel]), linked);
+    }
+
+    for (float x = 0; x < 20; x += .01f) {
+        const float_4 input(x, x * .5f, x * .25f, 20 - x);
+        const float_4 out = mixed.stepPoly(input, input);
+        for (int i = 0; i < 4; ++i) {
+            const float_4 expected = single[i].stepPoly(input, input);
+            assertClose(out[i], expected[i], .0001);
+        }
+    }
+}
+
+static void testMixedRatios() {
+    testMixedRatios(false);
+    testMixedRatios(true);
+}
+
 void testCmprsr() {
     testCompZeroAttack(false);
     testCompZeroAttack(true);
     testLimiterZeroAttack();
     testIndependentAttack();
+    testMixedRatios();
 }
\ No newline at end of file
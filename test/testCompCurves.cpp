@@ -1,6 +1,7 @@
 
 #include "Cmprsr.h"
 #include "CompCurves.h"
+#include "ObjectCache.h"
 #include "SplineRenderer.h"
 #include "asserts.h"
 
@@ -399,6 +400,23 @@ static void testLookup2Old() {
     }
 }
 
+// the four at once lookup should match the scalar one, with each lane on its own curve
+static void testLookupSimd() {
+    CompCurves::CompCurveLookupPtr hard = CompCurves::makeCompGainLookup2(CompCurves::Recipe(4, 0));
+    CompCurves::CompCurveLookupPtr soft = CompCurves::makeCompGainLookup3(CompCurves::Recipe(8, 12));
+    const CompCurves::CompCurveLookup* const curves[4] = {hard.get(), soft.get(), soft.get(), hard.get()};
+
+    for (float x = 0; x < 150; x += .037f) {
+        const float_4 x4(x, x, x * .1f, x * .1f);
+        const float_4 y = CompCurves::CompCurveLookup::lookup(curves, x4);
+        const float_4 yHard = hard->lookup(x4);
+        for (int i = 0; i < 4; ++i) {
+            assertClose(y[i], curves[i]->lookup(x4[i]), .00001);
+            assertClose(yHard[i], hard->lookup(x4[i]), .00001);
+        }
+    }
+}
+
 double getBiggestJump(double maxX, int divisions, std::function<double(double)> func) {
     //SQINFO("--- get biggest jump");
     double ret = 0;
@@ -855,6 +873,8 @@ static void justPrintSpline() {
 
 void testCompCurves() {
     Cmprsr::_reset();
+    ObjectCache<float>::_reset();
+    ObjectCache<double>::_reset();
     assertEQ(_numLookupParams, 0);
 
   //  justPrintSpline();
@@ -881,6 +901,7 @@ void testCompCurves() {
     testBasicSplineImp();
     testContinuousCurveOld();
     testLookup2Old();
+    testLookupSimd();
     testBiggestJumpOld();
     testBiggestSlopeJumpOld();
 
@@ -175,9 +175,91 @@ static void testMB_2() {
     }
 }
 
+
+static void initMultiBand(Comp2& comp, int channels) {
+    init(comp);
+    comp.params[Comp2::MULTIBAND_PARAM].value = 1;
+    comp.inputs[Comp2::LAUDIO_INPUT].channels = channels;
+    comp.outputs[Comp2::LAUDIO_OUTPUT].channels = 1;  // connected
+    run(comp);
+}
+
+/**
+ * Peak output on channel 0 for a sine at freq, once it settles.
+ */
+static float runSine(Comp2& comp, float freq) {
+    TestComposite::ProcessArgs args;
+    const float sampleRate = 1.f / comp.engineGetSampleTime();
+    const double delta = AudioMath::Pi * 2 * freq / sampleRate;
+    const int settle = int(sampleRate / 2);
+    float peak = 0;
+    for (int i = 0; i < settle + int(sampleRate / 10); ++i) {
+        comp.inputs[Comp2::LAUDIO_INPUT].setVoltage(float(5 * std::sin(delta * i)), 0);
+        comp.process(args);
+        if (i > settle) {
+            peak = std::max(peak, std::abs(comp.outputs[Comp2::LAUDIO_OUTPUT].getVoltage(0)));
+        }
+    }
+    return peak;
+}
+
+// each bank is one input, so only four of them
+static void testMultiBandChannels() {
+    Comp2 comp;
+    initMultiBand(comp, 6);
+    assertEQ(int(comp.outputs[Comp2::LAUDIO_OUTPUT].channels), 4);
+
+    comp.params[Comp2::MULTIBAND_PARAM].value = 0;
+    run(comp);
+    assertEQ(int(comp.outputs[Comp2::LAUDIO_OUTPUT].channels), 6);
+}
+
+// multi band is always mono, even when the stereo param isn't
+static void testMultiBandNotLinked() {
+    Comp2 comp;
+    init(comp);
+    comp.params[Comp2::STEREO_PARAM].value = 2;
+    comp.params[Comp2::MULTIBAND_PARAM].value = 1;
+    run(comp);
+    assertEQ(comp.ui_getNumVUChannels(), 16);
+}
+
+static void testMultiBandBypassed() {
+    Comp2 comp;
+    initMultiBand(comp, 1);
+    assert(!comp.getParamValueHolder().getEnabled(0));
+
+    // bands add back up to the input
+    assertClose(runSine(comp, 80), 5, .05);
+    assertClose(runSine(comp, 1000), 5, .05);
+    assertClose(runSine(comp, 8000), 5, .05);
+}
+
+// squash only the lowest band of channel 1
+static void testMultiBandOneBand() {
+    Comp2 comp;
+    initMultiBand(comp, 1);
+    comp.params[Comp2::CHANNEL_PARAM].value = 1;
+    run(comp);
+    comp.params[Comp2::NOTBYPASS_PARAM].value = 1;
+    comp.params[Comp2::RATIO_PARAM].value = 8;
+    comp.params[Comp2::THRESHOLD_PARAM].value = 0;
+    run(comp);
+    const CompressorParamHolder& holder = comp.getParamValueHolder();
+    assert(holder.getEnabled(0));
+    assert(!holder.getEnabled(1));
+
+    assertLT(runSine(comp, 50), 1);
+    assertClose(runSine(comp, 8000), 5, .05);
+}
+
 void testCompressorII() {
     testMB_1();
     testUnLinked();
     testLinked();
     testMB_2();
-}
\ No newline at end of file
+    testMultiBandChannels();
+    testMultiBandNotLinked();
+    testMultiBandBypassed();
+    testMultiBandOneBand();
+}
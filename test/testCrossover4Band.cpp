@@ -0,0 +1,101 @@
+
+#include "Crossover4Band.h"
+#include "AudioMath.h"
+#include "ButterworthFilterDesigner.h"
+#include "asserts.h"
+
+#include <algorithm>
+#include <cmath>
+
+static const float sampleRate = 44100;
+
+static void setup(Crossover4BandParams& params) {
+    params.setFrequencies(150 / sampleRate, 1000 / sampleRate, 5000 / sampleRate);
+}
+
+/**
+ * Peak level of a sine at freq, after it settles.
+ * lane is which band, or -1 for the sum of all of them.
+ */
+static float measure(float freq, int lane) {
+    Crossover4BandParams params;
+    setup(params);
+    Crossover4Band x;
+    const double delta = AudioMath::Pi * 2 * freq / sampleRate;
+    const int settle = int(sampleRate / 2);
+    const int total = settle + int(sampleRate / 10);
+    float peak = 0;
+    for (int i = 0; i < total; ++i) {
+        const float_4 bands = x.step(float(std::sin(delta * i)), params);
+        const float out = (lane < 0) ? (bands[0] + bands[1] + bands[2] + bands[3]) : bands[lane];
+        if (i > settle) {
+            peak = std::max(peak, std::abs(out));
+        }
+    }
+    return peak;
+}
+
+// the bands always add up to flat
+static void testCrossoverFlat() {
+    const float freqs[] = {40, 150, 400, 1000, 2500, 5000, 12000};
+    for (float freq : freqs) {
+        const float gain = measure(freq, -1);
+        assertClose(AudioMath::db(gain), 0, .05);
+    }
+}
+
+static void testCrossoverBands() {
+    // well inside a band, it's all in that band
+    assertClose(measure(40, 0), 1, .02);
+    assertLT(measure(40, 2), .01);
+    assertLT(measure(40, 3), .01);
+
+    assertClose(measure(400, 1), 1, .1);
+    assertClose(measure(2500, 2), 1, .1);
+
+    assertClose(measure(15000, 3), 1, .02);
+    assertLT(measure(15000, 0), .01);
+    assertLT(measure(15000, 1), .01);
+
+    // LR4 is -6db at the crossover
+    assertClose(measure(1000, 1), .5, .03);
+    assertClose(measure(1000, 2), .5, .03);
+}
+
+// we design our own butterworths so we don't allocate, but they must be the same
+static void testCrossoverDesign() {
+    const float freqs[] = {20, 150, 1000, 5000, 16000};
+    for (float freq : freqs) {
+        for (int highpass = 0; highpass < 2; ++highpass) {
+            BiquadParams<float, 1> ours;
+            BiquadParams<float, 1> theirs;
+            Crossover4BandParams::designButterworth(ours, freq / sampleRate, highpass);
+            if (highpass) {
+                ButterworthFilterDesigner<float>::designTwoPoleHighpass(theirs, freq / sampleRate);
+            } else {
+                ButterworthFilterDesigner<float>::designTwoPoleLowpass(theirs, freq / sampleRate);
+            }
+            for (int i = 0; i < 5; ++i) {
+                assertClose(ours.getAtIndex(i), theirs.getAtIndex(i), 1e-5);
+            }
+        }
+    }
+}
+
+static void testCrossoverClear() {
+    Crossover4BandParams params;
+    setup(params);
+    Crossover4Band x;
+    for (int i = 0; i < 100; ++i) {
+        x.step(1, params);
+    }
+    x.clear();
+    simd_assertEQ(x.step(0, params), float_4(0));
+}
+
+void testCrossover4Band() {
+    testCrossoverDesign();
+    testCrossoverFlat();
+    testCrossoverBands();
+    testCrossoverClear();
+}
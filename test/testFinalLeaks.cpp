@@ -3,12 +3,18 @@
 #include "ThreadSharedState.h"
 #include "ThreadServer.h"
 #include "FFTData.h"
+#include "ObjectCache.h"
 
 #include "asserts.h"
 extern int _numBiquads;
 
 void testFinalLeaks()
 {
+    // the cache holds its objects forever, so empty it before looking for leaks
+    ObjectCache<float>::_reset();
+    ObjectCache<double>::_reset();
+    ObjectCache<float_4>::_reset();
+
     assertEQ(ThreadMessage::_dbgCount, 0);
     assertEQ(FFTDataReal::_count, 0);
     assertEQ(FFTDataCpx::_count, 0);
@@ -0,0 +1,82 @@
+
+#include "FixedTables.h"
+#include "ObjectCache.h"
+#include "asserts.h"
+
+#include <cmath>
+
+extern int _numLookupParams;
+
+using Table = FixedTables::Table;
+
+/**
+ * The generated tables must be exactly what we would have computed.
+ * If this fails, run with --fixedTables and paste in the new tables.
+ */
+static void testMatchesRunTime(Table table)
+{
+    LookupTableParams<float> fixed;
+    assert(FixedTables::init(fixed, table));
+    assert(!fixed.ownsEntries);
+
+    auto computed = FixedTables::makeAtRunTime(table);
+    assert(computed->ownsEntries);
+
+    assertEQ(fixed.numBins_i, computed->numBins_i);
+    assertEQ(fixed.a, computed->a);
+    assertEQ(fixed.b, computed->b);
+    assertEQ(fixed.xMin, computed->xMin);
+    assertEQ(fixed.xMax, computed->xMax);
+    for (int i = 0; i < 2 * (fixed.numBins_i + 1); ++i) {
+        assertEQ(fixed.entries[i], computed->entries[i]);
+    }
+}
+
+static void testMatchesRunTime()
+{
+    for (int i = 0; i < int(Table::NUM_TABLES); ++i) {
+        testMatchesRunTime(Table(i));
+    }
+}
+
+static void testCacheUsesFixed()
+{
+    ObjectCache<float>::_reset();
+    assertEQ(_numLookupParams, 0);
+    {
+        auto tanh = ObjectCache<float>::getTanh5();
+        assert(!tanh->ownsEntries);
+        assertClose(LookupTable<float>::lookup(*tanh, 1), std::tanh(1), .001);
+        assertEQ(_numLookupParams, 1);
+
+        // double is still built at run time
+        auto tanhD = ObjectCache<double>::getTanh5();
+        assert(tanhD->ownsEntries);
+    }
+    ObjectCache<float>::_reset();
+    ObjectCache<double>::_reset();
+    assertEQ(_numLookupParams, 0);
+}
+
+static void testReAlloc()
+{
+    LookupTableParams<float> params;
+    FixedTables::init(params, Table::Db2Gain);
+
+    // making a fixed table into a normal one must not free the fixed data
+    params.alloc(8);
+    assert(params.ownsEntries);
+    params.alloc(16);
+
+    LookupTableParams<float> params2;
+    FixedTables::init(params2, Table::Db2Gain);
+    assertEQ(params2.numBins_i, 32);
+    assertEQ(params2.entries[0], float(AudioMath::gainFromDb(-80)));
+}
+
+void testFixedTables()
+{
+    testMatchesRunTime();
+    testCacheUsesFixed();
+    testReAlloc();
+}
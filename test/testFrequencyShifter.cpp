@@ -1,9 +1,11 @@
 #include <assert.h>
 #include <vector>
 
+#include "Analyzer.h"
 #include "FrequencyShifter.h"
 #include "TestComposite.h"
 #include "ExtremeTester.h"
+#include "asserts.h"
 
 using Shifter = FrequencyShifter<TestComposite>;
 
@@ -42,6 +44,93 @@ static void test1()
     }
 }
 
+// shift a sine that is exactly on an FFT bin by a whole number of bins
+static void testShift(Shifter::OutputIds output, int shiftBins)
+{
+    const int numSamples = 16 * 1024;
+    const float sampleRate = 44100;
+    const double binWidth = sampleRate / numSamples;
+    const int inputBin = 400;
+
+    Shifter fs;
+    fs.setSampleRate(sampleRate);
+    fs.init();
+    fs.freqRange = 500;
+    fs.params[Shifter::PITCH_PARAM].value = float(shiftBins * binWidth * 5 / 500);
+    fs.inputs[Shifter::AUDIO_INPUT].channels = 1;
+    fs.outputs[output].channels = 1;
+
+    double phase = 0;
+    const double phaseInc = inputBin * binWidth / sampleRate;
+    auto func = [&]() {
+        fs.inputs[Shifter::AUDIO_INPUT].setVoltage(float(std::sin(phase * 2 * AudioMath::Pi)), 0);
+        phase += phaseInc;
+        fs.step();
+        return fs.outputs[output].getVoltage(0);
+    };
+
+    // let the filters settle
+    for (int i = 0; i < 4000; ++i) {
+        func();
+    }
+
+    FFTDataCpx spectrum(numSamples);
+    Analyzer::getSpectrum(spectrum, false, func);
+    const int expectedBin = (output == Shifter::SIN_OUTPUT) ? inputBin + shiftBins : inputBin - shiftBins;
+    Analyzer::assertSingleFreq(spectrum, float(expectedBin * binWidth), sampleRate);
+}
+
+static void testShift()
+{
+    testShift(Shifter::SIN_OUTPUT, 100);
+    testShift(Shifter::COS_OUTPUT, 100);
+}
+
+// Each channel of a poly shifter should act just like a mono one.
+static void testPoly()
+{
+    const int numChannels = 7;
+    Shifter mono;
+    Shifter poly;
+    for (Shifter* fs : {&mono, &poly}) {
+        fs->setSampleRate(44100);
+        fs->init();
+        fs->freqRange = 50;
+        fs->params[Shifter::PITCH_PARAM].value = 2;
+        for (int i = 0; i < Shifter::NUM_OUTPUTS; ++i) {
+            fs->outputs[i].channels = 1;
+        }
+    }
+    mono.inputs[Shifter::AUDIO_INPUT].channels = 1;
+    poly.inputs[Shifter::AUDIO_INPUT].channels = numChannels;
+    poly.inputs[Shifter::AUDIO_R_INPUT].channels = 2;
+
+    const int testChannel = 5;
+    for (int i = 0; i < 1000; ++i) {
+        const float x = std::sin(i * .05f);
+        for (int channel = 0; channel < numChannels; ++channel) {
+            poly.inputs[Shifter::AUDIO_INPUT].setVoltage(x * channel, channel);
+        }
+        poly.inputs[Shifter::AUDIO_R_INPUT].setVoltage(x * testChannel, 1);
+        mono.inputs[Shifter::AUDIO_INPUT].setVoltage(x * testChannel, 0);
+
+        mono.step();
+        poly.step();
+
+        const float upShifted = mono.outputs[Shifter::SIN_OUTPUT].getVoltage(0);
+        const float downShifted = mono.outputs[Shifter::COS_OUTPUT].getVoltage(0);
+        assertEQ(poly.outputs[Shifter::SIN_OUTPUT].getVoltage(testChannel), upShifted);
+        assertEQ(poly.outputs[Shifter::COS_OUTPUT].getVoltage(testChannel), downShifted);
+        assertEQ(poly.outputs[Shifter::SIN_R_OUTPUT].getVoltage(1), upShifted);
+        assertEQ(poly.outputs[Shifter::SIN_R_OUTPUT].getVoltage(0), 0);
+    }
+
+    assertEQ(int(poly.outputs[Shifter::SIN_OUTPUT].channels), numChannels);
+    assertEQ(int(poly.outputs[Shifter::COS_OUTPUT].channels), numChannels);
+    assertEQ(int(poly.outputs[Shifter::SIN_R_OUTPUT].channels), 2);
+    assertEQ(int(mono.outputs[Shifter::SIN_OUTPUT].channels), 1);
+}
+
 static void testExtreme()
 {
 
@@ -61,5 +150,7 @@ void testFrequencyShifter()
 {
     test0();
     test1();
+    testShift();
+    testPoly();
     testExtreme();
 }
\ No newline at end of file
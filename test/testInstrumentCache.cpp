@@ -0,0 +1,153 @@
+
+#include "CompiledInstrument.h"
+#include "CompiledRegion.h"
+#include "InstrumentCache.h"
+#include "InstrumentInfo.h"
+#include "SInstrument.h"
+#include "SParse.h"
+#include "SamplerErrorContext.h"
+#include "SamplerPlayback.h"
+#include "StableHash.h"
+#include "asserts.h"
+
+static const char* testPatch = R"foo(
+    <group> sw_lokey=20 sw_hikey=21 sw_default=20
+    <region> sw_last=20 sw_label=soft lokey=30 hikey=60 hivel=63 sample=soft-low.wav
+    <region> sw_last=20 sw_label=soft lokey=30 hikey=60 lovel=64 sample=soft-high.wav
+    <region> sw_last=21 sw_label=loud lokey=30 hikey=60 sample=loud.wav volume=-6 tune=20
+    <group> seq_length=2 lokey=61 hikey=70 amp_veltrack=50 ampeg_release=1.5
+    <region> seq_position=1 sample=rr1.wav loop_mode=loop_continuous loop_start=10 loop_end=2000
+    <region> seq_position=2 sample=rr2.wav offset=100 end=5000 pitch_keycenter=65
+    )foo";
+
+static CompiledInstrumentPtr compile(const char* patch) {
+    SInstrumentPtr inst = std::make_shared<SInstrument>();
+    auto err = SParse::go(patch, inst);
+    assert(err.empty());
+
+    SamplerErrorContext errc;
+    CompiledInstrumentPtr cinst = CompiledInstrument::make(errc, inst);
+    assert(cinst && !cinst->isInError());
+    return cinst;
+}
+
+static CompiledInstrumentPtr roundTrip(const CompiledInstrument& cinst) {
+    InstrumentWriter w;
+    cinst.write(w);
+    InstrumentReader r(w.data().data(), w.data().size());
+    CompiledInstrumentPtr ret = CompiledInstrument::read(r);
+    assert(r.atEnd());
+    return ret;
+}
+
+static void testReaderWriter() {
+    InstrumentWriter w;
+    w.write(int(-12));
+    w.write(unsigned(34));
+    w.write(uint64_t(1) << 40);
+    w.write(1.5f);
+    w.write(true);
+    w.write(std::string("abc"));
+
+    InstrumentReader r(w.data().data(), w.data().size());
+    int i = 0;
+    unsigned int u = 0;
+    uint64_t u64 = 0;
+    float f = 0;
+    bool b = false;
+    std::string s;
+    r.read(i);
+    r.read(u);
+    r.read(u64);
+    r.read(f);
+    r.read(b);
+    r.read(s);
+    assert(r.ok());
+    assert(r.atEnd());
+    assertEQ(i, -12);
+    assertEQ(u, 34);
+    assert(u64 == (uint64_t(1) << 40));
+    assertEQ(f, 1.5f);
+    assertEQ(b, true);
+    assertEQ(s, "abc");
+
+    // off the end
+    r.read(i);
+    assert(!r.ok());
+    assertEQ(i, 0);
+}
+
+static void testRoundTripInfo() {
+    auto cinst = compile(testPatch);
+    auto cinst2 = roundTrip(*cinst);
+    assert(cinst2);
+
+    assertEQ(cinst2->_pool().size(), cinst->_pool().size());
+    auto info = cinst->getInfo();
+    auto info2 = cinst2->getInfo();
+    assertEQ(info2->minPitch, info->minPitch);
+    assertEQ(info2->maxPitch, info->maxPitch);
+    assertEQ(info2->defaultKeySwitch, info->defaultKeySwitch);
+    assert(info2->keyswitchData == info->keyswitchData);
+}
+
+static void testRoundTripPlay() {
+    auto cinst = compile(testPatch);
+    auto cinst2 = roundTrip(*cinst);
+    assert(cinst2);
+
+    // play the same notes (including key switches and round robins) into both.
+    // everything should match.
+    VoicePlayParameter params;
+    int played = 0;
+    for (int pitch = 0; pitch < 128; ++pitch) {
+        for (int vel = 1; vel < 128; vel += 9) {
+            params.midiPitch = pitch;
+            params.midiVelocity = vel;
+            VoicePlayInfo info, info2;
+            bool ks = cinst->play(info, params, nullptr, 44100);
+            bool ks2 = cinst2->play(info2, params, nullptr, 44100);
+            assertEQ(ks, ks2);
+            assertEQ(info.valid, info2.valid);
+            assertEQ(info.sampleIndex, info2.sampleIndex);
+            assertEQ(info.gain, info2.gain);
+            assertEQ(info.ampeg_release, info2.ampeg_release);
+            assertEQ(info.needsTranspose, info2.needsTranspose);
+            assert(info.loopData == info2.loopData);
+            if (info.valid) {
+                ++played;
+            }
+        }
+    }
+    assert(played > 0);
+}
+
+// the cache file names depend on this never changing
+static void testStableHash() {
+    assert(stableHash("") == 0xcbf29ce484222325ULL);
+    assert(stableHash("a") == 0xaf63dc4c8601ec8cULL);
+    assert(stableHash("foobar") == 0x85944171f73967e8ULL);
+}
+
+static void testBadData() {
+    auto cinst = compile(testPatch);
+    InstrumentWriter w;
+    cinst->write(w);
+
+    // every truncation should fail cleanly
+    for (size_t size = 0; size < w.data().size(); size += 7) {
+        InstrumentReader r(w.data().data(), size);
+        auto cinst2 = CompiledInstrument::read(r);
+        assert(!cinst2);
+    }
+}
+
+void testInstrumentCache() {
+    assertEQ(compileCount, 0);
+    testStableHash();
+    testReaderWriter();
+    testRoundTripInfo();
+    testRoundTripPlay();
+    testBadData();
+    assertEQ(compileCount, 0);
+}
@@ -3,6 +3,7 @@
 #include "TestComposite.h"
 #include "Filt.h"
 #include "LadderFilter.h"
+#include "LadderFilter_4.h"
 #include "PeakDetector.h"
 #include "TestComposite.h"
 
@@ -109,6 +110,72 @@ static void testLadderTypes()
     }
 }
 
+// each lane of the float_4 filter should match a scalar filter with the same settings
+static void testLadder4MatchesScalar(LadderFilter<float>::Types type, LadderFilter<float>::Voicing voicing)
+{
+    const float fc[4] = {.001f, .01f, .05f, .2f};
+    const float feedback[4] = {0, 1, 3, 3.9f};
+    const float edge[4] = {.1f, .3f, .5f, 1};
+    const float slope[4] = {0, 1.5f, 2.2f, 3};
+    const float spread[4] = {0, .5f, 1, .2f};
+    const float gain[4] = {.15f, 1, 2, 4};
+
+    LadderFilter<float> filters[4];
+    LadderFilter<float_4> filter4;
+
+    filter4.setType(type);
+    filter4.setVoicing(voicing);
+    filter4.setNormalizedFc(float_4::load(fc));
+    filter4.setFeedback(float_4::load(feedback));
+    filter4.setEdge(float_4::load(edge));
+    filter4.setSlope(float_4::load(slope));
+    filter4.setFreqSpread(float_4::load(spread));
+    filter4.setGain(float_4::load(gain));
+    filter4.setBassMakeupGain(1.5f);
+    filter4.setVolume(.7f);
+    for (int i = 0; i < 4; ++i) {
+        LadderFilter<float>& f = filters[i];
+        f.setType(type);
+        f.setVoicing(voicing);
+        f.setNormalizedFc(fc[i]);
+        f.setFeedback(feedback[i]);
+        f.setEdge(edge[i]);
+        f.setSlope(slope[i]);
+        f.setFreqSpread(spread[i]);
+        f.setGain(gain[i]);
+        f.setBassMakeupGain(1.5f);
+        f.setVolume(.7f);
+        if (i == 0) {
+            for (int tap = 0; tap < 4; ++tap) {
+                assertEQ(filter4.getLEDValue(tap), f.getLEDValue(tap));
+            }
+        }
+    }
+
+    for (int sample = 0; sample < 1000; ++sample) {
+        // a square wave, to make all the distortions do something
+        const float input = (sample & 64) ? 5.f : -5.f;
+        filter4.run(input);
+        const float_4 output4 = filter4.getOutput();
+        for (int i = 0; i < 4; ++i) {
+            filters[i].run(input);
+            assertClose(output4[i], filters[i].getOutput(), .001);
+        }
+    }
+}
+
+static void testLadder4MatchesScalar()
+{
+    using F = LadderFilter<float>;
+    for (int type = 0; type < (int)F::Types::NUM_TYPES; ++type) {
+        testLadder4MatchesScalar(F::Types(type), F::Voicing::Classic);
+    }
+    for (int voicing = 0; voicing < (int)F::Voicing::NUM_VOICINGS; ++voicing) {
+        testLadder4MatchesScalar(F::Types::_4PLP, F::Voicing(voicing));
+        testLadder4MatchesScalar(F::Types::_2PHP, F::Voicing(voicing));
+    }
+}
+
 // if not 4P LP, will all be zero
 static void testLED0()
 {
@@ -655,6 +722,57 @@ static void testFiltOutputsLeftDisconnect()
 
 
 
+// mono CV should do the same thing as poly CV that has the same value on every channel,
+// and poly CV on one channel should only change that channel.
+static void testFiltPolyCV()
+{
+    using F = Filt<TestComposite>;
+    F mono;
+    F poly;
+    for (F* f : {&mono, &poly}) {
+        f->init();
+        f->inputs[F::L_AUDIO_INPUT].channels = 8;
+        f->outputs[F::L_AUDIO_OUTPUT].channels = 8;
+        f->params[F::MASTER_VOLUME_PARAM].value = 1;
+        f->params[F::FC1_TRIM_PARAM].value = 1;
+    }
+    mono.inputs[F::CV_INPUT1].channels = 1;
+    mono.inputs[F::CV_INPUT1].setVoltage(-2, 0);
+    poly.inputs[F::CV_INPUT1].channels = 8;
+    for (int i = 0; i < 8; ++i) {
+        poly.inputs[F::CV_INPUT1].setVoltage(-2, i);
+    }
+
+    auto run = [&mono, &poly]() {
+        for (int i = 0; i < 200; ++i) {
+            const float x = (i & 16) ? 5.f : -5.f;
+            for (int channel = 0; channel < 8; ++channel) {
+                mono.inputs[F::L_AUDIO_INPUT].setVoltage(x, channel);
+                poly.inputs[F::L_AUDIO_INPUT].setVoltage(x, channel);
+            }
+            mono.step();
+            poly.step();
+        }
+    };
+
+    run();
+    for (int i = 0; i < 8; ++i) {
+        assertEQ(poly.outputs[F::L_AUDIO_OUTPUT].getVoltage(i), mono.outputs[F::L_AUDIO_OUTPUT].getVoltage(i));
+    }
+
+    poly.inputs[F::CV_INPUT1].setVoltage(3, 6);
+    run();
+    for (int i = 0; i < 8; ++i) {
+        const float expected = mono.outputs[F::L_AUDIO_OUTPUT].getVoltage(i);
+        const float actual = poly.outputs[F::L_AUDIO_OUTPUT].getVoltage(i);
+        if (i == 6) {
+            assertNE(actual, expected);
+        } else {
+            assertEQ(actual, expected);
+        }
+    }
+}
+
 static void stepF(Filt<TestComposite>& f) {
     for (int i = 0; i < 60; ++i) {
         f.step();
@@ -677,7 +795,7 @@ static void testProcVarsStereo()
     stepF(f);
 
     const Filt<TestComposite>::ProcessingVars& x = f._getProcVars();
-    assert(x.mode == LadderFilterBank<double>::Modes::stereo);
+    assert(x.mode == LadderFilterBank<F::T>::Modes::stereo);
     assert(x.inputForChannel0 == nullptr);
     assert(x.inputForChannel1 != nullptr);
     assertEQ(x.leftOutputChannels, 1);
@@ -698,7 +816,7 @@ static void testProcVarsPoly()
     stepF(f);
 
     const Filt<TestComposite>::ProcessingVars& x = f._getProcVars();
-    assert(x.mode == LadderFilterBank<double>::Modes::normal);
+    assert(x.mode == LadderFilterBank<F::T>::Modes::normal);
     assert(x.inputForChannel0 == nullptr);
     assert(x.inputForChannel1 == nullptr);
     assertEQ(x.leftOutputChannels, 12);
@@ -720,7 +838,7 @@ static void testProcVarsL()
     stepF(f);
 
     const Filt<TestComposite>::ProcessingVars& x = f._getProcVars();
-    assert(x.mode == LadderFilterBank<double>::Modes::leftOnly);
+    assert(x.mode == LadderFilterBank<F::T>::Modes::leftOnly);
     assert(x.inputForChannel0 == nullptr);
     assert(x.inputForChannel1 == nullptr);
     assertEQ(x.leftOutputChannels, 1);
@@ -742,7 +860,7 @@ static void testProcVarsR()
     stepF(f);
 
     const Filt<TestComposite>::ProcessingVars& x = f._getProcVars();
-    assert(x.mode == LadderFilterBank<double>::Modes::rightOnly);
+    assert(x.mode == LadderFilterBank<F::T>::Modes::rightOnly);
     assert(x.inputForChannel0 != nullptr);
     assert(x.inputForChannel1 == nullptr);
     assertEQ(x.leftOutputChannels, 1);
@@ -765,6 +883,7 @@ void testLadder()
     testLadderDCf(1000);
     testLadderDCd(1000);
     testLadderTypes();
+    testLadder4MatchesScalar();
     testLED0();
     testLED1();
     testLED2();
@@ -792,6 +911,7 @@ void testLadder()
     testFiltOutputStereo();
     testFiltOutputLeftOnly();
     testFiltOutputRightOnly();
+    testFiltPolyCV();
 
     // the following are bad tests
 #if 0
@@ -446,6 +446,88 @@ static void testNonUniform4()
     assertClose(result, 11.f, .000001);
 }
 
+// very uneven spacing, like the filter tables, checked against plain linear interpolation
+template <typename T>
+static void testNonUniformLog()
+{
+    NonUniformLookupTableParams<T> params;
+    std::vector<T> xs;
+    for (T x = T(.00001); x < T(.5); x *= T(1.3)) {
+        xs.push_back(x);
+        NonUniformLookupTable<T>::addPoint(params, x, std::sqrt(x));
+    }
+    NonUniformLookupTable<T>::finalize(params);
+    assertEQ(params.size(), int(xs.size()));
+
+    for (size_t i = 0; i < xs.size(); ++i) {
+        assertClose(NonUniformLookupTable<T>::lookup(params, xs[i]), std::sqrt(xs[i]), .00001);
+        if (i + 1 < xs.size()) {
+            const T x = (xs[i] + xs[i + 1]) / 2;
+            const T expected = (std::sqrt(xs[i]) + std::sqrt(xs[i + 1])) / 2;
+            assertClose(NonUniformLookupTable<T>::lookup(params, x), expected, .00001);
+        }
+    }
+    assertClose(NonUniformLookupTable<T>::lookup(params, 0), std::sqrt(xs.front()), .00001);
+    assertClose(NonUniformLookupTable<T>::lookup(params, 1), std::sqrt(xs.back()), .00001);
+}
+
+template <typename T>
+static void testNonUniformOnePoint()
+{
+    NonUniformLookupTableParams<T> params;
+    NonUniformLookupTable<T>::addPoint(params, 3, 7);
+    NonUniformLookupTable<T>::finalize(params);
+    assertEQ(NonUniformLookupTable<T>::lookup(params, 2), 7);
+    assertEQ(NonUniformLookupTable<T>::lookup(params, 3), 7);
+    assertEQ(NonUniformLookupTable<T>::lookup(params, 4), 7);
+}
+
+static void testNonUniformSimd()
+{
+    NonUniformLookupTableParams<float> params;
+    NonUniformLookupTable<float>::addPoint(params, 0, 0);
+    NonUniformLookupTable<float>::addPoint(params, 1, 1);
+    NonUniformLookupTable<float>::addPoint(params, 2, 21);
+    NonUniformLookupTable<float>::finalize(params);
+
+    const float_4 x(-1, .5f, 1.5f, 3);
+    const float_4 y = NonUniformLookupTable<float>::lookup(params, x);
+    for (int i = 0; i < 4; ++i) {
+        assertEQ(y[i], NonUniformLookupTable<float>::lookup(params, x[i]));
+    }
+    assertClose(y[2], 11, .00001);
+}
+
+static void testUniformSimd()
+{
+    LookupTableParams<float> sine;
+    LookupTableParams<float> exp;
+    LookupTable<float>::init(sine, 64, -1, 3, [](double x) {
+        return std::sin(x);
+    });
+    LookupTable<float>::init(exp, 16, 0, 10, [](double x) {
+        return std::exp(x);
+    });
+
+    // below, inside, and above the domain
+    const float_4 x(-2, .33f, 2.9f, 4);
+    const float_4 y = LookupTable<float>::lookup(sine, x);
+    for (int i = 0; i < 4; ++i) {
+        assertClose(y[i], LookupTable<float>::lookup(sine, x[i], true), .00001);
+    }
+
+    // each lane can have its own table
+    const LookupTableParams<float>* const tables[4] = {&sine, &exp, &exp, &sine};
+    for (float f = -3; f < 12; f += .13f) {
+        const float_4 x4(f, f, f * .5f, f * .25f);
+        const float_4 y4 = LookupTable<float>::lookup(tables, x4);
+        for (int i = 0; i < 4; ++i) {
+            const float expected = LookupTable<float>::lookup(*tables[i], x4[i], true);
+            assertClose(y4[i], expected, std::abs(expected) * .00001 + .00001);
+        }
+    }
+}
+
 template <typename T>
 static void testGenericExp()
 {
@@ -509,6 +591,8 @@ static void test()
     testNonUniform2<T>();
     testNonUniform3<T>();
     testNonUniform4<T>(); 
+    testNonUniformLog<T>();
+    testNonUniformOnePoint<T>();
 
     testGenericExp<T>();  
 }
@@ -517,5 +601,7 @@ void testLookupTable()
 {
     test<double>();
     test<float>();
+    testNonUniformSimd();
+    testUniformSimd();
     testDetune();
 }
\ No newline at end of file
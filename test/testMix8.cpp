@@ -328,6 +328,28 @@ static void testPanLookL()
     }
 }
 
+// the simd pan law the mixers use now must match the old one
+static void testPanLaw4()
+{
+    auto lookL = ObjectCache<float>::getMixerPanL();
+    auto lookR = ObjectCache<float>::getMixerPanR();
+    MixPanLaw4 law;
+    const float pans[] = {-1, -.75f, -.3f, 0, .1f, .5f, .9f, 1};
+    for (int i = 0; i < 8; i += 4) {
+        const float_4 pan(pans[i], pans[i + 1], pans[i + 2], pans[i + 3]);
+        assert(law.update(pan));
+        for (int lane = 0; lane < 4; ++lane) {
+            const float x = pan[lane];
+            assertClose(law.left[lane], _PanL(x, 0), .0001);
+            assertClose(law.right[lane], _PanR(x, 0), .0001);
+            assertClose(law.left[lane], LookupTable<float>::lookup(*lookL, x), .01);
+            assertClose(law.right[lane], LookupTable<float>::lookup(*lookR, x), .01);
+        }
+        // same pan again is not a change
+        assert(!law.update(pan));
+    }
+}
+
 template <typename T>
 static void testReturn()
 {
@@ -538,6 +560,7 @@ void testMix8()
 
     testPanLook0();
     testPanLookL();
+    testPanLaw4();
 
     testPanMiddle<Mixer8>(outputGetterMix8);
 
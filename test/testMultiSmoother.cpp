@@ -0,0 +1,89 @@
+
+#include "MultiSmoother.h"
+#include "asserts.h"
+
+static const float sampleTime = 1.f / 44100.f;
+
+static void testMultiSmootherInit() {
+    MultiSmoother<8> s;
+    for (int i = 0; i < 8; ++i) {
+        assertEQ(s.get(i), 0);
+    }
+
+    float x[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    s.reset(x);
+    for (int i = 0; i < 8; ++i) {
+        assertEQ(s.get(i), x[i]);
+    }
+    assertEQ(s.get4(4)[2], 7);
+
+    // no new input, so tick does nothing
+    s.tick();
+    assertEQ(s.get(3), 4);
+}
+
+// with no lowpass, a change is a linear ramp over one control period
+static void testMultiSmootherRamp() {
+    MultiSmoother<4> s;
+    s.setTime(0, sampleTime, 4);
+
+    float x[4] = {4, 0, -8, 1};
+    s.step(x);
+    s.tick();
+    assertClose(s.get(0), 1, .00001);
+    assertClose(s.get(2), -2, .00001);
+    s.tick();
+    assertClose(s.get(0), 2, .00001);
+    s.tick();
+    s.tick();
+    for (int i = 0; i < 4; ++i) {
+        assertClose(s.get(i), x[i], .00001);
+    }
+
+    // and it stays there
+    s.step(x);
+    for (int i = 0; i < 4; ++i) {
+        s.tick();
+    }
+    for (int i = 0; i < 4; ++i) {
+        assertClose(s.get(i), x[i], .00001);
+    }
+}
+
+static void testMultiSmootherTime() {
+    const float tau = .01f;
+    const int div = 4;
+    MultiSmoother<4> s;
+    s.setTime(tau, sampleTime, div);
+
+    float x[4] = {1, 1, 1, 1};
+    const int samplesPerTau = int(tau / sampleTime);
+    float last = 0;
+    for (int i = 0; i < samplesPerTau; ++i) {
+        if ((i % div) == 0) {
+            s.step(x);
+        }
+        s.tick();
+
+        // it moves every sample, not just on the control steps
+        assertGT(s.get(0), last);
+        last = s.get(0);
+    }
+
+    // one time constant gets to 1 - 1/e, but the ramp is a control period late
+    assertClose(s.get(0), .63, .02);
+
+    for (int i = 0; i < samplesPerTau * 20; ++i) {
+        if ((i % div) == 0) {
+            s.step(x);
+        }
+        s.tick();
+    }
+    simd_assertClose(s.get4(0), float_4(1), .0001);
+}
+
+void testMultiSmoother() {
+    testMultiSmootherInit();
+    testMultiSmootherRamp();
+    testMultiSmootherTime();
+}
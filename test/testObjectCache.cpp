@@ -2,8 +2,23 @@
 #include "asserts.h"
 #include "ObjectCache.h"
 
+#include <string>
+#include <thread>
+
 extern int _numLookupParams;
 
+template <typename T>
+static ObjectCacheStats getStats(const char* name)
+{
+    for (auto stats : ObjectCache<T>::getStats()) {
+        if (std::string(stats.name) == name) {
+            return stats;
+        }
+    }
+    assert(false);
+    return ObjectCacheStats();
+}
+
 template <typename T>
 static void testBipolar()
 {
@@ -13,23 +28,35 @@ static void testBipolar()
     assertEQ(_numLookupParams, 1);
     auto test2 = ObjectCache<T>::getBipolarAudioTaper();
     assertEQ(_numLookupParams, 1);
+    assert(test == test2);
     test.reset();
-    assertEQ(_numLookupParams, 1);
-
     test2.reset();
-    assertEQ(_numLookupParams, 0);
+
+    // the cache keeps it
+    assertEQ(_numLookupParams, 1);
+    assertEQ(getStats<T>("bipolarAudioTaper").builds, 1);
+    assertEQ(getStats<T>("bipolarAudioTaper").hits, 1);
 
     {
-        // simple test that bipolar audio scalers use cached lookups, and they work
+        // simple test that bipolar audio scalers use cached lookups, and they work.
+        // the scalers are always float.
+        auto floatTaper = ObjectCache<float>::getBipolarAudioTaper();
+        const int numTables = _numLookupParams;
         AudioMath::ScaleFun<float> f = AudioMath::makeScalerWithBipolarAudioTrim(3, 4);
         assertEQ(f(0, -5, 0), 3.);
-        assertEQ(_numLookupParams, 1);
+        assertEQ(_numLookupParams, numTables);
     }
+    ObjectCache<float>::_reset();
+    ObjectCache<T>::_reset();
     assertEQ(_numLookupParams, 0);
+    assertEQ(getStats<T>("bipolarAudioTaper").builds, 0);
 
     // make again
     test = ObjectCache<T>::getBipolarAudioTaper();
     assertEQ(_numLookupParams, 1);
+    assertEQ(getStats<T>("bipolarAudioTaper").builds, 1);
+    test.reset();
+    ObjectCache<T>::_reset();
 }
 
 template <typename T>
@@ -42,28 +69,24 @@ static void testAudioTaper()
     auto test2 = ObjectCache<T>::getAudioTaper();
     assertEQ(_numLookupParams, 1);
     test.reset();
-    assertEQ(_numLookupParams, 1);
-
     test2.reset();
-    assertEQ(_numLookupParams, 0);
+    assertEQ(_numLookupParams, 1);
 
     {
-
-        // simple test that bipolar audio scalers use cached lookups, and they work
+        // simple test that audio scalers use cached lookups, and they work
+        auto floatTaper = ObjectCache<float>::getAudioTaper();
+        const int numTables = _numLookupParams;
         AudioMath::SimpleScaleFun<float> f = AudioMath::makeSimpleScalerAudioTaper(3, 4);
         assertEQ(f(0, -5), 3.);
-        assertEQ(_numLookupParams, 1);
+        assertEQ(_numLookupParams, numTables);
         assertEQ(f(5, 5), 4.);
     }
+    assertEQ(getStats<T>("audioTaper").builds, 1);
+    ObjectCache<float>::_reset();
+    ObjectCache<T>::_reset();
     assertEQ(_numLookupParams, 0);
-
-    // make again
-    test = ObjectCache<T>::getAudioTaper();
-    assertEQ(_numLookupParams, 1);
 }
 
-
-
 template <typename T>
 static void testSin()
 {
@@ -74,25 +97,18 @@ static void testSin()
     auto test2 = ObjectCache<T>::getSinLookup();
     assertEQ(_numLookupParams, 1);
     test.reset();
-    assertEQ(_numLookupParams, 1);
-
     test2.reset();
-    assertEQ(_numLookupParams, 0);
-
-    {
-     //   // simple test that bipolar audio scalers use cached lookups, and they work
-        AudioMath::ScaleFun<float> f = AudioMath::makeScalerWithBipolarAudioTrim(3, 4);
-        assertEQ(f(0, -5, 0), 3.);
-        assertEQ(_numLookupParams, 1);
-    }
-    assertEQ(_numLookupParams, 0);
+    assertEQ(_numLookupParams, 1);
 
-    // make again
+    // a client that outlives the cache entry keeps its table
     test = ObjectCache<T>::getSinLookup();
+    ObjectCache<T>::_reset();
     assertEQ(_numLookupParams, 1);
+    assertClose(LookupTable<T>::lookup(*test, T(.25)), 1, .0001);
+    test.reset();
+    assertEQ(_numLookupParams, 0);
 }
 
-
 template <typename T>
 static void testExp2()
 {
@@ -103,10 +119,7 @@ static void testExp2()
     auto test2 = ObjectCache<T>::getExp2();
     assertEQ(_numLookupParams, 1);
     test.reset();
-    assertEQ(_numLookupParams, 1);
-
     test2.reset();
-    assertEQ(_numLookupParams, 0);
 
     {
         auto test3 = ObjectCache<T>::getExp2();
@@ -115,11 +128,10 @@ static void testExp2()
         assertClose(x, y, .001);
         assertEQ(_numLookupParams, 1);
     }
+    assertEQ(getStats<T>("exp2").builds, 1);
+    assertEQ(getStats<T>("exp2").hits, 2);
+    ObjectCache<T>::_reset();
     assertEQ(_numLookupParams, 0);
-
-    // make again
-    test = ObjectCache<T>::getExp2();
-    assertEQ(_numLookupParams, 1);
 }
 
 template <typename T>
@@ -132,6 +144,7 @@ static void testExp2b()
         const T b = LookupTable<T>::lookup(*ex2, 6);
         assertClose(b / a, 2, .001);
     }
+    ObjectCache<T>::_reset();
 }
 
 
@@ -145,10 +158,8 @@ static void testDb2Gain()
     auto test2 = ObjectCache<T>::getDb2Gain();
     assertEQ(_numLookupParams, 1);
     test.reset();
-    assertEQ(_numLookupParams, 1);
-
     test2.reset();
-    assertEQ(_numLookupParams, 0);
+    assertEQ(_numLookupParams, 1);
 
     {
         auto test3 = ObjectCache<T>::getDb2Gain();
@@ -159,11 +170,8 @@ static void testDb2Gain()
         assertClose(x, y, .1);
         assertEQ(_numLookupParams, 1);
     }
+    ObjectCache<T>::_reset();
     assertEQ(_numLookupParams, 0);
-
-    // make again
-    test = ObjectCache<T>::getDb2Gain();
-    assertEQ(_numLookupParams, 1);
 }
 
 template <typename T>
@@ -186,6 +194,7 @@ static void testDb2Gain2()
 template <typename T>
 static void testTanh5()
 {
+    ObjectCache<T>::_reset();
     auto test = ObjectCache<T>::getTanh5();
     auto test2 = ObjectCache<T>::getTanh5();
     assertEQ(_numLookupParams, 1);
@@ -202,6 +211,7 @@ static void testTanh5()
 template <typename T>
 static void testExp2Ex()
 {
+    ObjectCache<T>::_reset();
     auto f = ObjectCache<T>::getExp2Ex();
     assertEQ(_numLookupParams, 2);
 }
@@ -231,6 +241,65 @@ static void testVelocity()
 }
 
 
+// after init, getting an object is only a hit
+template <typename T>
+static void testInit()
+{
+    ObjectCache<T>::_reset();
+    assertEQ(_numLookupParams, 0);
+
+    ObjectCache<T>::init();
+    const int numTables = _numLookupParams;
+    assertGT(numTables, 10);
+    for (auto stats : ObjectCache<T>::getStats()) {
+        assertEQ(stats.hits, 0);
+    }
+
+    auto exp2 = ObjectCache<T>::getExp2();
+    auto sin = ObjectCache<T>::getSinLookup();
+    ObjectCache<T>::init();
+    assertEQ(_numLookupParams, numTables);
+    assertEQ(getStats<T>("exp2").builds, 1);
+    assertEQ(getStats<T>("exp2").hits, 2);
+    assertEQ(getStats<T>("tanh5").builds, 1);
+    assertEQ(getStats<T>("tanh5").hits, 1);
+
+    exp2.reset();
+    sin.reset();
+    ObjectCache<T>::_reset();
+    assertEQ(_numLookupParams, 0);
+}
+
+// many threads asking at once all get the same one
+template <typename T>
+static void testThreads()
+{
+    ObjectCache<T>::_reset();
+    const int numThreads = 8;
+    std::shared_ptr<LookupTableParams<T>> results[numThreads];
+    std::vector<std::thread> threads;
+    for (int i = 0; i < numThreads; ++i) {
+        threads.push_back(std::thread([i, &results]() {
+            results[i] = ObjectCache<T>::getSinLookup();
+        }));
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (int i = 0; i < numThreads; ++i) {
+        assert(results[i]);
+        assert(results[i] == results[0]);
+    }
+    for (auto& result : results) {
+        result.reset();
+    }
+    assertEQ(getStats<T>("sinLookup").builds, 1);
+    assertEQ(getStats<T>("sinLookup").hits, numThreads - 1);
+    assertEQ(_numLookupParams, 1);
+    ObjectCache<T>::_reset();
+}
+
 template <typename T>
 static void test()
 {
@@ -245,12 +314,19 @@ static void test()
     testExp2Ex<T>();
     testLPF<T>();
     testVelocity<T>();
+    testInit<T>();
+    testThreads<T>();
 }
 
 void testObjectCache()
 {
+    // earlier tests may have filled the cache
+    ObjectCache<float>::_reset();
+    ObjectCache<double>::_reset();
     assertEQ(_numLookupParams, 0);
     test<float>();
     test<double>();
+    ObjectCache<float>::_reset();
+    ObjectCache<double>::_reset();
     assertEQ(_numLookupParams, 0);
 }
\ No newline at end of file
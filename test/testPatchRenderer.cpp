@@ -0,0 +1,99 @@
+#include <sstream>
+
+#include "Basic.h"
+#include "Mix8.h"
+#include "PatchRenderer.h"
+#include "TestComposite.h"
+#include "asserts.h"
+
+using Vco = Basic<TestComposite>;
+using Mixer = Mix8<TestComposite>;
+
+static bool parse(PatchRenderer& renderer, const std::string& patch) {
+    std::istringstream stream(patch);
+    return renderer.parse(stream);
+}
+
+/**
+ * A VCO into channel 1 of a mixer.
+ */
+static std::string vcoToMixer() {
+    std::stringstream s;
+    s << "# simple patch\n";
+    s << "samplerate 48000\n";
+    s << "seconds .05\n";
+    s << "module vco Basic\n";
+    s << "module mix Mix8  # the mixer\n";
+    s << "voltage vco " << Vco::VOCT_INPUT << " 4 1\n";
+    s << "cable vco " << Vco::MAIN_OUTPUT << " mix " << Mixer::AUDIO0_INPUT << "\n";
+    s << "output mix " << Mixer::LEFT_OUTPUT << "\n";
+    return s.str();
+}
+
+static void testRender() {
+    PatchRenderer renderer;
+    assert(parse(renderer, vcoToMixer()));
+    assert(renderer.render(""));
+
+    assertEQ(renderer.getSampleRate(), 48000);
+    const auto& audio = renderer.getAudio();
+    assertEQ(audio.size(), 48000 / 20);
+
+    float maxSample = 0;
+    for (float x : audio) {
+        maxSample = std::max(maxSample, std::abs(x));
+    }
+    assertGT(maxSample, .1);
+
+    auto stats = renderer.getStats();
+    assertEQ(stats.size(), 2);
+    assertEQ(stats[0].name, "vco");
+    assertEQ(stats[1].type, "Mix8");
+    assertGT(renderer.getTotalNsPerSample(), 0);
+}
+
+static void testPolyCable() {
+    PatchRenderer renderer;
+    std::string patch = vcoToMixer();
+    patch += "output vco " + std::to_string(Vco::MAIN_OUTPUT) + "\n";
+    assert(parse(renderer, patch));
+    assert(renderer.render(""));
+
+    // the vco has four voices at the same pitch, and they are all summed into the wav.
+    // the mixer only takes the first voice
+    const auto& audio = renderer.getAudio();
+    assertEQ(audio.size(), 2 * 48000 / 20);
+    double mixed = 0;
+    double direct = 0;
+    for (int i = 0; i < int(audio.size()) / 2; ++i) {
+        mixed += audio[i * 2] * audio[i * 2];
+        direct += audio[i * 2 + 1] * audio[i * 2 + 1];
+    }
+    assertGT(mixed, 0);
+    assertGT(direct, 4 * mixed);
+}
+
+static void testBadPatch() {
+    PatchRenderer r1;
+    assert(!parse(r1, "module x NoSuchModule\n"));
+
+    PatchRenderer r2;
+    assert(!parse(r2, "module a Basic\ncable a 0 b 0\n"));
+
+    PatchRenderer r3;
+    assert(!parse(r3, "module a Basic\nmodule a Mix8\n"));
+
+    PatchRenderer r4;
+    assert(!parse(r4, "frobnicate\n"));
+
+    // port ids aren't known until the modules are made
+    PatchRenderer r5;
+    assert(parse(r5, "module a Basic\nmodule b Mix8\ncable a 100 b 0\n"));
+    assert(!r5.render(""));
+}
+
+void testPatchRenderer() {
+    testRender();
+    testPolyCable();
+    testBadPatch();
+}
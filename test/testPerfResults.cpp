@@ -0,0 +1,176 @@
+#include <stdio.h>
+
+#include "PerfResults.h"
+#include "asserts.h"
+
+static void testPercentile() {
+    std::vector<double> x = {1, 2, 3, 4, 5};
+    assertEQ(PerfResults::percentile(x, 0), 1);
+    assertEQ(PerfResults::percentile(x, .5), 3);
+    assertEQ(PerfResults::percentile(x, 1), 5);
+    assertClose(PerfResults::percentile(x, .95), 4.8, .0001);
+
+    std::vector<double> one = {7};
+    assertEQ(PerfResults::percentile(one, .99), 7);
+}
+
+static void testSummarize() {
+    // out of order, with one slow outlier
+    auto r = PerfResults::summarize("x", 100, {12, 10, 11, 50, 10});
+    assertEQ(r.name, "x");
+    assertEQ(r.iterations, 100);
+    assertEQ(r.trials, 5);
+    assertEQ(r.median, 11);
+    assertEQ(r.best, 10);
+    assertGT(r.p99, r.p95);
+    assertGT(r.p95, 30);
+}
+
+static void testBaseline() {
+    const char* path = "perfResultsTest.json";
+    PerfResults::clear();
+    PerfResults::add(PerfResults::summarize("fast \"quoted\"", 1000, {10.5, 10.5}));
+    PerfResults::add(PerfResults::summarize("slow", 1000, {100, 100}));
+    assert(PerfResults::writeJson(path));
+
+    // same numbers are fine
+    assertEQ(PerfResults::compareToBaseline(path, 10), 0);
+
+    // slow gets 20% slower
+    PerfResults::clear();
+    PerfResults::add(PerfResults::summarize("fast \"quoted\"", 1000, {10.5, 10.5}));
+    PerfResults::add(PerfResults::summarize("slow", 1000, {120, 120}));
+    assertEQ(PerfResults::compareToBaseline(path, 10), 1);
+    assertEQ(PerfResults::compareToBaseline(path, 25), 0);
+
+    PerfResults::clear();
+    remove(path);
+    assertEQ(PerfResults::compareToBaseline(path, 10), -1);
+}
+
+// names are how we match up with the baseline, so they must not repeat
+static void testDuplicateNames() {
+    const char* path = "perfResultsTest.json";
+    PerfResults::clear();
+    PerfResults::add(PerfResults::summarize("a", 1000, {10}));
+    PerfResults::add(PerfResults::summarize("b", 1000, {10}));
+    PerfResults::add(PerfResults::summarize("a", 1000, {20}));
+    assert(!PerfResults::writeJson(path));
+    assertEQ(PerfResults::compareToBaseline(path, 10), -1);
+
+    // a baseline with a repeat can't be used either
+    {
+        FILE* f = fopen(path, "w");
+        assert(f);
+        fprintf(f, "{\"name\": \"a\", \"median\": 10}\n");
+        fprintf(f, "{\"name\": \"a\", \"median\": 20}\n");
+        fclose(f);
+    }
+    PerfResults::clear();
+    PerfResults::add(PerfResults::summarize("a", 1000, {10}));
+    assertEQ(PerfResults::compareToBaseline(path, 10), -1);
+
+    PerfResults::clear();
+    remove(path);
+}
+
+static void writeFile(const char* path, const char* contents) {
+    FILE* f = fopen(path, "w");
+    assert(f);
+    fprintf(f, "%s", contents);
+    fclose(f);
+}
+
+// a baseline that doesn't check anything must not pass
+static void testBadBaseline() {
+    const char* path = "perfResultsTest.json";
+    PerfResults::clear();
+    PerfResults::add(PerfResults::summarize("a", 1000, {10}));
+
+    writeFile(path, "");
+    assertEQ(PerfResults::compareToBaseline(path, 10), -1);
+
+    // cut off before the benchmarks
+    writeFile(path, "{\n  \"build\": \"x\",\n  \"benchmarks\": [\n");
+    assertEQ(PerfResults::compareToBaseline(path, 10), -1);
+
+    // from some other set of benchmarks
+    writeFile(path, "{\"name\": \"b\", \"median\": 10}\n");
+    assertEQ(PerfResults::compareToBaseline(path, 10), -1);
+
+    PerfResults::clear();
+    remove(path);
+}
+
+// a benchmark in the baseline that didn't run this time is a failure
+static void testMissingFromRun() {
+    const char* path = "perfResultsTest.json";
+    PerfResults::clear();
+    PerfResults::add(PerfResults::summarize("a", 1000, {10}));
+    PerfResults::add(PerfResults::summarize("b", 1000, {10}));
+    PerfResults::add(PerfResults::summarize("c", 1000, {10}));
+    assert(PerfResults::writeJson(path));
+
+    PerfResults::clear();
+    PerfResults::add(PerfResults::summarize("a", 1000, {10}));
+    assertEQ(PerfResults::compareToBaseline(path, 10), 2);
+
+    // new benchmarks that aren't in the baseline yet are ok
+    PerfResults::add(PerfResults::summarize("b", 1000, {10}));
+    PerfResults::add(PerfResults::summarize("c", 1000, {10}));
+    PerfResults::add(PerfResults::summarize("d", 1000, {10}));
+    assertEQ(PerfResults::compareToBaseline(path, 10), 0);
+
+    PerfResults::clear();
+    remove(path);
+}
+
+static void testAddCounters() {
+    PerfCounters::Counts counts;
+    counts.values[PerfCounters::CYCLES] = 2000;
+    counts.values[PerfCounters::INSTRUCTIONS] = 3000;
+    counts.values[PerfCounters::BRANCH_MISSES] = 10;
+
+    auto r = PerfResults::summarize("x", 100, {1});
+    assert(!r.hasCounters);
+    PerfResults::addCounters(r, counts, 100);
+    assert(r.hasCounters);
+    assertEQ(r.ipc, 1.5);
+    assertEQ(r.perSample[PerfCounters::CYCLES], 20);
+    assertEQ(r.perSample[PerfCounters::BRANCH_MISSES], .1);
+    assertEQ(r.perSample[PerfCounters::LLC_MISSES], 0);
+}
+
+// we can only test these on machines that let us read the counters
+static void testCounters() {
+    PerfCounters counters;
+    if (!counters.open()) {
+        counters.start();
+        counters.stop();
+        assertEQ(counters.getTotal().values[PerfCounters::INSTRUCTIONS], 0);
+        return;
+    }
+
+    volatile float x = 0;
+    counters.start();
+    for (int i = 0; i < 10000; ++i) {
+        x = x + 1;
+    }
+    counters.stop();
+    assertGT(counters.getTotal().values[PerfCounters::INSTRUCTIONS], 10000);
+    assertGT(counters.getTotal().values[PerfCounters::CYCLES], 0);
+
+    counters.clear();
+    assertEQ(counters.getTotal().values[PerfCounters::INSTRUCTIONS], 0);
+}
+
+void testPerfResults() {
+    testPercentile();
+    testSummarize();
+    testBaseline();
+    testDuplicateNames();
+    testBadBaseline();
+    testMissingFromRun();
+    testAddCounters();
+    testCounters();
+}
@@ -1,6 +1,7 @@
 #include "TestComposite.h"
 #include "asserts.h"
 #include "poly.h"
+#include "simd.h"
 #include "Analyzer.h"
 #include "Shaper.h"
 #include "SinOscillator.h"
@@ -99,6 +100,54 @@ static void testDC()
     }
 }
 
+static void _testChebyshevMatchesPoly(int term, float gain)
+{
+    Poly<double, 10> poly;
+    ChebyshevPoly<float_4, 10> cheby;
+    poly.setGain(term, 1);
+    cheby.setGain(term, 1);
+    cheby.update(gain);
+
+    for (float x = -1; x <= 1; x += .01f) {
+        const float expected = poly.run(x, gain);
+        const float_4 actual = cheby.run(x);
+        for (int i = 0; i < 4; ++i) {
+            assertClose(actual[i], expected, .0001);
+        }
+    }
+}
+
+static void testChebyshevMatchesPoly()
+{
+    for (int i = 0; i < 10; ++i) {
+        _testChebyshevMatchesPoly(i, 1);
+        _testChebyshevMatchesPoly(i, .56f);
+        _testChebyshevMatchesPoly(i, .17f);
+    }
+}
+
+// all the harmonics at once, and a different input gain in each lane
+static void testChebyshevMixLanes()
+{
+    const float gains[4] = {1, .83f, .56f, .17f};
+    Poly<double, 10> poly[4];
+    ChebyshevPoly<float_4, 10> cheby;
+    for (int term = 0; term < 10; ++term) {
+        const float level = 1.f / (term + 1);
+        cheby.setGain(term, level);
+        for (int i = 0; i < 4; ++i) {
+            poly[i].setGain(term, level);
+        }
+    }
+    cheby.update(float_4::load(gains));
+
+    for (float x = -1; x <= 1; x += .01f) {
+        const float_4 actual = cheby.run(x);
+        for (int i = 0; i < 4; ++i) {
+            assertClose(actual[i], poly[i].run(x, gains[i]), .0001);
+        }
+    }
+}
 
 void testPoly()
 {
@@ -106,4 +155,6 @@ void testPoly()
     test1();
     testDC();
     testTerms();
+    testChebyshevMatchesPoly();
+    testChebyshevMixLanes();
 }
\ No newline at end of file
@@ -169,6 +169,14 @@ static void testDeInterleaveHigh() {
     assertEQ(z[3], y[3]);
 }
 
+static void testSum() {
+    assertEQ(SimdBlocks::sum(float_4(1, 2, 3, 4)), 10);
+    assertEQ(SimdBlocks::sum(float_4(1.5f, -2, 3.25f, -4)), -1.25f);
+    assertEQ(SimdBlocks::sum(float_4(-1, -2, -3, -4)), -10);
+    assertEQ(SimdBlocks::sum(float_4(3, -3, 5, -5)), 0);
+    assertEQ(SimdBlocks::sum(float_4(0, 0, -7, 0)), -7);
+}
+
 static void testBools() {
     float_4 x = SimdBlocks::maskTrue();
     simd_assertMask(x);
@@ -193,6 +201,7 @@ void testSimd() {
     testMask();
     testMaskInt();
     testMinMax();
+    testSum();
     testDeInterleaveLow();
     testDeInterleaveHigh();
 
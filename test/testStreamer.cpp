@@ -1,5 +1,9 @@
 
+#include <chrono>
+#include <thread>
+
 #include "CubicInterpolator.h"
+#include "DiskStreamer.h"
 #include "FixedPointAccumulator.h"
 #include "SqLog.h"
 #include "Streamer.h"
@@ -79,6 +83,26 @@ static void testCubicInterp3Double() {
     assertClose(x, 100, .0000001);
 }
 
+static void testCubicInterpSimd() {
+    const float data[4][4] = {
+        {10, 9, 8, 7},
+        {1, 1, 21, 21},
+        {0, 100, 100, 0},
+        {-1, .5f, -.25f, 1}};
+    const float_4 x(0, .25f, .5f, .999f);
+
+    const float_4 y = CubicInterpolator<float_4>::interpolateFrac(
+        x,
+        float_4(data[0][0], data[1][0], data[2][0], data[3][0]),
+        float_4(data[0][1], data[1][1], data[2][1], data[3][1]),
+        float_4(data[0][2], data[1][2], data[2][2], data[3][2]),
+        float_4(data[0][3], data[1][3], data[2][3], data[3][3]));
+    for (int i = 0; i < 4; ++i) {
+        const float expected = CubicInterpolator<float>::interpolate(data[i], 1 + x[i]);
+        assertClose(y[i], expected, .0001);
+    }
+}
+
 //****************************************** Streamer tests *****************
 static void testStream() {
     Streamer s;
@@ -98,6 +122,81 @@ static void testStream() {
     assert(!s.channels[0].loopActive);
 }
 
+// channels are independent, and silent ones output zero
+static void testStreamChannels() {
+    float data[100];
+    for (int i = 0; i < 100; ++i) {
+        data[i] = float(i) / 100;
+    }
+
+    Streamer s;
+    Streamer s0;
+    s.setSample(0, data, 100);
+    s.setLoopData(0, CompiledRegion::LoopData());
+    s.setSample(2, data + 10, 90);
+    s.setLoopData(2, CompiledRegion::LoopData());
+    s0.setSample(0, data + 10, 90);
+    s0.setLoopData(0, CompiledRegion::LoopData());
+    s.setTranspose(float_4(1, 1, 1.3f, 1));
+    s0.setTranspose(float_4(1.3f, 1, 1, 1));
+
+    for (int i = 0; i < 80; ++i) {
+        const float_4 x = s.step(0, false);
+        const float_4 x0 = s0.step(0, false);
+        if (i > 0) {
+            assertClose(x[0], data[i], .0001);
+        }
+        assertEQ(x[1], 0);
+        assertEQ(x[2], x0[0]);
+        assertEQ(x[3], 0);
+    }
+    assertEQ(s._cd(0).canPlay(), true);
+    assertEQ(s._cd(2).canPlay(), false);
+}
+
+// stepBlock should give exactly the same output as step, even when
+// some channels cross the loop or end points in the middle of a block.
+static void testStreamBlock() {
+    const int size = 1000;
+    float data[size];
+    for (int i = 0; i < size; ++i) {
+        data[i] = float(i) / size;
+    }
+
+    Streamer s;
+    Streamer sBlock;
+    CompiledRegion::LoopData loopData;
+    loopData.loop_start = 100;
+    loopData.loop_end = 300;
+    loopData.loop_mode = SamplerSchema::DiscreteValue::LOOP_CONTINUOUS;
+    for (Streamer* st : {&s, &sBlock}) {
+        st->setSample(0, data, size);
+        st->setLoopData(0, loopData);
+        st->setSample(1, data, size);
+        st->setLoopData(1, CompiledRegion::LoopData());
+        st->setSample(3, data, size);
+        st->setLoopData(3, CompiledRegion::LoopData());
+        st->setTranspose(float_4(1.7f, 1, 1, .6f));
+    }
+    assert(s.channels[0].loopActive);
+
+    const int blockSize = 32;
+    float_4 block[blockSize];
+    for (int i = 0; i < 2000; i += blockSize) {
+        const float_4 fm(.01f, 0, 0, -.001f);
+        sBlock.stepBlock(block, blockSize, fm, true);
+        for (int j = 0; j < blockSize; ++j) {
+            const float_4 x = s.step(fm, true);
+            for (int channel = 0; channel < 4; ++channel) {
+                assertEQ(block[j][channel], x[channel]);
+            }
+        }
+    }
+    assertEQ(s._cd(1).canPlay(), false);
+    assertEQ(sBlock._cd(1).canPlay(), false);
+    assertEQ(sBlock._cd(0).canPlay(), true);
+}
+
 static void testStreamLoopData() {
     Streamer s;
     float data[1000] = {0};
@@ -508,6 +607,173 @@ static void testBugCaseHighFreq() {
     assertEQ(s._cd(channel).canPlay(), false);
 }
 
+//********************************* Disk streaming tests ********************************
+
+/**
+ * A fake wave that holds a ramp in memory, but pretends that
+ * only the first residentFrames are loaded.
+ */
+class TestStreamedWave : public WaveInfoInterface {
+public:
+    TestStreamedWave(unsigned int frames, unsigned int resident) : residentFrames(resident) {
+        for (unsigned int i = 0; i < frames; ++i) {
+            data.push_back(float(i));
+        }
+    }
+    unsigned int getSampleRate() override { return 44100; }
+    uint64_t getTotalFrameCount() override { return data.size(); }
+    uint64_t getResidentFrameCount() override { return residentFrames; }
+    bool isValid() const override { return true; }
+    const float* getData() override { return data.data(); }
+    bool load(std::string& errorMsg) override { return true; }
+    std::string getFileName() override { return "test"; }
+
+    WaveStreamSourcePtr openStream() override {
+        return WaveStreamSourcePtr(new Source(data));
+    }
+
+private:
+    class Source : public WaveStreamSource {
+    public:
+        Source(const std::vector<float>& d) : data(d) {}
+        bool seek(uint64_t frame) override {
+            pos = frame;
+            return frame < data.size();
+        }
+        unsigned read(float* dest, unsigned frames) override {
+            unsigned ret = 0;
+            for (; ret < frames && pos < data.size(); ++ret) {
+                dest[ret] = data[pos++];
+            }
+            return ret;
+        }
+
+    private:
+        const std::vector<float>& data;
+        uint64_t pos = 0;
+    };
+
+    std::vector<float> data;
+    const unsigned int residentFrames;
+};
+
+static void testStreamBufferUnderrun() {
+    TestStreamedWave wave(100000, 1000);
+    StreamBuffer buffer(8 * 1024);
+    float taps[4] = {1, 1, 1, 1};
+
+    buffer.au_start(&wave, 996);
+    bool b = buffer.au_getFrames(996, 100000, taps);
+    assert(!b);
+    assertEQ(taps[0], 0);
+    assertEQ(buffer._underruns(), 1);
+
+    // now let the reader get it
+    buffer.rd_service();
+    buffer.rd_service();
+    b = buffer.au_getFrames(996, 100000, taps);
+    assert(b);
+    assertEQ(taps[0], 996);
+    assertEQ(taps[3], 999);
+
+    // past the end comes back as zeros
+    buffer.au_start(&wave, 100000 - 100);
+    buffer.rd_service();
+    buffer.rd_service();
+    b = buffer.au_getFrames(100000 - 2, 100000, taps);
+    assert(b);
+    assertEQ(taps[0], 100000 - 2);
+    assertEQ(taps[1], 100000 - 1);
+    assertEQ(taps[2], 0);
+    assertEQ(taps[3], 0);
+}
+
+static void testStreamBufferWrap() {
+    const unsigned int frames = 100000;
+    TestStreamedWave wave(frames, 1000);
+    StreamBuffer buffer(8 * 1024);
+    float taps[4];
+
+    buffer.au_start(&wave, 996);
+    // first service picks up the request, the second one reads.
+    buffer.rd_service();
+    for (unsigned int i = 996; i < frames - 4; ++i) {
+        buffer.au_setReadFrame(i);
+        buffer.rd_service();
+        bool b = buffer.au_getFrames(i, frames, taps);
+        assert(b);
+        assertEQ(taps[0], float(i));
+        assertEQ(taps[3], float(i + 3));
+    }
+    assertEQ(buffer._underruns(), 0);
+}
+
+static void testStreamerStreamed() {
+    const unsigned int frames = 20000;
+    const unsigned int resident = 1000;
+    TestStreamedWave wave(frames, resident);
+    DiskStreamer diskStreamer(8 * 1024);
+    StreamBuffer* buffer = diskStreamer.getVoice(0);
+
+    Streamer s;
+    s.setStreamedSample(0, &wave, wave.getData(), resident, frames, buffer);
+    CompiledRegion::LoopData loopData;
+    s.setLoopData(0, loopData);
+    s.setTranspose(float_4(1));
+
+    // run the disk reader synchronously, once every 64 samples
+    for (unsigned int i = 0; i < frames - 2; ++i) {
+        if ((i % 64) == 0) {
+            diskStreamer._serviceAll();
+        }
+        const float x = s.step(0, false)[0];
+        assertClose(x, float(i), .01);
+    }
+    assertEQ(buffer->_underruns(), 0);
+}
+
+// the reader thread sleeps until the audio thread wakes it, so
+// if a wakeup gets lost this stops getting data.
+static void testDiskStreamerThread() {
+    const unsigned int frames = 100000;
+    TestStreamedWave wave(frames, 1000);
+    DiskStreamer diskStreamer(8 * 1024);
+    diskStreamer.start();
+    StreamBuffer* buffer = diskStreamer.getVoice(0);
+    float taps[4];
+
+    buffer->au_start(&wave, 1000);
+    for (unsigned int i = 1000; i < frames - 4; ++i) {
+        buffer->au_setReadFrame(i);
+        for (int tries = 0; !buffer->au_getFrames(i, frames, taps); ++tries) {
+            // give up after a second
+            assertLT(tries, 10000);
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        assertEQ(taps[0], float(i));
+        assertEQ(taps[3], float(i + 3));
+    }
+    buffer->au_stop();
+}
+
+static void testStreamerStreamedLoopIgnored() {
+    const unsigned int frames = 20000;
+    const unsigned int resident = 1000;
+    TestStreamedWave wave(frames, resident);
+    DiskStreamer diskStreamer(8 * 1024);
+
+    Streamer s;
+    s.setStreamedSample(0, &wave, wave.getData(), resident, frames, diskStreamer.getVoice(0));
+    CompiledRegion::LoopData loopData;
+    loopData.loop_start = 100;
+    loopData.loop_end = 5000;
+    loopData.loop_mode = SamplerSchema::DiscreteValue::LOOP_CONTINUOUS;
+    s.setLoopData(0, loopData);
+
+    // can't loop past the resident part
+    assert(!s.channels[0].loopActive);
+}
+
 // this fixed point acc was a dead end....
 static void testFixedPoint0() {
     FixedPointAccumulator a;
@@ -543,8 +809,11 @@ void testStreamer() {
     testCubicInterpDouble();
     testCubicInterp2Double();
     testCubicInterp3Double();
+    testCubicInterpSimd();
 
     testStream();
+    testStreamChannels();
+    testStreamBlock();
     testStreamLoopData();
     testStreamLoopData2();
     testStreamValues();
@@ -560,4 +829,10 @@ void testStreamer() {
     testStreamValueOSc2();
     testStreamValueOSc3();
     testFixedPoint();
+
+    testStreamBufferUnderrun();
+    testStreamBufferWrap();
+    testStreamerStreamed();
+    testDiskStreamerThread();
+    testStreamerStreamedLoopIgnored();
 }
\ No newline at end of file
@@ -4,9 +4,15 @@
 #include "ThreadServer.h"
 #include "ThreadClient.h"
 #include "ThreadPriority.h"
+#include "LockFreeQueue.h"
+#include "ThreadPool.h"
 
+#include <algorithm>
 #include <assert.h>
+#include <chrono>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 
@@ -105,6 +111,471 @@ static void test2()
     }
 }
 
+/**************************************************************************/
+
+static void testQueue()
+{
+    LockFreeQueue<int, 4> q;
+    int x = 0;
+    assert(q.empty());
+    assert(!q.tryPop(x));
+
+    for (int i = 0; i < 4; ++i) {
+        assert(q.tryPush(i + 10));
+    }
+    assert(!q.tryPush(100));
+    assert(!q.empty());
+
+    // go around a few times, to make sure the sequence numbers wrap right
+    for (int i = 0; i < 20; ++i) {
+        assert(q.tryPop(x));
+        assertEQ(x, i + 10);
+        assert(q.tryPush(i + 14));
+    }
+    for (int i = 0; i < 4; ++i) {
+        assert(q.tryPop(x));
+        assertEQ(x, i + 30);
+    }
+    assert(q.empty());
+}
+
+// several producers, one consumer. Every value must come out exactly once,
+// and in order for each producer.
+static void testQueueStress()
+{
+    const int numProducers = 4;
+    const int valuesPerProducer = 200000;
+    LockFreeQueue<int, 16> q;
+
+    std::vector<std::shared_ptr<std::thread>> threads;
+    for (int producer = 0; producer < numProducers; ++producer) {
+        threads.push_back(std::make_shared<std::thread>([&q, producer, valuesPerProducer]() {
+            for (int i = 0; i < valuesPerProducer; ++i) {
+                while (!q.tryPush((producer << 24) | i)) {
+                    std::this_thread::yield();
+                }
+            }
+        }));
+    }
+
+    int nextExpected[numProducers] = {0};
+    for (int received = 0; received < numProducers * valuesPerProducer; ) {
+        int x;
+        if (q.tryPop(x)) {
+            const int producer = x >> 24;
+            const int value = x & 0xffffff;
+            assert(producer >= 0 && producer < numProducers);
+            assertEQ(value, nextExpected[producer]);
+            ++nextExpected[producer];
+            ++received;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    for (auto thread : threads) {
+        thread->join();
+    }
+    for (int producer = 0; producer < numProducers; ++producer) {
+        assertEQ(nextExpected[producer], valuesPerProducer);
+    }
+    assert(q.empty());
+}
+
+// replies to all messages. Can be told to stall, so that messages pile up.
+class EchoServer : public ThreadServer
+{
+public:
+    EchoServer(std::shared_ptr<ThreadSharedState> state, std::atomic<bool>& hold) : ThreadServer(state), hold(hold)
+    {
+    }
+    void handleMessage(ThreadMessage* msg) override
+    {
+        assert(msg->type == ThreadMessage::Type::TEST1);
+        while (hold) {
+            std::this_thread::yield();
+        }
+        Test1Message * tstMsg = static_cast<Test1Message *>(msg);
+        tstMsg->payload += 1000;
+        sendMessageToClient(tstMsg);
+    }
+private:
+    std::atomic<bool>& hold;
+};
+
+// many messages in play at once
+static void testMultipleMessages()
+{
+    std::atomic<bool> hold(true);
+    std::shared_ptr<ThreadSharedState> state = std::make_shared<ThreadSharedState>();
+    std::unique_ptr<EchoServer> server(new EchoServer(state, hold));
+    std::unique_ptr<ThreadClient> client(new ThreadClient(state, std::move(server)));
+
+    const int numMessages = ThreadSharedState::maxMessagesInPlay;
+    std::vector<std::shared_ptr<Test1Message>> messages;
+    for (int i = 0; i < numMessages + 1; ++i) {
+        messages.push_back(std::make_shared<Test1Message>());
+    }
+
+    // server is stalled, so we can fill it up
+    uint32_t lastToken = 0;
+    for (int i = 0; i < numMessages; ++i) {
+        messages[i]->payload = i;
+        assert(client->sendMessage(messages[i].get()));
+        assert(messages[i]->token != lastToken);
+        lastToken = messages[i]->token;
+    }
+    assertEQ(client->messagesInPlay(), numMessages);
+    assert(!client->sendMessage(messages[numMessages].get()));
+
+    hold = false;
+    for (int received = 0; received < numMessages; ) {
+        ThreadMessage* msg = client->getMessage();
+        if (!msg) {
+            std::this_thread::yield();
+            continue;
+        }
+        // they come back in order, with their original token
+        Test1Message* tmsg = static_cast<Test1Message *>(msg);
+        assert(tmsg == messages[received].get());
+        assertEQ(tmsg->payload, received + 1000);
+        ++received;
+    }
+    assertEQ(client->messagesInPlay(), 0);
+    assert(!client->getMessage());
+}
+
+// client keeps a few messages going at once, for a long time
+static void testMultipleMessagesStress()
+{
+    std::atomic<bool> hold(false);
+    std::shared_ptr<ThreadSharedState> state = std::make_shared<ThreadSharedState>();
+    std::unique_ptr<EchoServer> server(new EchoServer(state, hold));
+    std::unique_ptr<ThreadClient> client(new ThreadClient(state, std::move(server)));
+
+    const int numMessages = 8;
+    const int numRounds = 50000;
+    std::vector<std::shared_ptr<Test1Message>> pool;
+    for (int i = 0; i < numMessages; ++i) {
+        pool.push_back(std::make_shared<Test1Message>());
+    }
+    std::vector<Test1Message*> idle;
+    for (auto msg : pool) {
+        idle.push_back(msg.get());
+    }
+
+    int sent = 0;
+    int received = 0;
+    std::vector<uint32_t> expectedTokens;
+    while (received < numRounds) {
+        while (!idle.empty() && sent < numRounds) {
+            Test1Message* msg = idle.back();
+            msg->payload = sent;
+            if (!client->sendMessage(msg)) {
+                break;
+            }
+            idle.pop_back();
+            expectedTokens.push_back(msg->token);
+            ++sent;
+        }
+        ThreadMessage* msg = client->getMessage();
+        if (msg) {
+            Test1Message* tmsg = static_cast<Test1Message *>(msg);
+            assertEQ(tmsg->token, expectedTokens[received]);
+            assertEQ(tmsg->payload, received + 1000);
+            ++received;
+            idle.push_back(tmsg);
+        }
+    }
+    assertEQ(client->messagesInPlay(), 0);
+}
+
+// not a real test. Measures round trip time from client to server and back.
+static void testLatency()
+{
+    std::atomic<bool> hold(false);
+    std::shared_ptr<ThreadSharedState> state = std::make_shared<ThreadSharedState>();
+    std::unique_ptr<EchoServer> server(new EchoServer(state, hold));
+    std::unique_ptr<ThreadClient> client(new ThreadClient(state, std::move(server)));
+    Test1Message msg;
+
+    for (int sleep = 0; sleep < 2; ++sleep) {
+        const int iterations = sleep ? 200 : 20000;
+        double totalMicroseconds = 0;
+        double maxMicroseconds = 0;
+        for (int i = 0; i < iterations; ++i) {
+            if (sleep) {
+                // give the server time to go to sleep, so we measure the wake up, too.
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+            const auto start = std::chrono::high_resolution_clock::now();
+            assert(client->sendMessage(&msg));
+            while (!client->getMessage()) {
+            }
+            const auto end = std::chrono::high_resolution_clock::now();
+            const double us = std::chrono::duration<double, std::micro>(end - start).count();
+            totalMicroseconds += us;
+            maxMicroseconds = std::max(maxMicroseconds, us);
+        }
+        printf("thread message round trip (%s): avg %f us, max %f us\n",
+               sleep ? "after idle" : "back to back",
+               totalMicroseconds / iterations,
+               maxMicroseconds);
+    }
+    fflush(stdout);
+}
+
+// records the order servers handle messages in, so we can check the pool's scheduling.
+class PoolServer : public ThreadServer
+{
+public:
+    PoolServer(std::shared_ptr<ThreadSharedState> state, Priority priority, int id, std::atomic<bool>& hold) :
+        ThreadServer(state, priority), id(id), hold(hold)
+    {
+    }
+    void handleMessage(ThreadMessage* msg) override
+    {
+        ++started;
+        while (hold) {
+            std::this_thread::yield();
+        }
+        Test1Message * tstMsg = static_cast<Test1Message *>(msg);
+        std::this_thread::sleep_for(std::chrono::milliseconds(tstMsg->payload));
+        {
+            std::lock_guard<std::mutex> lock(orderMutex);
+            order.push_back(id);
+        }
+        sendMessageToClient(tstMsg);
+    }
+
+    static std::mutex orderMutex;
+    static std::vector<int> order;
+    static std::atomic<int> started;
+private:
+    const int id;
+    std::atomic<bool>& hold;
+};
+
+std::mutex PoolServer::orderMutex;
+std::vector<int> PoolServer::order;
+std::atomic<int> PoolServer::started;
+
+static std::unique_ptr<ThreadClient> makePoolClient(ThreadServer::Priority priority, int id, std::atomic<bool>& hold)
+{
+    std::shared_ptr<ThreadSharedState> state = std::make_shared<ThreadSharedState>();
+    std::unique_ptr<ThreadServer> server(new PoolServer(state, priority, id, hold));
+    return std::unique_ptr<ThreadClient>(new ThreadClient(state, std::move(server)));
+}
+
+static int countInOrder(int id)
+{
+    std::lock_guard<std::mutex> lock(PoolServer::orderMutex);
+    return int(std::count(PoolServer::order.begin(), PoolServer::order.end(), id));
+}
+
+// With only one worker, a module that sends a lot of slow messages
+// must not keep a second module waiting until they are all done.
+static void testPoolFairness()
+{
+    ThreadPool::get().setNumThreads(1);
+    PoolServer::order.clear();
+    std::atomic<bool> hold(false);
+    auto busyClient = makePoolClient(ThreadServer::Priority::Normal, 1, hold);
+    auto otherClient = makePoolClient(ThreadServer::Priority::Normal, 2, hold);
+
+    const int numMessages = 32;
+    std::vector<std::shared_ptr<Test1Message>> messages;
+    for (int i = 0; i < numMessages; ++i) {
+        messages.push_back(std::make_shared<Test1Message>());
+        messages.back()->payload = 1;
+        assert(busyClient->sendMessage(messages.back().get()));
+    }
+
+    Test1Message otherMessage;
+    otherMessage.payload = 0;
+    assert(otherClient->sendMessage(&otherMessage));
+    while (!otherClient->getMessage()) {
+        std::this_thread::yield();
+    }
+    const int busyDone = countInOrder(1);
+    assert(busyDone < numMessages / 2);
+
+    for (int received = 0; received < numMessages; ) {
+        if (busyClient->getMessage()) {
+            ++received;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    ThreadPool::get().setNumThreads(0);
+}
+
+// High priority servers go to the front of the line.
+static void testPoolPriority()
+{
+    ThreadPool::get().setNumThreads(1);
+    assertEQ(ThreadPool::get().getNumThreads(), 1);
+    PoolServer::order.clear();
+    PoolServer::started = 0;
+    std::atomic<bool> hold(true);
+    std::atomic<bool> noHold(false);
+    auto blockingClient = makePoolClient(ThreadServer::Priority::Normal, 1, hold);
+    auto normalClient = makePoolClient(ThreadServer::Priority::Normal, 2, noHold);
+    auto highClient = makePoolClient(ThreadServer::Priority::High, 3, noHold);
+
+    // tie up the only worker
+    Test1Message blockingMessage, normalMessage, highMessage;
+    blockingMessage.payload = normalMessage.payload = highMessage.payload = 0;
+    assert(blockingClient->sendMessage(&blockingMessage));
+    while (PoolServer::started == 0) {
+        std::this_thread::yield();
+    }
+
+    // normal gets in line first, but high should still go first.
+    assert(normalClient->sendMessage(&normalMessage));
+    assert(highClient->sendMessage(&highMessage));
+    hold = false;
+
+    while (!normalClient->getMessage()) {
+        std::this_thread::yield();
+    }
+    while (!highClient->getMessage() || !blockingClient->getMessage()) {
+        std::this_thread::yield();
+    }
+
+    std::lock_guard<std::mutex> lock(PoolServer::orderMutex);
+    assertEQ(PoolServer::order.size(), 3);
+    assertEQ(PoolServer::order[0], 1);
+    assertEQ(PoolServer::order[1], 3);
+    assertEQ(PoolServer::order[2], 2);
+    ThreadPool::get().setNumThreads(0);
+}
+
+// With two workers, neither is reserved for high priority,
+// so two normal servers can run at once.
+static void testPoolTwoNormal()
+{
+    ThreadPool::get().setNumThreads(2);
+    PoolServer::order.clear();
+    PoolServer::started = 0;
+    std::atomic<bool> hold(true);
+    auto client1 = makePoolClient(ThreadServer::Priority::Normal, 1, hold);
+    auto client2 = makePoolClient(ThreadServer::Priority::Normal, 2, hold);
+
+    Test1Message message1, message2;
+    message1.payload = message2.payload = 0;
+    assert(client1->sendMessage(&message1));
+    assert(client2->sendMessage(&message2));
+    while (PoolServer::started < 2) {
+        std::this_thread::yield();
+    }
+    hold = false;
+
+    while (!client1->getMessage() || !client2->getMessage()) {
+        std::this_thread::yield();
+    }
+    ThreadPool::get().setNumThreads(0);
+}
+
+// Deleting a client that is only waiting in line must not
+// wait for a worker to get to it.
+static void testPoolRemoveQueued()
+{
+    ThreadPool::get().setNumThreads(1);
+    PoolServer::order.clear();
+    PoolServer::started = 0;
+    std::atomic<bool> hold(true);
+    std::atomic<bool> noHold(false);
+    auto blockingClient = makePoolClient(ThreadServer::Priority::Normal, 1, hold);
+    auto queuedClient = makePoolClient(ThreadServer::Priority::Normal, 2, noHold);
+
+    Test1Message blockingMessage, queuedMessage;
+    blockingMessage.payload = queuedMessage.payload = 0;
+    assert(blockingClient->sendMessage(&blockingMessage));
+    while (PoolServer::started == 0) {
+        std::this_thread::yield();
+    }
+    assert(queuedClient->sendMessage(&queuedMessage));
+
+    // the only worker is still held, so if this waited it would never return.
+    queuedClient.reset();
+    hold = false;
+
+    while (!blockingClient->getMessage()) {
+        std::this_thread::yield();
+    }
+    blockingClient.reset();
+
+    // the worker will throw away the removed one when it gets to it.
+    while (ThreadSharedState::_dbgCount > 0) {
+        std::this_thread::yield();
+    }
+    assertEQ(countInOrder(2), 0);
+    ThreadPool::get().setNumThreads(0);
+}
+
+// Deleting a client while its message is being handled
+// waits until it is done, and no longer.
+static void testPoolRemoveRunning()
+{
+    ThreadPool::get().setNumThreads(1);
+    PoolServer::order.clear();
+    PoolServer::started = 0;
+    std::atomic<bool> hold(true);
+    auto client = makePoolClient(ThreadServer::Priority::Normal, 1, hold);
+
+    Test1Message message;
+    message.payload = 0;
+    assert(client->sendMessage(&message));
+    while (PoolServer::started == 0) {
+        std::this_thread::yield();
+    }
+
+    std::atomic<bool> removed(false);
+    std::thread remover([&client, &removed]() {
+        client.reset();
+        removed = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    assert(!removed);
+
+    hold = false;
+    remover.join();
+    assert(removed);
+    assertEQ(countInOrder(1), 1);
+    ThreadPool::get().setNumThreads(0);
+}
+
+// Once the pool is full, more servers are turned away rather than
+// overflowing the line.
+static void testPoolFull()
+{
+    std::atomic<bool> noHold(false);
+    std::vector<std::unique_ptr<ThreadClient>> clients;
+    for (int i = 0; i < ThreadPool::maxServers; ++i) {
+        clients.push_back(makePoolClient(ThreadServer::Priority::Normal, 1, noHold));
+    }
+    auto extraClient = makePoolClient(ThreadServer::Priority::Normal, 2, noHold);
+
+    Test1Message message, extraMessage;
+    message.payload = extraMessage.payload = 0;
+    assert(clients.back()->sendMessage(&message));
+    assert(extraClient->sendMessage(&extraMessage));
+    while (!clients.back()->getMessage()) {
+        std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    assert(!extraClient->getMessage());
+
+    // once there is room, new ones get in again
+    extraClient.reset();
+    clients.pop_back();
+    auto newClient = makePoolClient(ThreadServer::Priority::Normal, 3, noHold);
+    assert(newClient->sendMessage(&message));
+    while (!newClient->getMessage()) {
+        std::this_thread::yield();
+    }
+}
+
 // not a real test
 static void test3()
 {
@@ -223,7 +694,18 @@ void testThread(bool extended)
     test1();
     test2();
     test3();
+    testQueue();
+    testQueueStress();
+    testMultipleMessages();
+    testMultipleMessagesStress();
+    testPoolFairness();
+    testPoolPriority();
+    testPoolTwoNormal();
+    testPoolRemoveQueued();
+    testPoolRemoveRunning();
+    testPoolFull();
     if (extended) {
+        testLatency();
         test4();
     }
 #ifdef ARCH_WIN
@@ -229,6 +229,39 @@ static void testClamp()
     assertEQ(std::clamp(12, 13, 15), 13);
 }
 
+// each channel of a poly CHB should sound just like a mono one at the same pitch
+static void testPolyCh()
+{
+    const int numChannels = 6;
+    CH mono;
+    CH poly;
+    mono.inputs[CH::CV_INPUT].channels = 1;
+    poly.inputs[CH::CV_INPUT].channels = numChannels;
+    for (CH* chb : {&mono, &poly}) {
+        chb->outputs[CH::MIX_OUTPUT].channels = 1;
+        chb->params[CH::PARAM_H2].value = .5;
+        chb->params[CH::PARAM_H5].value = .7f;
+    }
+
+    for (int channel = 0; channel < numChannels; ++channel) {
+        poly.inputs[CH::CV_INPUT].setVoltage(channel * .3f - 1, channel);
+    }
+    const int testChannel = 5;
+    mono.inputs[CH::CV_INPUT].setVoltage(testChannel * .3f - 1, 0);
+
+    for (int i = 0; i < 1000; ++i) {
+        mono.step();
+        poly.step();
+        assertClose(poly.outputs[CH::MIX_OUTPUT].getVoltage(testChannel),
+                    mono.outputs[CH::MIX_OUTPUT].getVoltage(0), .0001);
+    }
+    assertEQ(int(poly.outputs[CH::MIX_OUTPUT].channels), numChannels);
+    assertEQ(int(mono.outputs[CH::MIX_OUTPUT].channels), 1);
+
+    // unused channels in the last bank are silent
+    assertEQ(poly.outputs[CH::MIX_OUTPUT].getVoltage(numChannels), 0);
+}
+
 #if 1
 void testVCO()
 {
@@ -243,6 +276,7 @@ void testVCO()
     testClamp();
   //  testTuneEv();
     testTuneCh();
+    testPolyCh();
 }
 #else
 void testVCO()
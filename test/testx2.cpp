@@ -1,4 +1,15 @@
+#include <stdio.h>
+#include <stdlib.h>
+
 #include <set>
+#include <vector>
+
+#ifdef ARCH_WIN
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #include "AudioMath.h"
 #include "CompiledInstrument.h"
@@ -7,6 +18,8 @@
 #include "InstrumentInfo.h"
 #include "SInstrument.h"
 #include "Sampler4vx.h"
+#include "SampleCache.h"
+#include "SampleDiskCache.h"
 #include "SamplerSchema.h"
 #include "SqLog.h"
 #include "WaveLoader.h"
@@ -62,6 +75,196 @@ static void testWaveLoader2() {
     assert(!x);
 }
 
+static void testWaveLoaderParallel() {
+    WaveLoader w;
+    w.setNumThreads(4);
+    const int numFiles = 20;
+    for (int i = 0; i < numFiles; ++i) {
+        w.addNextSample(FilePath("D:\\samples\\UprightPianoKW-small-SFZ-20190703\\samples\\A3vH.wav"));
+    }
+
+    float lastProgress = 0;
+    WaveLoader::LoaderState b = WaveLoader::LoaderState::Error;
+    for (bool done = false; !done;) {
+        b = w.loadNextFile();
+        done = (b != WaveLoader::LoaderState::Progress);
+        const float progress = w.getProgressPercent();
+        assertGE(progress, lastProgress);
+        lastProgress = progress;
+    }
+    assertEQ(int(b), int(WaveLoader::LoaderState::Done));
+    assertEQ(w.getProgressPercent(), 100);
+    for (int i = 1; i <= numFiles; ++i) {
+        auto x = w.getInfo(i);
+        assert(x->isValid());
+    }
+}
+
+static void testWaveLoaderParallelError() {
+    WaveLoader w;
+    w.setNumThreads(4);
+    w.addNextSample(FilePath("a.aaa"));
+    w.addNextSample(FilePath("b.bbb"));
+    w.addNextSample(FilePath("c.ccc"));
+    w.addNextSample(FilePath("d.ddd"));
+    w.addNextSample(FilePath("e.eee"));
+
+    WaveLoader::LoaderState b = WaveLoader::LoaderState::Error;
+    for (bool done = false; !done;) {
+        b = w.loadNextFile();
+        done = (b != WaveLoader::LoaderState::Progress);
+    }
+
+    // the error for the first file wins, no matter which thread finished first
+    assertEQ(int(b), int(WaveLoader::LoaderState::Error));
+    assert(w.lastError.find(".aaa") != std::string::npos);
+    assertEQ(w.getProgressPercent(), 0);
+}
+
+static void testWaveLoaderShared() {
+    const size_t initialSize = SampleCache::get().size();
+    const FilePath path("D:\\samples\\UprightPianoKW-small-SFZ-20190703\\samples\\A3vH.wav");
+    {
+        WaveLoader w1;
+        w1.addNextSample(path);
+        assertEQ(int(w1.loadNextFile()), int(WaveLoader::LoaderState::Done));
+
+        WaveLoader w2;
+        w2.addNextSample(path);
+        assertEQ(int(w2.loadNextFile()), int(WaveLoader::LoaderState::Done));
+
+        // second one should get the same data
+        assert(w1.getInfo(1) == w2.getInfo(1));
+        assertEQ(SampleCache::get().size(), initialSize + 1);
+
+        // streamed version is a different entry
+        WaveLoader w3;
+        w3.setStreaming(true, 1000);
+        w3.addNextSample(path);
+        assertEQ(int(w3.loadNextFile()), int(WaveLoader::LoaderState::Done));
+        assert(w1.getInfo(1) != w3.getInfo(1));
+        assertEQ(SampleCache::get().size(), initialSize + 2);
+    }
+
+    // when the last loader goes, the samples go
+    assertEQ(SampleCache::get().size(), initialSize);
+}
+
+/**
+ * An empty folder in temp, for the disk cache tests to write into.
+ */
+static std::string makeTestCacheFolder() {
+#ifdef ARCH_WIN
+    const char* temp = getenv("TEMP");
+    const std::string folder = std::string(temp ? temp : ".") + "\\sqsc-test\\";
+    _mkdir(folder.c_str());
+#else
+    const std::string folder = "/tmp/sqsc-test/";
+    mkdir(folder.c_str(), 0777);
+#endif
+    SampleDiskCache::get().setFolder(folder);
+    SampleDiskCache::get().trim(0);
+    return folder;
+}
+
+static void removeTestCacheFolder(const std::string& folder) {
+    SampleDiskCache::get().trim(0);
+    SampleDiskCache::get().setFolder("");
+#ifdef ARCH_WIN
+    _rmdir(folder.c_str());
+#else
+    rmdir(folder.c_str());
+#endif
+}
+
+class TestWave : public WaveInfoInterface {
+public:
+    TestWave(int frames) : data(frames) {
+        for (int i = 0; i < frames; ++i) {
+            data[i] = float(i);
+        }
+    }
+    unsigned int getSampleRate() override { return 44100; }
+    uint64_t getTotalFrameCount() override { return data.size(); }
+    bool isValid() const override { return true; }
+    const float* getData() override { return data.data(); }
+    bool load(std::string& errorMsg) override { return true; }
+    std::string getFileName() override { return ""; }
+
+private:
+    std::vector<float> data;
+};
+
+static void writeTestFile(const std::string& path, const char* mode, const char* content) {
+    FILE* fp = fopen(path.c_str(), mode);
+    assert(fp);
+    fputs(content, fp);
+    fclose(fp);
+}
+
+// when the source changes, the old cache file goes away
+static void testDiskCacheStale() {
+    const std::string folder = makeTestCacheFolder();
+    const std::string source = folder + "source.wav";
+    writeTestFile(source, "wb", "abc");
+    SampleDiskCache& cache = SampleDiskCache::get();
+
+    TestWave wave(1000);
+    assert(cache.store(FilePath(source), wave));
+    assertGT(cache.trim(1000000), 4000);
+    {
+        auto found = cache.find(FilePath(source));
+        assert(found);
+        assertEQ(found->getTotalFrameCount(), 1000);
+        assertEQ(found->getData()[999], 999);
+    }
+
+    writeTestFile(source, "ab", "def");
+    assert(!cache.find(FilePath(source)));
+    assertEQ(cache.trim(1000000), 0);
+
+    // and trim(0) gets rid of everything
+    assert(cache.store(FilePath(source), wave));
+    assertEQ(cache.trim(0), 0);
+    assert(!cache.find(FilePath(source)));
+
+    remove(source.c_str());
+    removeTestCacheFolder(folder);
+}
+
+static void testWaveLoaderDiskCache() {
+    const FilePath path("D:\\samples\\UprightPianoKW-small-SFZ-20190703\\samples\\A3vH.wav");
+    const std::string folder = makeTestCacheFolder();
+
+    std::vector<float> decoded;
+    unsigned int sampleRate = 0;
+    {
+        WaveLoader w;
+        w.setUseDiskCache(true);
+        w.addNextSample(path);
+        assertEQ(int(w.loadNextFile()), int(WaveLoader::LoaderState::Done));
+        auto info = w.getInfo(1);
+        decoded.assign(info->getData(), info->getData() + info->getTotalFrameCount());
+        sampleRate = info->getSampleRate();
+    }
+
+    // first loader is gone, so this one has to come from the disk cache
+    {
+        WaveLoader w;
+        w.setUseDiskCache(true);
+        w.addNextSample(path);
+        assertEQ(int(w.loadNextFile()), int(WaveLoader::LoaderState::Done));
+        auto info = w.getInfo(1);
+        assert(info->isValid());
+        assertEQ(info->getSampleRate(), sampleRate);
+        assertEQ(info->getTotalFrameCount(), decoded.size());
+        for (size_t i = 0; i < decoded.size(); ++i) {
+            assertEQ(info->getData()[i], decoded[i]);
+        }
+    }
+    removeTestCacheFolder(folder);
+}
+
 static void testWaveLoaderNot44() {
     WaveLoader w;
     w.addNextSample(FilePath("D:\\samples\\K18-Upright-Piano\\K18\\A0.f.wav"));
@@ -1566,6 +1769,11 @@ void testx2() {
     testWaveLoader1Flac();
 
     testWaveLoader2();
+    testWaveLoaderParallel();
+    testWaveLoaderParallelError();
+    testWaveLoaderShared();
+    testDiskCacheStale();
+    testWaveLoaderDiskCache();
     testWaveLoaderNot44();
 
     testPlayInfo();
@@ -557,6 +557,93 @@ static void testOneShot(bool oneShot) {
     assertEQ(wasSignal, oneShot);
 }
 
+// processBlock should give exactly the same output as step
+static void testSampler4vxBlock() {
+    auto s = makeTestSampler4vx(CompiledInstrument::Tests::MiddleC, WaveLoader::Tests::RampOneSec);
+    auto sBlock = makeTestSampler4vx(CompiledInstrument::Tests::MiddleC, WaveLoader::Tests::RampOneSec);
+
+    s->note_on(0, 60, 60, 44100);
+    sBlock->note_on(0, 60, 60, 44100);
+
+    // transpose it, so we interpolate.
+    s->setExpFM(float_4(.25f));
+    sBlock->setExpFM(float_4(.25f));
+
+    const float sampleTime = 1.f / 44100.f;
+    const float_4 gates = SimdBlocks::maskTrue();
+    const int blockSize = 64;
+    float_4 block[blockSize];
+    float largest = 0;
+    for (int i = 0; i < 44100; i += blockSize) {
+        sBlock->processBlock(block, blockSize, gates, sampleTime, 0, false);
+        for (int j = 0; j < blockSize; ++j) {
+            const float_4 x = s->step(gates, sampleTime, 0, false);
+            for (int channel = 0; channel < 4; ++channel) {
+                assertEQ(block[j][channel], x[channel]);
+            }
+            largest = std::max(largest, x[0]);
+        }
+    }
+    assertGT(largest, 1);
+}
+
+// voices that are playing when the loader changes keep playing the old samples.
+static void testSampler4vxRetired() {
+    auto s = makeTestSampler4vx(CompiledInstrument::Tests::MiddleC, WaveLoader::Tests::DCOneSec);
+    const float sampleTime = 1.f / 44100.f;
+    const float_4 gates = SimdBlocks::maskTrue();
+    s->note_on(0, 60, 60, 44100);
+    s->note_on(1, 60, 60, 44100);
+    s->step(gates, sampleTime, 0, false);
+    assert(!s->isPlayingRetiredSamples());
+
+    WaveLoaderPtr w = std::make_shared<WaveLoader>();
+    w->_setTestMode(WaveLoader::Tests::DCOneSec);
+    s->setLoader(w);
+    assert(s->isPlayingRetiredSamples());
+    float_4 x = s->step(gates, sampleTime, 0, false);
+    assertGT(x[0], .01);
+    assertGT(x[1], .01);
+
+    // new note on channel 0 comes from new loader
+    s->note_on(0, 60, 60, 44100);
+    assert(s->isPlayingRetiredSamples());
+    s->note_on(1, 60, 60, 44100);
+    assert(!s->isPlayingRetiredSamples());
+
+    WaveLoaderPtr w2 = std::make_shared<WaveLoader>();
+    w2->_setTestMode(WaveLoader::Tests::DCOneSec);
+    s->setLoader(w2);
+    assert(s->isPlayingRetiredSamples());
+    s->clearRetiredSamples();
+    assert(!s->isPlayingRetiredSamples());
+    x = s->step(gates, sampleTime, 0, false);
+    assertEQ(x[0], 0);
+    assertEQ(x[1], 0);
+}
+
+static void testSamplerSharedStateGrant() {
+    SamplerSharedState state;
+    assert(!state.au_isSampleReloadRequested());
+
+    state.uiw_requestSampleReload(1);
+    assert(state.au_isSampleReloadRequested());
+    assert(!state.uiw_isSampleReloadGranted(1));
+    state.au_grantSampleReloadRequest(1);
+    assert(state.uiw_isSampleReloadGranted(1));
+    assert(!state.au_isSampleReloadRequested());
+
+    // granting a later one grants the earlier ones, too
+    state.uiw_requestSampleReload(3);
+    state.au_grantSampleReloadRequest(4);
+    assert(state.uiw_isSampleReloadGranted(3));
+    assert(!state.au_isSampleReloadRequested());
+
+    // asking for an old one again doesn't take anything back
+    state.uiw_requestSampleReload(2);
+    assert(!state.au_isSampleReloadRequested());
+}
+
 void testx5() {
 #if 1
     testSampler();
@@ -577,4 +664,7 @@ void testx5() {
     testSampOsc();
     testOneShot(false);
     testOneShot(true);
+    testSampler4vxBlock();
+    testSampler4vxRetired();
+    testSamplerSharedStateGrant();
 }
\ No newline at end of file